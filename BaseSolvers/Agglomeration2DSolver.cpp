@@ -0,0 +1,71 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "Agglomeration2DSolver.h"
+#include "DenseMDMatrix.h"
+
+CAgglomeration2DSolver::CAgglomeration2DSolver() : CAgglomerationSolver()
+{
+	m_type = ESolverTypes::SOLVER_AGGLOMERATION_2;
+}
+
+void CAgglomeration2DSolver::Initialize(const d_vect_t& _grid, const d_vect_t& _grid2, EPropertyType _type, double _beta0, EKernels _kernel, const d_vect_t& _parameters)
+{
+	SetParameters2(_grid2, _type);
+	CAgglomerationSolver::Initialize(_grid, _beta0, _kernel, _parameters);
+}
+
+void CAgglomeration2DSolver::Initialize(const d_vect_t& _grid, const d_vect_t& _grid2, EPropertyType _type, double _beta0, const std::function<kernel_t>& _kernel, const d_vect_t& _parameters)
+{
+	SetParameters2(_grid2, _type);
+	CAgglomerationSolver::Initialize(_grid, _beta0, _kernel, _parameters);
+}
+
+void CAgglomeration2DSolver::Calculate(size_t /*_count*/, const double* /*_n*/, double* /*_rateB*/, double* /*_rateD*/)
+{
+}
+
+void CAgglomeration2DSolver::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	const size_t len = GetClassesNumber() * GetClassesNumber2();
+	if (len == 0 || _n.size() % len != 0)
+		RaiseError("Wrong size of the distribution. It must be a multiple of the number of size classes multiplied by the number of property classes.");
+	_rateB.assign(_n.size(), 0.0);
+	_rateD.assign(_n.size(), 0.0);
+	Calculate(_n.size() / len, _n.data(), _rateB.data(), _rateD.data());
+}
+
+void CAgglomeration2DSolver::Calculate(const CDenseMDMatrix& _n, CDenseMDMatrix& _rateB, CDenseMDMatrix& _rateD)
+{
+	const auto classes = _n.GetClasses();
+	if (classes.size() != 2 || classes[0] != GetClassesNumber() || classes[1] != GetClassesNumber2())
+		RaiseError("Wrong dimensions of the distribution. It must be a two-dimensional matrix with dimensions (size, property) matching the grids of the solver.");
+	_rateB.SetDimensions(_n.GetDimensions(), classes);
+	_rateD.SetDimensions(_n.GetDimensions(), classes);
+	Calculate(1, _n.GetDataPtr(), _rateB.GetDataPtr(), _rateD.GetDataPtr());
+}
+
+size_t CAgglomeration2DSolver::GetClassesNumber() const
+{
+	return m_grid.empty() ? 0 : m_grid.size() - 1;
+}
+
+size_t CAgglomeration2DSolver::GetClassesNumber2() const
+{
+	return m_grid2.empty() ? 0 : m_grid2.size() - 1;
+}
+
+void CAgglomeration2DSolver::SetParameters2(const d_vect_t& _grid2, EPropertyType _type)
+{
+	m_grid2        = _grid2;
+	m_propertyType = _type;
+
+	// checks
+	if (m_grid2.size() < 2)
+		RaiseError("Grid of the second property must contain at least one class.");
+	for (size_t i = 1; i < m_grid2.size(); ++i)
+		if (m_grid2[i] <= m_grid2[i - 1])
+			RaiseError("Grid of the second property must be strictly increasing.");
+	if (m_propertyType != EPropertyType::ADDITIVE && m_propertyType != EPropertyType::AVERAGED)
+		RaiseError("Wrong type of the second property. The value must be in the range [0; 1].");
+}
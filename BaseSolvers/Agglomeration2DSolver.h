@@ -0,0 +1,123 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "AgglomerationSolver.h"
+
+class CDenseMDMatrix;
+
+/**
+ * \brief Two-dimensional agglomeration solver.
+ * \details Calculates birth and death rates of a bivariate number distribution n(x, y), where x is the particle size and y is a second property of particles.
+ * The agglomeration kernel depends only on particle volumes.
+ * All distributions are stored in a plain array [y × x], i.e. the size coordinate runs fastest, as in a CDenseMDMatrix with dimensions (size, property).
+ */
+class CAgglomeration2DSolver : public CAgglomerationSolver
+{
+public:
+	/**
+	 * \brief Types of the second property.
+	 */
+	enum class EPropertyType : size_t
+	{
+		ADDITIVE = 0, ///< Extensive property, which is summed up during agglomeration (e.g. mass of liquid or of a compound in a particle).
+		AVERAGED = 1, ///< Intensive property, which is averaged by volume during agglomeration (e.g. moisture content or porosity).
+	};
+
+protected:
+	std::vector<double> m_grid2;							///< Grid of the second property.
+	EPropertyType m_propertyType{ EPropertyType::ADDITIVE };	///< Type of the second property.
+
+public:
+	/**
+	 * \private
+	 */
+	CAgglomeration2DSolver();
+	/**
+	 * \private
+	 */
+	~CAgglomeration2DSolver() override                                       = default;
+	/**
+	 * \private
+	 */
+	CAgglomeration2DSolver(const CAgglomeration2DSolver& _other)             = default;
+	/**
+	 * \private
+	 */
+	CAgglomeration2DSolver(CAgglomeration2DSolver&& _other)                  = default;
+	/**
+	 * \private
+	 */
+	CAgglomeration2DSolver& operator=(const CAgglomeration2DSolver& _other) = default;
+	/**
+	 * \private
+	 */
+	CAgglomeration2DSolver& operator=(CAgglomeration2DSolver&& _other)      = default;
+
+	using CAgglomerationSolver::Initialize;
+	using CAgglomerationSolver::Calculate;
+
+	/**
+	 * \brief Sets all required parameters and calls Initialize()
+	 * \param _grid Diameter-related PSD grid
+	 * \param _grid2 Grid of the second property
+	 * \param _type Type of the second property
+	 * \param _beta0 Size independent agglomeration rate
+	 * \param _kernel Type of the agglomeration kernel
+	 * \param _parameters Additional parameters
+	 */
+	void Initialize(const d_vect_t& _grid, const d_vect_t& _grid2, EPropertyType _type, double _beta0, EKernels _kernel, const d_vect_t& _parameters = d_vect_t());
+	/**
+	 * \brief Sets all required parameters and calls Initialize()
+	 * \param _grid Diameter-related PSD grid
+	 * \param _grid2 Grid of the second property
+	 * \param _type Type of the second property
+	 * \param _beta0 Size independent agglomeration rate
+	 * \param _kernel Function of the agglomeration kernel
+	 * \param _parameters Additional parameters
+	 */
+	void Initialize(const d_vect_t& _grid, const d_vect_t& _grid2, EPropertyType _type, double _beta0, const std::function<kernel_t>& _kernel, const d_vect_t& _parameters = d_vect_t());
+
+	/**
+	 * \brief Main calculation function for a batch of distributions.
+	 * \details Each distribution is a plain array [y × x] of length GetClassesNumber() * GetClassesNumber2(). Distributions in the batch follow each other.
+	 * \param _count Number of distributions in the batch
+	 * \param _n Number distributions
+	 * \param _rateB Output array for birth rates
+	 * \param _rateD Output array for death rates
+	 */
+	virtual void Calculate(size_t _count, const double* _n, double* _rateB, double* _rateD);
+	/**
+	 * \brief Main calculation function for a plain vector, containing one or several distributions [y × x].
+	 * \param _n Number distributions
+	 * \param _rateB Output vector for birth rates
+	 * \param _rateD Output vector for death rates
+	 */
+	void Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD) override;
+	/**
+	 * \brief Main calculation function for a two-dimensional matrix with dimensions (size, property).
+	 * \param _n Number distribution
+	 * \param _rateB Output matrix for birth rate
+	 * \param _rateD Output matrix for death rate
+	 */
+	void Calculate(const CDenseMDMatrix& _n, CDenseMDMatrix& _rateB, CDenseMDMatrix& _rateD);
+
+	/**
+	 * \brief Returns the number of size classes.
+	 * \return Number of size classes.
+	 */
+	[[nodiscard]] size_t GetClassesNumber() const;
+	/**
+	 * \brief Returns the number of classes of the second property.
+	 * \return Number of classes of the second property.
+	 */
+	[[nodiscard]] size_t GetClassesNumber2() const;
+
+private:
+	/**
+	 * Sets parameters of the second property.
+	 */
+	void SetParameters2(const d_vect_t& _grid2, EPropertyType _type);
+};
+
+typedef DECLDIR CAgglomeration2DSolver* (*CreateAgglomeration2DSolver)();
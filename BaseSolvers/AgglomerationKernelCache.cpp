@@ -0,0 +1,233 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "AgglomerationKernelCache.h"
+#include <tuple>
+
+namespace
+{
+	// Signature of the persistent file.
+	constexpr uint64_t FILE_SIGNATURE = 0x4B43474741ULL; // "AGGCK"
+	// Version of the format of the persistent file. Files with other versions are rewritten.
+	constexpr uint64_t FILE_VERSION = 2;
+
+	template<typename T>
+	void Write(std::ofstream& _file, const T& _value)
+	{
+		_file.write(reinterpret_cast<const char*>(&_value), sizeof(_value));
+	}
+
+	template<typename T>
+	T Read(std::ifstream& _file)
+	{
+		T value{};
+		_file.read(reinterpret_cast<char*>(&value), sizeof(value));
+		return value;
+	}
+}
+
+CAgglomerationKernelCache::CKey::CKey(uint64_t _rows, uint64_t _cols)
+	: m_rows{ _rows }
+	, m_cols{ _cols }
+{
+}
+
+void CAgglomerationKernelCache::CKey::Add(const void* _data, size_t _size)
+{
+	m_data.append(static_cast<const char*>(_data), _size);
+}
+
+void CAgglomerationKernelCache::CKey::Add(uint64_t _value)
+{
+	Add(&_value, sizeof(_value));
+}
+
+void CAgglomerationKernelCache::CKey::Add(const std::vector<double>& _values)
+{
+	Add(static_cast<uint64_t>(_values.size()));
+	Add(_values.data(), _values.size() * sizeof(double));
+}
+
+uint64_t CAgglomerationKernelCache::CKey::Rows() const
+{
+	return m_rows;
+}
+
+uint64_t CAgglomerationKernelCache::CKey::Cols() const
+{
+	return m_cols;
+}
+
+const std::string& CAgglomerationKernelCache::CKey::Data() const
+{
+	return m_data;
+}
+
+bool CAgglomerationKernelCache::CKey::Matches(const table_t& _table) const
+{
+	if (_table.size() != m_rows) return false;
+	for (const auto& row : _table)
+		if (row.size() != m_cols)
+			return false;
+	return true;
+}
+
+bool CAgglomerationKernelCache::CKey::operator<(const CKey& _other) const
+{
+	return std::tie(m_rows, m_cols, m_data) < std::tie(_other.m_rows, _other.m_cols, _other.m_data);
+}
+
+std::shared_ptr<const CAgglomerationKernelCache::table_t> CAgglomerationKernelCache::Get(const CKey& _key, const std::function<table_t()>& _calculate)
+{
+	auto& cache = Instance();
+	{
+		std::lock_guard lock{ cache.m_mutex };
+		if (const auto it = cache.m_tables.find(_key); it != cache.m_tables.end())
+			return it->second;
+	}
+	// calculate without lock, since it may take long and use the thread pool
+	auto table = std::make_shared<const table_t>(_calculate());
+	if (!_key.Matches(*table)) // a wrongly described table must not be found by other solvers
+		return table;
+	std::lock_guard lock{ cache.m_mutex };
+	return cache.Insert(_key, std::move(table));
+}
+
+void CAgglomerationKernelCache::SetPersistentFile(const std::filesystem::path& _file)
+{
+	auto& cache = Instance();
+	std::lock_guard lock{ cache.m_mutex };
+	if (cache.m_file == _file) return;
+	cache.m_file = _file;
+	cache.LoadFile();
+}
+
+void CAgglomerationKernelCache::SetMemoryLimit(size_t _bytes)
+{
+	auto& cache = Instance();
+	std::lock_guard lock{ cache.m_mutex };
+	cache.m_memoryLimit = _bytes;
+	cache.Shrink();
+}
+
+size_t CAgglomerationKernelCache::Size()
+{
+	auto& cache = Instance();
+	std::lock_guard lock{ cache.m_mutex };
+	return cache.m_tables.size();
+}
+
+void CAgglomerationKernelCache::Clear()
+{
+	auto& cache = Instance();
+	std::lock_guard lock{ cache.m_mutex };
+	cache.m_tables.clear();
+	cache.m_memory = 0;
+}
+
+CAgglomerationKernelCache& CAgglomerationKernelCache::Instance()
+{
+	static CAgglomerationKernelCache instance;
+	return instance;
+}
+
+std::shared_ptr<const CAgglomerationKernelCache::table_t> CAgglomerationKernelCache::Insert(const CKey& _key, std::shared_ptr<const table_t> _table)
+{
+	// the same table may have been calculated in parallel
+	if (const auto it = m_tables.find(_key); it != m_tables.end())
+		return it->second;
+	m_tables[_key] = _table;
+	m_memory += Memory(*_table);
+	AppendFile(_key, *_table);
+	Shrink();
+	return _table;
+}
+
+void CAgglomerationKernelCache::Shrink()
+{
+	for (auto it = m_tables.begin(); it != m_tables.end() && m_memory > m_memoryLimit;)
+	{
+		// only tables not used by any solver can be removed
+		if (it->second.use_count() == 1)
+		{
+			m_memory -= Memory(*it->second);
+			it = m_tables.erase(it);
+		}
+		else
+			++it;
+	}
+}
+
+void CAgglomerationKernelCache::LoadFile()
+{
+	m_fileValid = false;
+	if (m_file.empty()) return;
+	std::error_code error;
+	const uint64_t fileSize = std::filesystem::file_size(m_file, error);
+	if (error || fileSize == 0) return;
+	std::ifstream file{ m_file, std::ios::binary };
+	if (!file) return;
+	const auto signature = Read<uint64_t>(file);
+	const auto version = Read<uint64_t>(file);
+	if (!file || signature != FILE_SIGNATURE || version != FILE_VERSION) return;
+	while (file.peek() != std::ifstream::traits_type::eof())
+	{
+		const auto rows = Read<uint64_t>(file);
+		const auto cols = Read<uint64_t>(file);
+		const auto keySize = Read<uint64_t>(file);
+		if (!file) return;
+		// sizes are checked against the rest of the file, so that damaged records do not cause huge allocations
+		const uint64_t left = fileSize - static_cast<uint64_t>(file.tellg());
+		if (keySize > left || (cols == 0 ? rows != 0 : rows > (left - keySize) / (cols * sizeof(double)))) return;
+		CKey key{ rows, cols };
+		std::string data(keySize, '\0');
+		file.read(data.data(), static_cast<std::streamsize>(keySize));
+		key.Add(data.data(), data.size());
+		auto table = std::make_shared<table_t>(rows, std::vector<double>(cols));
+		for (auto& row : *table)
+			file.read(reinterpret_cast<char*>(row.data()), static_cast<std::streamsize>(cols * sizeof(double)));
+		if (!file) return; // incomplete record
+		if (m_tables.find(key) == m_tables.end())
+		{
+			m_memory += Memory(*table);
+			m_tables[key] = std::move(table);
+		}
+	}
+	m_fileValid = true;
+	Shrink();
+}
+
+void CAgglomerationKernelCache::AppendFile(const CKey& _key, const table_t& _table)
+{
+	if (m_file.empty()) return;
+	if (m_fileValid)
+	{
+		std::ofstream file{ m_file, std::ios::binary | std::ios::app };
+		if (file)
+			WriteRecord(file, _key, _table);
+		return;
+	}
+	// a file with another format or damaged records is replaced with all currently cached tables
+	std::ofstream file{ m_file, std::ios::binary | std::ios::trunc };
+	if (!file) return;
+	Write(file, FILE_SIGNATURE);
+	Write(file, FILE_VERSION);
+	for (const auto& [key, table] : m_tables)
+		WriteRecord(file, key, *table);
+	m_fileValid = static_cast<bool>(file);
+}
+
+void CAgglomerationKernelCache::WriteRecord(std::ofstream& _file, const CKey& _key, const table_t& _table)
+{
+	Write(_file, _key.Rows());
+	Write(_file, _key.Cols());
+	Write(_file, static_cast<uint64_t>(_key.Data().size()));
+	_file.write(_key.Data().data(), static_cast<std::streamsize>(_key.Data().size()));
+	for (const auto& row : _table)
+		_file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size() * sizeof(double)));
+}
+
+size_t CAgglomerationKernelCache::Memory(const table_t& _table)
+{
+	return _table.empty() ? 0 : _table.size() * _table.front().size() * sizeof(double);
+}
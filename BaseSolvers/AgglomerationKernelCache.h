@@ -0,0 +1,139 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Process-wide cache of tabulated agglomeration kernels.
+ * \details Tables are addressed by their content description (kernel, parameters, volumes), so that all solvers with identical settings share one immutable table.
+ * Optionally, tables can be persisted in a file to be reused between runs.
+ */
+class CAgglomerationKernelCache
+{
+public:
+	using table_t = std::vector<std::vector<double>>; ///< Tabulated kernel.
+
+	/**
+	 * \brief Content-based key of a table.
+	 * \details The key keeps all added data and the shape of the table, so that different contents never share a table.
+	 */
+	class CKey
+	{
+		uint64_t m_rows{};		///< Number of rows in the table.
+		uint64_t m_cols{};		///< Number of columns in the table.
+		std::string m_data;		///< All added data.
+
+	public:
+		/**
+		 * \brief Constructs the key for a table of the given shape.
+		 * \param _rows Number of rows in the table.
+		 * \param _cols Number of columns in the table.
+		 */
+		CKey(uint64_t _rows, uint64_t _cols);
+		/**
+		 * \brief Adds raw data to the key.
+		 * \param _data Pointer to data.
+		 * \param _size Size of data in bytes.
+		 */
+		void Add(const void* _data, size_t _size);
+		/**
+		 * \brief Adds a value to the key.
+		 * \param _value Value.
+		 */
+		void Add(uint64_t _value);
+		/**
+		 * \brief Adds a vector of values to the key.
+		 * \param _values Values.
+		 */
+		void Add(const std::vector<double>& _values);
+		/**
+		 * \brief Returns the number of rows in the table.
+		 * \return Number of rows.
+		 */
+		[[nodiscard]] uint64_t Rows() const;
+		/**
+		 * \brief Returns the number of columns in the table.
+		 * \return Number of columns.
+		 */
+		[[nodiscard]] uint64_t Cols() const;
+		/**
+		 * \brief Returns all added data.
+		 * \return Data.
+		 */
+		[[nodiscard]] const std::string& Data() const;
+		/**
+		 * \brief Checks whether the table has the shape of the key.
+		 * \param _table Table.
+		 * \return Whether the shape matches.
+		 */
+		[[nodiscard]] bool Matches(const table_t& _table) const;
+
+		bool operator<(const CKey& _other) const;
+	};
+
+private:
+	std::map<CKey, std::shared_ptr<const table_t>> m_tables;		///< All cached tables.
+	std::filesystem::path m_file;									///< Path to the file for persistent storage.
+	bool m_fileValid{ false };										///< Whether the file has the current format and no damaged records, so new tables can be appended to it.
+	size_t m_memory{ 0 };											///< Memory currently occupied by all tables, [B].
+	size_t m_memoryLimit{ 512 * 1024 * 1024 };						///< Memory limit for all tables, [B].
+	mutable std::mutex m_mutex;										///< Mutex for thread-safe access.
+
+public:
+	/**
+	 * \brief Returns the table for the given key. If the table is not yet cached, calculates it with the given function and stores it.
+	 * \details A calculated table, which shape differs from the shape of the key, is returned without caching.
+	 * \param _key Content-based key of the table.
+	 * \param _calculate Function to calculate the table.
+	 * \return Shared immutable table.
+	 */
+	static std::shared_ptr<const table_t> Get(const CKey& _key, const std::function<table_t()>& _calculate);
+	/**
+	 * \brief Sets the file for persistent storage of tables. All tables from the file are loaded, and all new tables are appended to it.
+	 * \details Set an empty path to disable persistent storage.
+	 * \param _file Path to the file.
+	 */
+	static void SetPersistentFile(const std::filesystem::path& _file);
+	/**
+	 * \brief Sets memory limit for all cached tables. When exceeded, tables not used by any solver are removed.
+	 * \param _bytes Memory limit in bytes.
+	 */
+	static void SetMemoryLimit(size_t _bytes);
+	/**
+	 * \brief Returns the number of cached tables.
+	 * \return Number of tables.
+	 */
+	static size_t Size();
+	/**
+	 * \brief Removes all cached tables.
+	 */
+	static void Clear();
+
+private:
+	// Returns the single instance of the cache.
+	static CAgglomerationKernelCache& Instance();
+
+	// Adds the table to the cache. If a table with the same key is already there, returns the existing one.
+	std::shared_ptr<const table_t> Insert(const CKey& _key, std::shared_ptr<const table_t> _table);
+	// Removes unused tables until the memory limit is satisfied.
+	void Shrink();
+	// Loads all tables from the persistent file. Stops at the first record that does not fit the format.
+	void LoadFile();
+	// Appends the table to the persistent file. If the file is not valid, rewrites it with all cached tables.
+	void AppendFile(const CKey& _key, const table_t& _table);
+	// Writes one table to the file.
+	static void WriteRecord(std::ofstream& _file, const CKey& _key, const table_t& _table);
+
+	// Returns memory occupied by the table.
+	static size_t Memory(const table_t& _table);
+};
@@ -1,6 +1,8 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "AgglomerationSolver.h"
+#include "AgglomerationKernelCache.h"
+#include "ThreadPool.h"
 #include <cmath>
 
 CAgglomerationSolver::CAgglomerationSolver() : CBaseSolver()
@@ -20,6 +22,11 @@ void CAgglomerationSolver::Initialize(const d_vect_t& _grid, double _beta0, cons
 	Initialize();
 }
 
+void CAgglomerationSolver::SetKernelCacheFile(const std::filesystem::path& _file)
+{
+	CAgglomerationKernelCache::SetPersistentFile(_file);
+}
+
 void CAgglomerationSolver::Initialize()
 {
 }
@@ -66,6 +73,31 @@ double CAgglomerationSolver::Kernel(double _u, double _v) const
 	return {};
 }
 
+std::shared_ptr<const CAgglomerationSolver::d_matr_t> CAgglomerationSolver::TabulateKernel(const d_vect_t& _u, const d_vect_t& _v) const
+{
+	const auto Calculate = [&]
+	{
+		d_matr_t table(_u.size(), d_vect_t(_v.size()));
+		ParallelFor(_u.size(), [&](size_t i)
+		{
+			for (size_t j = 0; j < _v.size(); ++j)
+				table[i][j] = Kernel(_u[i], _v[j]);
+		});
+		return table;
+	};
+
+	// custom kernels cannot be identified by their content
+	if (m_kernel == EKernels::CUSTOM)
+		return std::make_shared<const d_matr_t>(Calculate());
+
+	CAgglomerationKernelCache::CKey key{ _u.size(), _v.size() };
+	key.Add(static_cast<uint64_t>(m_kernel));
+	key.Add(m_parameters);
+	key.Add(_u);
+	key.Add(_v);
+	return CAgglomerationKernelCache::Get(key, Calculate);
+}
+
 void CAgglomerationSolver::SetParameters(const d_vect_t& _grid, double _beta0, EKernels _kernel, const std::function<kernel_t>& _kernelFun, const d_vect_t& _parameters)
 {
 	m_grid        = _grid;
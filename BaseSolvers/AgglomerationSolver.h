@@ -4,7 +4,9 @@
 
 #pragma once
 #include "BaseSolver.h"
+#include <filesystem>
 #include <functional>
+#include <memory>
 
 /**
  * \brief Agglomeration solver.
@@ -86,6 +88,12 @@ public:
 	 * \param _parameters Additional parameters
 	 */
 	void Initialize(const d_vect_t& _grid, double _beta0, const std::function<kernel_t>& _kernel, const d_vect_t& _parameters = d_vect_t());
+	/**
+	 * \brief Sets the file to store tabulated kernels between runs.
+	 * \details The cache of tabulated kernels is a part of each solver library. The function is virtual, so that the call configures the cache of the library the solver was created in.
+	 * \param _file Path to the file. An empty path disables persistent storage.
+	 */
+	virtual void SetKernelCacheFile(const std::filesystem::path& _file);
 
 	/**
 	 * \brief Actual initialization of the solver.
@@ -110,6 +118,11 @@ protected:
 	 * Calculates the chosen kernel function for particles with volumes _u and _v.
 	 */
 	[[nodiscard]] double Kernel(double _u, double _v) const;
+	/**
+	 * Returns the chosen kernel function tabulated for all pairs of volumes: table[i][j] = Kernel(_u[i], _v[j]).
+	 * The table is shared between all solvers with the same kernel, parameters and volumes.
+	 */
+	[[nodiscard]] std::shared_ptr<const d_matr_t> TabulateKernel(const d_vect_t& _u, const d_vect_t& _v) const;
 
 private:
 	/**
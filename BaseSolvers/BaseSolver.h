@@ -26,14 +26,16 @@ enum class ESolverTypes : uint32_t
 	SOLVER_NONE            = 0,	///< Undefined.
 	SOLVER_AGGLOMERATION_1 = 1,	///< Agglomeration solver.
 	SOLVER_PBM_1           = 2, ///< Population balance solver.
+	SOLVER_AGGLOMERATION_2 = 3, ///< Two-dimensional agglomeration solver.
 };
 
 #define CREATE_SOLVER_FUNCTION_BASE CreateDYSSOLSolverV4
-#define SOLVERS_TYPES_NUMBER 2
-#define SOLVERS_TYPE_NAMES { "Undefined", "Agglomeration", "PBM" }
+#define SOLVERS_TYPES_NUMBER 3
+#define SOLVERS_TYPE_NAMES { "Undefined", "Agglomeration", "PBM", "Agglomeration 2D" }
 #define CREATE_SOLVER_FUN_AGG1	CREATE_SOLVER_FUN(1)
 #define CREATE_SOLVER_FUN_PBM1	CREATE_SOLVER_FUN(2)
-#define CREATE_SOLVER_FUN_NAMES { CREATE_SOLVER_FUN_NAME(0), CREATE_SOLVER_FUN_NAME(1), CREATE_SOLVER_FUN_NAME(2) }
+#define CREATE_SOLVER_FUN_AGG2	CREATE_SOLVER_FUN(3)
+#define CREATE_SOLVER_FUN_NAMES { CREATE_SOLVER_FUN_NAME(0), CREATE_SOLVER_FUN_NAME(1), CREATE_SOLVER_FUN_NAME(2), CREATE_SOLVER_FUN_NAME(3) }
 #ifdef _DEBUG
 #define CREATE_SOLVER_FUNCTION_CONF MACRO_CONCAT(CREATE_SOLVER_FUNCTION_BASE, _DEBUG)
 #else
@@ -48,7 +50,7 @@ enum class ESolverTypes : uint32_t
 class CBaseSolver
 {
 protected:
-	ESolverTypes m_type{ ESolverTypes::SOLVER_NONE };	///< Type of the solver (SOLVER_AGGLOMERATION_1/SOLVER_PBM_1/...).
+	ESolverTypes m_type{ ESolverTypes::SOLVER_NONE };	///< Type of the solver (SOLVER_AGGLOMERATION_1/SOLVER_PBM_1/SOLVER_AGGLOMERATION_2/...).
 	std::string m_name{};								///< User-friendly name of the solver.
 	std::string m_authorName{};							///< Name of solver's author.
 	std::string m_uniqueID{};							///< Unique identifier of the solver.
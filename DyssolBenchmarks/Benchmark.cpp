@@ -0,0 +1,179 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <set>
+
+namespace
+{
+	// Calls the function the given number of times and returns the elapsed time in ns.
+	double Measure(const std::function<void()>& _fun, size_t _iterations)
+	{
+		const auto tBeg = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < _iterations; ++i)
+			_fun();
+		const auto tEnd = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(tEnd - tBeg).count();
+	}
+
+	// Returns a string representation of the parameters in the form "name1=value1 name2=value2".
+	std::string ParamsString(const benchmark_params_t& _params)
+	{
+		std::string res;
+		for (const auto& [name, value] : _params)
+			res += (res.empty() ? "" : " ") + name + "=" + std::to_string(value);
+		return res;
+	}
+
+	// Escapes a string to be written into JSON.
+	std::string EscapeJSON(const std::string& _s)
+	{
+		std::string res;
+		for (const char c : _s)
+		{
+			if (c == '"' || c == '\\')
+				res += '\\';
+			res += c;
+		}
+		return res;
+	}
+}
+
+void CBenchmarkRunner::SetMinTime(double _time)
+{
+	m_minTime = _time;
+}
+
+void CBenchmarkRunner::SetRepetitions(size_t _number)
+{
+	m_repetitions = std::max<size_t>(_number, 1);
+}
+
+void CBenchmarkRunner::SetFilter(const std::string& _filter)
+{
+	m_filter = _filter;
+}
+
+bool CBenchmarkRunner::IsSelected(const std::string& _name) const
+{
+	return m_filter.empty() || _name.find(m_filter) != std::string::npos;
+}
+
+bool CBenchmarkRunner::IsAnySelected(const std::vector<std::string>& _names) const
+{
+	return std::any_of(_names.begin(), _names.end(), [&](const auto& _name) { return IsSelected(_name); });
+}
+
+void CBenchmarkRunner::Run(const std::string& _name, const benchmark_params_t& _params, const std::function<void()>& _fun)
+{
+	if (!IsSelected(_name)) return;
+
+	// warm-up and calibration: increase the number of iterations until a repetition lasts long enough
+	const double minTime = m_minTime * 1e9;
+	size_t iterations = 1;
+	double time = Measure(_fun, iterations);
+	while (time < minTime && iterations < static_cast<size_t>(1) << 40)
+	{
+		const double factor = time > 0 ? std::clamp(1.2 * minTime / time, 2., 100.) : 100.;
+		iterations = static_cast<size_t>(std::ceil(static_cast<double>(iterations) * factor));
+		time = Measure(_fun, iterations);
+	}
+
+	// measurement
+	std::vector<double> times(m_repetitions);
+	for (auto& t : times)
+		t = Measure(_fun, iterations) / static_cast<double>(iterations);
+
+	SBenchmarkResult res;
+	res.name = _name;
+	res.params = _params;
+	res.iterations = iterations;
+	res.repetitions = m_repetitions;
+	res.mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(times.size());
+	res.min = *std::min_element(times.begin(), times.end());
+	res.max = *std::max_element(times.begin(), times.end());
+	double sum2 = 0.0;
+	for (const double t : times)
+		sum2 += (t - res.mean) * (t - res.mean);
+	res.stddev = times.size() > 1 ? std::sqrt(sum2 / static_cast<double>(times.size() - 1)) : 0.0;
+
+	Print(res);
+	m_results.push_back(std::move(res));
+}
+
+const std::vector<SBenchmarkResult>& CBenchmarkRunner::GetResults() const
+{
+	return m_results;
+}
+
+bool CBenchmarkRunner::Write(const std::filesystem::path& _file) const
+{
+	std::ofstream file{ _file };
+	if (!file) return false;
+	file << std::setprecision(std::numeric_limits<double>::max_digits10);
+	if (_file.extension() == ".json")
+		WriteJSON(file);
+	else
+		WriteCSV(file);
+	return file.good();
+}
+
+void CBenchmarkRunner::WriteJSON(std::ostream& _s) const
+{
+	_s << "{\"benchmarks\":[";
+	for (size_t i = 0; i < m_results.size(); ++i)
+	{
+		const auto& r = m_results[i];
+		_s << (i == 0 ? "\n" : ",\n");
+		_s << "{\"name\":\"" << EscapeJSON(r.name) << "\",\"params\":{";
+		for (size_t j = 0; j < r.params.size(); ++j)
+			_s << (j == 0 ? "" : ",") << "\"" << EscapeJSON(r.params[j].first) << "\":" << r.params[j].second;
+		_s << "},\"iterations\":" << r.iterations << ",\"repetitions\":" << r.repetitions
+			<< ",\"mean_ns\":" << r.mean << ",\"min_ns\":" << r.min << ",\"max_ns\":" << r.max << ",\"stddev_ns\":" << r.stddev << "}";
+	}
+	_s << "\n]}" << std::endl;
+}
+
+void CBenchmarkRunner::WriteCSV(std::ostream& _s) const
+{
+	// union of all parameters' names in order of appearance
+	std::vector<std::string> names;
+	std::set<std::string> known;
+	for (const auto& r : m_results)
+		for (const auto& [name, value] : r.params)
+			if (known.insert(name).second)
+				names.push_back(name);
+
+	_s << "name";
+	for (const auto& name : names)
+		_s << "," << name;
+	_s << ",iterations,repetitions,mean_ns,min_ns,max_ns,stddev_ns" << std::endl;
+	for (const auto& r : m_results)
+	{
+		_s << r.name;
+		for (const auto& name : names)
+		{
+			_s << ",";
+			const auto it = std::find_if(r.params.begin(), r.params.end(), [&](const auto& _p) { return _p.first == name; });
+			if (it != r.params.end())
+				_s << it->second;
+		}
+		_s << "," << r.iterations << "," << r.repetitions << "," << r.mean << "," << r.min << "," << r.max << "," << r.stddev << std::endl;
+	}
+}
+
+void CBenchmarkRunner::Print(const SBenchmarkResult& _result)
+{
+	std::cout << std::left << std::setw(40) << _result.name << std::setw(40) << ParamsString(_result.params) << std::right
+		<< std::fixed << std::setprecision(1) << std::setw(16) << _result.mean << " ns"
+		<< " +- " << std::setw(5) << (_result.mean > 0 ? 100 * _result.stddev / _result.mean : 0) << " %"
+		<< std::setw(14) << _result.iterations << " it" << std::defaultfloat << std::endl;
+}
@@ -0,0 +1,95 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Parameters of a benchmark case, e.g. { "classes", 100 }.
+using benchmark_params_t = std::vector<std::pair<std::string, size_t>>;
+
+// Measured timings of one benchmark case.
+struct SBenchmarkResult
+{
+	std::string name;				// Name of the benchmark, e.g. "MDMatrix/GetValue".
+	benchmark_params_t params;		// Swept parameters of the case.
+	size_t iterations{};			// Number of iterations in each repetition.
+	size_t repetitions{};			// Number of measured repetitions.
+	double mean{};					// Mean time of one iteration over all repetitions in ns.
+	double min{};					// Minimum time of one iteration over all repetitions in ns.
+	double max{};					// Maximum time of one iteration over all repetitions in ns.
+	double stddev{};				// Standard deviation of the time of one iteration between repetitions in ns.
+};
+
+// Ranges of parameters swept by the benchmarks.
+struct SBenchmarkSweep
+{
+	std::vector<size_t> classes{ 10, 100, 1000 };			// Numbers of classes in each distributed dimension.
+	std::vector<size_t> dimensions{ 1, 2, 3 };				// Numbers of distributed dimensions.
+	std::vector<size_t> timePoints{ 1, 10, 100, 1000 };		// Numbers of time points.
+	std::vector<size_t> compounds{ 1, 3, 10 };				// Numbers of compounds.
+	std::vector<size_t> tasks{ 1, 16, 256, 4096, 65536 };	// Numbers of parallel tasks.
+	size_t maxCells{ 1'000'000 };							// Maximum number of cells in a multidimensional distribution.
+	size_t maxValues{ 10'000'000 };							// Maximum number of values in all time points of a multidimensional distribution.
+};
+
+/*
+ * Runs micro-benchmarks and collects their timings.
+ * The number of iterations of each case is calibrated so that one repetition lasts at least the given minimum time.
+ */
+class CBenchmarkRunner
+{
+	double m_minTime{ 0.1 };					// Minimum duration of one repetition in s.
+	size_t m_repetitions{ 5 };					// Number of measured repetitions.
+	std::string m_filter;						// Only benchmarks, which names contain this string, are executed.
+	std::vector<SBenchmarkResult> m_results;	// Results of all executed benchmarks.
+
+public:
+	// Sets the minimum duration of one repetition in s.
+	void SetMinTime(double _time);
+	// Sets the number of measured repetitions.
+	void SetRepetitions(size_t _number);
+	// Sets a filter, so that only benchmarks, which names contain it, are executed.
+	void SetFilter(const std::string& _filter);
+
+	// Returns whether the benchmark with the given name must be executed.
+	[[nodiscard]] bool IsSelected(const std::string& _name) const;
+	// Returns whether any of the benchmarks with the given names must be executed. Allows to skip expensive preparations.
+	[[nodiscard]] bool IsAnySelected(const std::vector<std::string>& _names) const;
+
+	// Measures the function and prints the result. The function performs one iteration of the benchmark.
+	void Run(const std::string& _name, const benchmark_params_t& _params, const std::function<void()>& _fun);
+
+	// Returns results of all executed benchmarks.
+	[[nodiscard]] const std::vector<SBenchmarkResult>& GetResults() const;
+	// Writes results of all executed benchmarks into a JSON file, if the file extension is .json, or into a CSV file otherwise. Returns success flag.
+	[[nodiscard]] bool Write(const std::filesystem::path& _file) const;
+
+private:
+	// Writes results into a JSON file.
+	void WriteJSON(std::ostream& _s) const;
+	// Writes results into a CSV file with one column per parameter.
+	void WriteCSV(std::ostream& _s) const;
+	// Prints the result to the console.
+	static void Print(const SBenchmarkResult& _result);
+};
+
+// Sinks for values of benchmarked calculations. Writing to volatile variables prevents the compiler from optimizing the calculations away.
+inline const volatile void* g_benchmarkSinkPtr{ nullptr };
+inline volatile double g_benchmarkSinkValue{ 0.0 };
+
+// Prevents the compiler from optimizing away the calculation of the value.
+template<typename T>
+void KeepValue(const T& _value)
+{
+	g_benchmarkSinkPtr = &_value;
+}
+
+// Prevents the compiler from optimizing away the calculation of the value.
+inline void KeepValue(double _value)
+{
+	g_benchmarkSinkValue = _value;
+}
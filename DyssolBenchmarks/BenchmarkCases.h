@@ -0,0 +1,21 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include "Benchmark.h"
+
+class CMaterialsDatabase;
+class CModelsManager;
+
+// Benchmarks get/set of values, distributions, transformation and copying of CMDMatrix.
+void BenchmarkMDMatrix(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep);
+// Benchmarks interpolation in CTimeDependentValue.
+void BenchmarkTimeDependentValue(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep);
+// Benchmarks mixing, copying and calculation of PSD in CBaseStream.
+void BenchmarkStream(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, const CMaterialsDatabase& _materialsDB);
+// Benchmarks queries of CMixtureEnthalpyLookup.
+void BenchmarkEnthalpyLookup(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, const CMaterialsDatabase& _materialsDB);
+// Benchmarks initialization and calculation of all available agglomeration solvers.
+void BenchmarkAgglomeration(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, CModelsManager& _modelsManager);
+// Benchmarks the overhead of ParallelFor.
+void BenchmarkThreadPool(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep);
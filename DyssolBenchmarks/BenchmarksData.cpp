@@ -0,0 +1,200 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BenchmarkCases.h"
+#include "MDMatrix.h"
+#include "TimeDependentValue.h"
+#include "TransformMatrix.h"
+#include <cmath>
+#include <random>
+
+namespace
+{
+	// Types of distributed dimensions used in benchmarks.
+	const std::vector<unsigned> DIMENSION_TYPES{ DISTR_SIZE, DISTR_PART_POROSITY, DISTR_FORM_FACTOR };
+
+	// Returns the number of cells in a distribution with the given number of dimensions and classes, limited by _max + 1 to avoid overflow.
+	size_t CellsNumber(size_t _dimensions, size_t _classes, size_t _max)
+	{
+		size_t res = 1;
+		for (size_t i = 0; i < _dimensions && res <= _max; ++i)
+			res *= _classes;
+		return res;
+	}
+
+	// Creates a matrix with the given number of dimensions, classes and time points, filled with uniform distributions.
+	CMDMatrix CreateMatrix(size_t _dimensions, size_t _classes, size_t _timePoints)
+	{
+		const std::vector<unsigned> types(DIMENSION_TYPES.begin(), DIMENSION_TYPES.begin() + _dimensions);
+		const std::vector<unsigned> classes(_dimensions, static_cast<unsigned>(_classes));
+		CMDMatrix matrix;
+		matrix.SetDimensions(types, classes);
+		CDenseMDMatrix distr(types, classes);
+		std::fill_n(distr.GetDataPtr(), distr.GetDataLength(), 1. / static_cast<double>(distr.GetDataLength()));
+		for (size_t i = 0; i < _timePoints; ++i)
+		{
+			matrix.AddTimePoint(static_cast<double>(i));
+			matrix.SetDistribution(static_cast<double>(i), distr);
+		}
+		return matrix;
+	}
+
+	// Returns a set of random coordinates within the matrix.
+	std::vector<std::vector<unsigned>> RandomCoordinates(size_t _dimensions, size_t _classes, size_t _number)
+	{
+		std::mt19937 gen{ 42 };
+		std::uniform_int_distribution<unsigned> distr(0, static_cast<unsigned>(_classes - 1));
+		std::vector<std::vector<unsigned>> res(_number, std::vector<unsigned>(_dimensions));
+		for (auto& coords : res)
+			for (auto& c : coords)
+				c = distr(gen);
+		return res;
+	}
+
+	// Returns a set of random time points within the range [0, _timePoints).
+	std::vector<double> RandomTimes(size_t _timePoints, size_t _number, bool _exact)
+	{
+		std::mt19937 gen{ 42 };
+		std::uniform_real_distribution<double> distr(0., static_cast<double>(_timePoints - 1));
+		std::vector<double> res(_number);
+		for (auto& t : res)
+			t = _exact ? std::floor(distr(gen)) : distr(gen);
+		return res;
+	}
+}
+
+void BenchmarkMDMatrix(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep)
+{
+	if (!_runner.IsAnySelected({ "MDMatrix/GetValue", "MDMatrix/GetValueInterpolated", "MDMatrix/SetValue", "MDMatrix/GetVectorValue", "MDMatrix/GetDistribution", "MDMatrix/SetDistribution", "MDMatrix/Transform", "MDMatrix/CopyFrom", "MDMatrix/CopyConstruct" })) return;
+
+	constexpr size_t samples = 1024; // number of precalculated random queries
+	for (const size_t dims : _sweep.dimensions)
+	{
+		if (dims == 0 || dims > DIMENSION_TYPES.size()) continue;
+		for (const size_t classes : _sweep.classes)
+		{
+			const size_t cells = CellsNumber(dims, classes, _sweep.maxCells);
+			if (cells > _sweep.maxCells) continue;
+			for (const size_t tp : _sweep.timePoints)
+			{
+				if (tp == 0 || cells * tp > _sweep.maxValues) continue;
+				const benchmark_params_t params{ { "dimensions", dims }, { "classes", classes }, { "time_points", tp } };
+
+				CMDMatrix matrix = CreateMatrix(dims, classes, tp);
+				const auto coords = RandomCoordinates(dims, classes, samples);
+				const auto times = RandomTimes(tp, samples, true);
+				const auto timesInterp = RandomTimes(tp, samples, false);
+				size_t i = 0;
+
+				_runner.Run("MDMatrix/GetValue", params, [&]
+				{
+					KeepValue(matrix.GetValue(times[i % samples], coords[i % samples]));
+					++i;
+				});
+				_runner.Run("MDMatrix/GetValueInterpolated", params, [&]
+				{
+					KeepValue(matrix.GetValue(timesInterp[i % samples], coords[i % samples]));
+					++i;
+				});
+				_runner.Run("MDMatrix/SetValue", params, [&]
+				{
+					matrix.SetValue(times[i % samples], coords[i % samples], 0.5 / static_cast<double>(cells), false);
+					++i;
+				});
+
+				std::vector<double> vector;
+				_runner.Run("MDMatrix/GetVectorValue", params, [&]
+				{
+					matrix.GetVectorValue(times[i % samples], DISTR_SIZE, vector);
+					KeepValue(vector);
+					++i;
+				});
+
+				CDenseMDMatrix distr;
+				_runner.Run("MDMatrix/GetDistribution", params, [&]
+				{
+					matrix.GetDistribution(times[i % samples], distr);
+					KeepValue(distr);
+					++i;
+				});
+				_runner.Run("MDMatrix/SetDistribution", params, [&]
+				{
+					matrix.SetDistribution(times[i % samples], distr);
+					++i;
+				});
+
+				// transformation of the size dimension: a fraction of each class moves to the next one
+				if (classes * classes <= _sweep.maxCells)
+				{
+					CTransformMatrix transform(DISTR_SIZE, static_cast<unsigned>(classes));
+					for (unsigned j = 0; j < classes; ++j)
+					{
+						transform.SetValue(j, j, j + 1 < classes ? 0.9 : 1.0);
+						if (j + 1 < classes)
+							transform.SetValue(j, j + 1, 0.1);
+					}
+					_runner.Run("MDMatrix/Transform", params, [&]
+					{
+						matrix.Transform(times[i % samples], transform);
+						++i;
+					});
+				}
+
+				CMDMatrix copy;
+				copy.SetDimensions(matrix.GetDimensions(), matrix.GetClasses());
+				_runner.Run("MDMatrix/CopyFrom", params, [&]
+				{
+					copy.CopyFrom(matrix, 0., static_cast<double>(tp - 1));
+				});
+				_runner.Run("MDMatrix/CopyConstruct", params, [&]
+				{
+					const CMDMatrix tmp{ matrix };
+					KeepValue(tmp);
+				});
+			}
+		}
+	}
+}
+
+void BenchmarkTimeDependentValue(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep)
+{
+	if (!_runner.IsAnySelected({ "TimeDependentValue/GetValue", "TimeDependentValue/GetValueInterpolated", "TimeDependentValue/GetValueExtrapolated", "TimeDependentValue/SetValue", "TimeDependentValue/AppendTimePoint" })) return;
+
+	constexpr size_t samples = 1024; // number of precalculated random queries
+	for (const size_t tp : _sweep.timePoints)
+	{
+		if (tp == 0) continue;
+		const benchmark_params_t params{ { "time_points", tp } };
+
+		CTimeDependentValue value;
+		for (size_t i = 0; i < tp; ++i)
+			value.SetValue(static_cast<double>(i), std::sin(static_cast<double>(i)));
+		const auto times = RandomTimes(tp, samples, true);
+		const auto timesInterp = RandomTimes(tp, samples, false);
+		size_t i = 0;
+
+		_runner.Run("TimeDependentValue/GetValue", params, [&]
+		{
+			KeepValue(value.GetValue(times[i++ % samples]));
+		});
+		_runner.Run("TimeDependentValue/GetValueInterpolated", params, [&]
+		{
+			KeepValue(value.GetValue(timesInterp[i++ % samples]));
+		});
+		_runner.Run("TimeDependentValue/GetValueExtrapolated", params, [&]
+		{
+			KeepValue(value.GetValue(static_cast<double>(tp + i++ % samples)));
+		});
+		_runner.Run("TimeDependentValue/SetValue", params, [&]
+		{
+			value.SetValue(times[i++ % samples], 1.0);
+		});
+		_runner.Run("TimeDependentValue/AppendTimePoint", params, [&]
+		{
+			// append a new time point after the last one and remove it again
+			const double t = static_cast<double>(tp) + 0.5;
+			value.SetValue(t, 1.0);
+			value.RemoveTimePoint(t);
+		});
+	}
+}
@@ -0,0 +1,61 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BenchmarkCases.h"
+#include "AgglomerationSolver.h"
+#include "ModelsManager.h"
+#include "DyssolUtilities.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+void BenchmarkAgglomeration(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, CModelsManager& _modelsManager)
+{
+	bool found = false;
+	for (const auto& descriptor : _modelsManager.GetAvailableSolvers())
+	{
+		if (descriptor.solverType != ESolverTypes::SOLVER_AGGLOMERATION_1) continue;
+		found = true;
+		std::string name = descriptor.name;
+		name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+		const std::string prefix = "Agglomeration/" + name + "/";
+		if (!_runner.IsAnySelected({ prefix + "Initialize", prefix + "Calculate" })) continue;
+
+		for (const size_t classes : _sweep.classes)
+		{
+			const benchmark_params_t params{ { "classes", classes } };
+			auto* solver = dynamic_cast<CAgglomerationSolver*>(_modelsManager.InstantiateSolver(descriptor.uniqueID));
+			if (!solver)
+			{
+				std::cout << "Cannot instantiate agglomeration solver " << descriptor.name << std::endl;
+				break;
+			}
+
+			const std::vector<double> grid = CreateGridGeometricInc(classes, 1e-6, 1e-3);
+			// number density distribution with a single peak
+			std::vector<double> n(classes);
+			for (size_t i = 0; i < classes; ++i)
+			{
+				const double x = (static_cast<double>(i) - static_cast<double>(classes) / 3) / (static_cast<double>(classes) / 10);
+				n[i] = 1e10 * std::exp(-x * x / 2);
+			}
+			std::vector<double> rateB, rateD;
+
+			// kernels are tabulated once and then reused by all solvers with the same settings, so repeated initialization measures the rest
+			_runner.Run(prefix + "Initialize", params, [&]
+			{
+				solver->Initialize(grid, 1.0, CAgglomerationSolver::EKernels::BROWNIAN, { 3 });
+			});
+			_runner.Run(prefix + "Calculate", params, [&]
+			{
+				solver->Calculate(n, rateB, rateD);
+				KeepValue(rateB);
+			});
+
+			solver->Finalize();
+			_modelsManager.FreeSolver(solver);
+		}
+	}
+	if (!found)
+		std::cout << "No agglomeration solvers found. Use --models_path to specify the directory with solvers." << std::endl;
+}
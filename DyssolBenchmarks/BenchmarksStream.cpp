@@ -0,0 +1,175 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BenchmarkCases.h"
+#include "Flowsheet.h"
+#include "MaterialsDatabase.h"
+#include "MixtureEnthalpyLookup.h"
+#include "ModelsManager.h"
+#include "Stream.h"
+#include "DyssolUtilities.h"
+#include <cmath>
+#include <random>
+
+namespace
+{
+	// Fills the stream with data at the given number of time points.
+	void FillStream(CBaseStream& _stream, size_t _timePoints, size_t _classes, double _mass)
+	{
+		const auto compounds = _stream.GetAllCompounds();
+		std::vector<double> psd(_classes);
+		for (size_t i = 0; i < _timePoints; ++i)
+		{
+			const double t = static_cast<double>(i);
+			_stream.AddTimePoint(t);
+			_stream.SetMass(t, _mass);
+			_stream.SetTemperature(t, 300 + 10 * std::sin(t));
+			_stream.SetPressure(t, STANDARD_CONDITION_P);
+			_stream.SetPhaseFraction(t, EPhase::SOLID, 0.7);
+			_stream.SetPhaseFraction(t, EPhase::LIQUID, 0.3);
+			for (const auto& c : compounds)
+			{
+				_stream.SetCompoundFraction(t, c, EPhase::SOLID, 1. / static_cast<double>(compounds.size()));
+				_stream.SetCompoundFraction(t, c, EPhase::LIQUID, 1. / static_cast<double>(compounds.size()));
+			}
+			// log-normal-like mass fractions, shifted with time
+			double sum = 0;
+			for (size_t j = 0; j < _classes; ++j)
+			{
+				const double x = (static_cast<double>(j) - static_cast<double>(_classes) / 2 - std::sin(t)) / (static_cast<double>(_classes) / 6);
+				psd[j] = std::exp(-x * x / 2);
+				sum += psd[j];
+			}
+			for (auto& v : psd)
+				v /= sum;
+			_stream.SetPSD(t, PSD_MassFrac, psd);
+		}
+	}
+}
+
+void BenchmarkStream(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, const CMaterialsDatabase& _materialsDB)
+{
+	if (!_runner.IsAnySelected({ "Stream/Copy", "Stream/CopyTimePoint", "Stream/Add", "Stream/AddTimePoint", "Stream/GetPSD_q3", "Stream/GetPSD_MassFrac", "Stream/GetPSDInterpolated" })) return;
+
+	const auto keys = _materialsDB.GetCompoundsKeys();
+	for (const size_t nCompounds : _sweep.compounds)
+	{
+		if (nCompounds == 0 || nCompounds > keys.size()) continue;
+		for (const size_t classes : _sweep.classes)
+		{
+			for (const size_t tp : _sweep.timePoints)
+			{
+				if (tp == 0 || nCompounds * classes * tp > _sweep.maxValues) continue;
+				const benchmark_params_t params{ { "compounds", nCompounds }, { "classes", classes }, { "time_points", tp } };
+
+				CModelsManager modelsManager;
+				CFlowsheet flowsheet{ &modelsManager, &_materialsDB };
+				flowsheet.Create();
+				flowsheet.SetCompounds(std::vector<std::string>(keys.begin(), keys.begin() + nCompounds));
+				flowsheet.AddPhase(EPhase::SOLID, "Solid");
+				flowsheet.AddPhase(EPhase::LIQUID, "Liquid");
+				CMultidimensionalGrid grid = flowsheet.GetGrid();
+				grid.AddNumericDimension(DISTR_SIZE, CreateGridGeometricInc(classes, 1e-6, 1e-2));
+				flowsheet.SetMainGrid(grid);
+
+				CStream* src = flowsheet.AddStream("src");
+				CStream* dst = flowsheet.AddStream("dst");
+				FillStream(*src, tp, classes, 1.0);
+				FillStream(*dst, tp, classes, 2.0);
+				const double tEnd = static_cast<double>(tp - 1);
+				size_t i = 0;
+
+				_runner.Run("Stream/Copy", params, [&]
+				{
+					dst->Copy(0., tEnd, *src);
+				});
+				_runner.Run("Stream/CopyTimePoint", params, [&]
+				{
+					const double t = static_cast<double>(i++ % tp);
+					dst->Copy(t, *src, t);
+				});
+				// the mass of the destination stream grows linearly with the number of iterations
+				_runner.Run("Stream/Add", params, [&]
+				{
+					dst->Add(0., tEnd, *src);
+				});
+				_runner.Run("Stream/AddTimePoint", params, [&]
+				{
+					dst->Add(static_cast<double>(i++ % tp), *src);
+				});
+				_runner.Run("Stream/GetPSD_q3", params, [&]
+				{
+					KeepValue(src->GetPSD(static_cast<double>(i++ % tp), PSD_q3));
+				});
+				_runner.Run("Stream/GetPSD_MassFrac", params, [&]
+				{
+					KeepValue(src->GetPSD(static_cast<double>(i++ % tp), PSD_MassFrac));
+				});
+				_runner.Run("Stream/GetPSDInterpolated", params, [&]
+				{
+					KeepValue(src->GetPSD(static_cast<double>(i++ % tp) + 0.5, PSD_MassFrac));
+				});
+			}
+		}
+	}
+}
+
+void BenchmarkEnthalpyLookup(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep, const CMaterialsDatabase& _materialsDB)
+{
+	if (!_runner.IsAnySelected({ "EnthalpyLookup/GetEnthalpy", "EnthalpyLookup/GetTemperature", "EnthalpyLookup/GetEnthalpyFractions", "EnthalpyLookup/GetTemperatureFractions", "EnthalpyLookup/Construct" })) return;
+
+	constexpr size_t samples = 1024; // number of precalculated random queries
+	const auto keys = _materialsDB.GetCompoundsKeys();
+	for (const size_t nCompounds : _sweep.compounds)
+	{
+		if (nCompounds == 0 || nCompounds > keys.size()) continue;
+		const benchmark_params_t params{ { "compounds", nCompounds } };
+		const std::vector<std::string> compounds(keys.begin(), keys.begin() + nCompounds);
+		const std::vector<double> fractions(nCompounds, 1. / static_cast<double>(nCompounds));
+
+		CMixtureEnthalpyLookup lookup{ &_materialsDB, compounds };
+		lookup.SetCompoundFractions(fractions);
+		const SInterval limits{ DEFAULT_ENTHALPY_MIN_T, DEFAULT_ENTHALPY_MAX_T };
+
+		// random temperatures within the limits, corresponding enthalpies and random compositions
+		std::mt19937 gen{ 42 };
+		std::uniform_real_distribution<double> distrT(limits.min, limits.max);
+		std::uniform_real_distribution<double> distrW(0., 1.);
+		std::vector<double> temperatures(samples);
+		std::vector<double> enthalpies(samples);
+		std::vector<std::vector<double>> randomFractions(samples, std::vector<double>(nCompounds));
+		for (size_t j = 0; j < samples; ++j)
+		{
+			temperatures[j] = distrT(gen);
+			enthalpies[j] = lookup.GetEnthalpy(temperatures[j]);
+			for (auto& w : randomFractions[j])
+				w = distrW(gen);
+			Normalize(randomFractions[j]);
+		}
+		size_t i = 0;
+
+		_runner.Run("EnthalpyLookup/GetEnthalpy", params, [&]
+		{
+			KeepValue(lookup.GetEnthalpy(temperatures[i++ % samples]));
+		});
+		_runner.Run("EnthalpyLookup/GetTemperature", params, [&]
+		{
+			KeepValue(lookup.GetTemperature(enthalpies[i++ % samples]));
+		});
+		_runner.Run("EnthalpyLookup/GetEnthalpyFractions", params, [&]
+		{
+			KeepValue(lookup.GetEnthalpy(temperatures[i % samples], randomFractions[i % samples]));
+			++i;
+		});
+		_runner.Run("EnthalpyLookup/GetTemperatureFractions", params, [&]
+		{
+			KeepValue(lookup.GetTemperature(enthalpies[i % samples], randomFractions[i % samples]));
+			++i;
+		});
+		_runner.Run("EnthalpyLookup/Construct", params, [&]
+		{
+			const CMixtureEnthalpyLookup tmp{ &_materialsDB, compounds };
+			KeepValue(tmp);
+		});
+	}
+}
@@ -0,0 +1,53 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "BenchmarkCases.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <cmath>
+
+void BenchmarkThreadPool(CBenchmarkRunner& _runner, const SBenchmarkSweep& _sweep)
+{
+	if (!_runner.IsAnySelected({ "ThreadPool/ParallelForEmpty", "ThreadPool/ParallelForSmall", "ThreadPool/SequentialForSmall" })) return;
+
+	InitializeThreadPool();
+	for (const size_t tasks : _sweep.tasks)
+	{
+		const benchmark_params_t params{ { "tasks", tasks }, { "threads", getThreadPool().GetThreadsNumber() } };
+
+		// empty tasks: pure overhead of distribution and synchronization
+		std::atomic<size_t> counter{ 0 };
+		_runner.Run("ThreadPool/ParallelForEmpty", params, [&]
+		{
+			ParallelFor(tasks, [&](size_t)
+			{
+				counter.fetch_add(1, std::memory_order_relaxed);
+			});
+		});
+
+		// small tasks of about 1 us each
+		std::vector<double> results(tasks);
+		_runner.Run("ThreadPool/ParallelForSmall", params, [&]
+		{
+			ParallelFor(tasks, [&](size_t _i)
+			{
+				double sum = 0;
+				for (size_t j = 1; j <= 256; ++j)
+					sum += std::sqrt(static_cast<double>(_i + j));
+				results[_i] = sum;
+			});
+			KeepValue(results);
+		});
+		_runner.Run("ThreadPool/SequentialForSmall", params, [&]
+		{
+			for (size_t i = 0; i < tasks; ++i)
+			{
+				double sum = 0;
+				for (size_t j = 1; j <= 256; ++j)
+					sum += std::sqrt(static_cast<double>(i + j));
+				results[i] = sum;
+			}
+			KeepValue(results);
+		});
+	}
+}
@@ -0,0 +1,101 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "ArgumentsParser.h"
+#include "BenchmarkCases.h"
+#include "MaterialsDatabase.h"
+#include "ModelsManager.h"
+#include <iostream>
+
+// Prints information about command line arguments.
+void PrintArgumentsInfo(const CArgumentsParser& _parser)
+{
+	std::cout << "Usage: DyssolBenchmarks [--key[=value]] [...]" << std::endl;
+	for (const auto& k : _parser.AllAllowedKeys())
+	{
+		for (const auto& s : k.keysS)
+			std::cout << "-" << s << " ";
+		std::cout << '\t';
+		for (const auto& l : k.keysL)
+			std::cout << "--" << l << " ";
+		std::cout << k.description << std::endl;
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	try
+	{
+		// possible keys with aliases and descriptions
+		const std::vector<CArgumentsParser::SKey> keys{
+			{ { "filter"      }, { "f"  }, { "run only benchmarks which names contain this string"                 } },
+			{ { "output"      }, { "o"  }, { "file to write results to: JSON if the extension is .json, CSV otherwise" } },
+			{ { "min_time"    }, { "t"  }, { "minimum duration of one repetition in s, default 0.1"               } },
+			{ { "repetitions" }, { "r"  }, { "number of measured repetitions, default 5"                          } },
+			{ { "quick"       }, { "q"  }, { "use reduced ranges of swept parameters"                             } },
+			{ { "materials"   }, { "md" }, { "path to materials database, default Materials.dmdb"                 } },
+			{ { "models_path" }, { "mp" }, { "path to look for agglomeration solvers"                             } },
+			{ { "help"        }, { "h"  }, { "give this help list"                                                } },
+		};
+
+		const CArgumentsParser parser(argc, argv, keys);
+		if (parser.HasKey("h"))
+		{
+			PrintArgumentsInfo(parser);
+			return 0;
+		}
+
+		CBenchmarkRunner runner;
+		if (parser.HasKey("f")) runner.SetFilter(parser.GetValue("f"));
+		if (parser.HasKey("t")) runner.SetMinTime(std::stod(parser.GetValue("t")));
+		if (parser.HasKey("r")) runner.SetRepetitions(std::stoull(parser.GetValue("r")));
+
+		SBenchmarkSweep sweep;
+		if (parser.HasKey("q"))
+		{
+			sweep.classes    = { 100 };
+			sweep.dimensions = { 1, 2 };
+			sweep.timePoints = { 1, 100 };
+			sweep.compounds  = { 3 };
+			sweep.tasks      = { 16, 4096 };
+		}
+
+		CMaterialsDatabase materialsDB;
+		const std::string materialsPath = parser.HasKey("md") ? parser.GetValue("md") : "Materials.dmdb";
+		const bool materialsLoaded = materialsDB.LoadFromFile(materialsPath);
+		if (!materialsLoaded)
+			std::cout << "Cannot load materials database from " << materialsPath << ". Benchmarks of streams and enthalpy lookup are skipped." << std::endl;
+
+		CModelsManager modelsManager;
+		modelsManager.AddDir(L".");
+		for (const auto& dir : parser.GetValues("mp"))
+			modelsManager.AddDir(dir);
+
+		BenchmarkMDMatrix(runner, sweep);
+		BenchmarkTimeDependentValue(runner, sweep);
+		if (materialsLoaded)
+		{
+			BenchmarkStream(runner, sweep, materialsDB);
+			BenchmarkEnthalpyLookup(runner, sweep, materialsDB);
+		}
+		BenchmarkAgglomeration(runner, sweep, modelsManager);
+		BenchmarkThreadPool(runner, sweep);
+
+		if (parser.HasKey("o"))
+		{
+			if (!runner.Write(parser.GetValue("o")))
+			{
+				std::cout << "Cannot write results to " << parser.GetValue("o") << std::endl;
+				return 1;
+			}
+			std::cout << "Results written to " << parser.GetValue("o") << std::endl;
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cout << "Unhandled exception caught: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -7,7 +7,11 @@
 #include "ScriptRunner.h"
 #include "ThreadPool.h"
 #include "DyssolSystemDefines.h"
+#include "DyssolSystemFunctions.h"
+#include <condition_variable>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
 // Prints information about command line arguments.
 void PrintArgumentsInfo(const CArgumentsParser& _parser)
@@ -31,7 +35,7 @@ void PrintVersionInfo()
 }
 
 // Prints information about available models.
-void PrintModelsInfo(const std::vector<std::filesystem::path>& _modelPaths)
+void PrintModelsInfo(const std::vector<std::filesystem::path>& _modelPaths, const std::filesystem::path& _cacheFile)
 {
 	// Helper function to print a formatted entry justified left and filled with spaces until the given length.
 	constexpr auto PrintUnitEntry = [](const auto& _entry, std::streamsize _width)
@@ -41,6 +45,7 @@ void PrintModelsInfo(const std::vector<std::filesystem::path>& _modelPaths)
 
 	// create models manager
 	CModelsManager manager;
+	manager.SetCacheFile(_cacheFile);	// use cached descriptors of models, if any
 	manager.AddDir(L".");				// add current directory as a path to units/solvers
 	for (const auto& dir : _modelPaths)	// add other directories as a path to units/solvers
 		manager.AddDir(dir);
@@ -73,27 +78,86 @@ void PrintModelsInfo(const std::vector<std::filesystem::path>& _modelPaths)
 	}
 }
 
-bool RunDyssol(const std::filesystem::path& _script)
+// Runs all jobs one after another.
+bool RunJobsSequentially(const CScriptParser& _parser)
 {
-	InitializeThreadPool();
-
-	std::cout << "Parsing script file: \n\t" << _script.string() << std::endl;
-
-	const CScriptParser parser{ _script };
-	std::cout << "Jobs found: \n\t" << parser.JobsCount() << std::endl;
-
 	CScriptRunner runner;
 	size_t counter = 0;
 	bool success = true;
-	for (const auto& job : parser.Jobs())
+	for (const auto& job : _parser.Jobs())
 	{
 		std::cout << " ===== Starting job: " << counter++ + 1 << " ===== " << std::endl;
 		success &= runner.RunJob(*job);
 	}
+	return success;
+}
+
+// Runs independent jobs simultaneously in up to _jobsNumber threads, each with own flowsheet, simulator and models.
+// A new job is started only if at least _jobMemory MB of physical memory are available, but at least one job is always running.
+bool RunJobsInParallel(const CScriptParser& _parser, size_t _jobsNumber, size_t _jobMemory)
+{
+	const auto& jobs = _parser.Jobs();
+	const uint64_t requiredMemory = static_cast<uint64_t>(_jobMemory) * 1024 * 1024;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	size_t next = 0;	// index of the next job to start
+	size_t running = 0;	// number of currently running jobs
+	bool success = true;
+
+	const auto Worker = [&]
+	{
+		while (true)
+		{
+			size_t index;
+			{
+				std::unique_lock lock{ mutex };
+				// wait until there is enough memory to start one more job; check it periodically, since memory is also freed by other processes
+				while (next < jobs.size() && running != 0 && SystemFunctions::AvailableMemory() < requiredMemory)
+					cv.wait_for(lock, std::chrono::seconds{ 1 });
+				if (next >= jobs.size()) return;
+				index = next++;
+				++running;
+				std::cout << " ===== Starting job: " << index + 1 << " ===== " << std::endl;
+			}
+			CScriptRunner runner;
+			runner.SetLogPrefix("[Job " + std::to_string(index + 1) + "] ");
+			const bool res = runner.RunJob(*jobs[index]);
+			{
+				std::lock_guard lock{ mutex };
+				--running;
+				success &= res;
+				std::cout << " ===== Finished job: " << index + 1 << " ===== " << std::endl;
+			}
+			cv.notify_all();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < std::min(_jobsNumber, jobs.size()); ++i)
+		threads.emplace_back(Worker);
+	for (auto& t : threads)
+		t.join();
 
 	return success;
 }
 
+bool RunDyssol(const std::filesystem::path& _script, size_t _jobsNumber, size_t _jobMemory)
+{
+	InitializeThreadPool();
+
+	std::cout << "Parsing script file: \n\t" << _script.string() << std::endl;
+
+	const CScriptParser parser{ _script };
+	std::cout << "Jobs found: \n\t" << parser.JobsCount() << std::endl;
+
+	if (_jobsNumber == 0)
+		_jobsNumber = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	if (_jobsNumber == 1 || parser.JobsCount() < 2)
+		return RunJobsSequentially(parser);
+	return RunJobsInParallel(parser, _jobsNumber, _jobMemory);
+}
+
 void HandleException(const std::exception_ptr& _exceptionPtr)
 {
 	try
@@ -118,6 +182,9 @@ int main(int argc, const char* argv[])
 			{ { "version"     }, { "v"  }, { "print information about current version"      } },
 			{ { "models"      }, { "m"  }, { "print information about available models"     } },
 			{ { "models_path" }, { "mp" }, { "additional path to look for available models" } },
+			{ { "models_cache"}, { "mc" }, { "file to cache information about models"       } },
+			{ { "jobs"        }, { "j"  }, { "number of script jobs to run in parallel"     } },
+			{ { "job_memory"  }, { "jm" }, { "memory in MB required to start a parallel job" } },
 			{ { "help"        }, { "h"  }, { "give this help list"                          } },
 		};
 
@@ -136,11 +203,15 @@ int main(int argc, const char* argv[])
 			std::vector<std::filesystem::path> fsPaths;
 			for (const auto& p : parser.GetValues("mp"))
 				fsPaths.emplace_back(p);
-			PrintModelsInfo(fsPaths);
+			PrintModelsInfo(fsPaths, parser.HasKey("mc") ? parser.GetValue("mc") : "");
 		}
 		if (parser.HasKey("s"))
-			if (!RunDyssol(parser.GetValue("s")))
+		{
+			const size_t jobs      = parser.HasKey("j")  ? std::stoull(parser.GetValue("j"))  : 1;
+			const size_t jobMemory = parser.HasKey("jm") ? std::stoull(parser.GetValue("jm")) : 0;
+			if (!RunDyssol(parser.GetValue("s"), jobs, jobMemory))
 				return 1;
+		}
 	}
 	catch (...)
 	{
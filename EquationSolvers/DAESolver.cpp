@@ -4,6 +4,7 @@
 
 #include "DAESolver.h"
 #include "DyssolHelperDefines.h"
+#include "Profiler.h"
 #ifndef SUNDIALS_VERSION_MAJOR
 #define SUNDIALS_VERSION_MAJOR 2
 #define SUNDIALS_VERSION_MINOR 7
@@ -56,6 +57,8 @@ bool CDAESolver::SetModel(CDAEModel* _model)
 
 bool CDAESolver::Calculate(double _time)
 {
+	PROFILE_SCOPE("DAE solver")
+
 	if (_time == 0.0)
 	{
 		const bool success = CalculateInitialConditions();
@@ -75,6 +78,8 @@ bool CDAESolver::Calculate(double _time)
 
 bool CDAESolver::Calculate(double _timeBeg, double _timeEnd)
 {
+	PROFILE_SCOPE("DAE solver")
+
 	int res;
 
 	if (_timeBeg == _timeEnd)
@@ -372,6 +377,7 @@ void CDAESolver::Clear()
 
 int CDAESolver::ResidualFunction(double _time, N_Vector _vals, N_Vector _ders, N_Vector _ress, void* _model)
 {
+	Profiler::Count("residuals");
 	double* vals = N_VGetArrayPointer(_vals);
 	double* ders = N_VGetArrayPointer(_ders);
 	double* ress = N_VGetArrayPointer(_ress);
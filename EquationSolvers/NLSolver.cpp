@@ -4,6 +4,7 @@
 
 #include "NLSolver.h"
 #include "DyssolUtilities.h"
+#include "Profiler.h"
 PRAGMA_WARNING_PUSH
 PRAGMA_WARNING_DISABLE
 #include <kinsol/kinsol.h>
@@ -248,6 +249,8 @@ bool CNLSolver::SetModel(CNLModel* _pModel)
 
 bool CNLSolver::Calculate(double _dTime)
 {
+	PROFILE_SCOPE("NL solver")
+
 	const int ret = KINSol(m_pKINmem, m_vectorVars, (int)E2I(m_eStrategy), m_vectorUScales, m_vectorFScales);
 
 	if (ret == KIN_SUCCESS || ret == KIN_INITIAL_GUESS_OK || ret ==  KIN_STEP_LT_STPTOL)
@@ -275,6 +278,7 @@ std::string CNLSolver::GetError() const
 
 int CNLSolver::ResidualFunction(N_Vector _value, N_Vector _func, void *_pModel)
 {
+	Profiler::Count("residuals");
 	double* pValue = NV_DATA_S(_value);
 	double* pFunc = NV_DATA_S(_func);
 
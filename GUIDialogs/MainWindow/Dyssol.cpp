@@ -405,16 +405,17 @@ void Dyssol::CreateMenu()
 
 	// Units
 	QMenu* menuUnits = ui.menuDocumentation->addMenu("Units");
-	AddHelpAction(menuUnits, "Agglomerator", "003_models/unit_agglomerator.html", "Agglomerator model");
-	AddHelpAction(menuUnits, "Bunker"      , "003_models/unit_bunker.html"      , "Bunker model");
-	AddHelpAction(menuUnits, "Crusher"     , "003_models/unit_crusher.html"     , "Crusher model");
-	AddHelpAction(menuUnits, "Granulator"  , "003_models/unit_granulator.html"  , "Granulator model");
-	AddHelpAction(menuUnits, "Inlet Flow"  , "003_models/unit_inletflow.html"   , "Inlet flow model");
-	AddHelpAction(menuUnits, "Mixer"       , "003_models/unit_mixer.html"       , "Mixer model");
-	AddHelpAction(menuUnits, "Outlet Flow" , "003_models/unit_outletflow.html"  , "Outlet flow model");
-	AddHelpAction(menuUnits, "Screen"      , "003_models/unit_screen.html"      , "Screen model");
-	AddHelpAction(menuUnits, "Splitter"    , "003_models/unit_splitter.html"    , "Splitter model");
-	AddHelpAction(menuUnits, "Time Delay"  , "003_models/unit_timedelay.html"   , "Time delay model");
+	AddHelpAction(menuUnits, "Agglomerator"   , "003_models/unit_agglomerator.html"  , "Agglomerator model");
+	AddHelpAction(menuUnits, "Agglomerator 2D", "003_models/unit_agglomerator2d.html", "Two-dimensional agglomerator model");
+	AddHelpAction(menuUnits, "Bunker"         , "003_models/unit_bunker.html"        , "Bunker model");
+	AddHelpAction(menuUnits, "Crusher"        , "003_models/unit_crusher.html"       , "Crusher model");
+	AddHelpAction(menuUnits, "Granulator"     , "003_models/unit_granulator.html"    , "Granulator model");
+	AddHelpAction(menuUnits, "Inlet Flow"     , "003_models/unit_inletflow.html"     , "Inlet flow model");
+	AddHelpAction(menuUnits, "Mixer"          , "003_models/unit_mixer.html"         , "Mixer model");
+	AddHelpAction(menuUnits, "Outlet Flow"    , "003_models/unit_outletflow.html"    , "Outlet flow model");
+	AddHelpAction(menuUnits, "Screen"         , "003_models/unit_screen.html"        , "Screen model");
+	AddHelpAction(menuUnits, "Splitter"       , "003_models/unit_splitter.html"      , "Splitter model");
+	AddHelpAction(menuUnits, "Time Delay"     , "003_models/unit_timedelay.html"     , "Time delay model");
 
 	// Solvers
 	QMenu* menuSolvers = ui.menuDocumentation->addMenu("Solvers");
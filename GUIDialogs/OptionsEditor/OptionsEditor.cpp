@@ -63,6 +63,7 @@ void COptionsEditor::UpdateWholeView()
 	ShowValueAndLabel(ui.lineEdit1stUpperLimit, ui.label1stUpperLimit, m_pParams->iters1stUpperLimit);
 	ShowValueAndLabel(ui.lineEditAccelParam   , ui.labelAccelParam   , m_pParams->wegsteinAccelParam);
 	ShowValueAndLabel(ui.lineEditRelaxParam   , ui.labelRelaxParam   , m_pParams->relaxationParam   );
+	ShowValueAndLabel(ui.lineEditAndersonDepth, ui.labelAndersonDepth, m_pParams->andersonDepth     );
 	ui.comboBoxConvMethod->setCurrentIndex(static_cast<int>(static_cast<EConvergenceMethod>(m_pParams->convergenceMethod)));
 	ui.comboBoxExtrapMethod->setCurrentIndex(static_cast<int>(static_cast<EExtrapolationMethod>(m_pParams->extrapolationMethod)));
 
@@ -188,6 +189,7 @@ void COptionsEditor::ApplyChanges()
 	m_pParams->Iters1stUpperLimit(static_cast<uint32_t>(ReadValue(ui.lineEdit1stUpperLimit)));
 	m_pParams->WegsteinAccelParam(ReadValue(ui.lineEditAccelParam));
 	m_pParams->RelaxationParam(ReadValue(ui.lineEditRelaxParam));
+	m_pParams->AndersonDepth(static_cast<uint32_t>(ReadValue(ui.lineEditAndersonDepth)));
 	m_pParams->ConvergenceMethod(static_cast<EConvergenceMethod>(ui.comboBoxConvMethod->currentIndex()));
 	m_pParams->ExtrapolationMethod(static_cast<EExtrapolationMethod>(ui.comboBoxExtrapMethod->currentIndex()));
 
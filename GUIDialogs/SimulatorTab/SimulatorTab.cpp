@@ -176,25 +176,37 @@ void CSimulatorTab::ClearLog() const
 
 void CSimulatorTab::UpdateLog() const
 {
-	while (!m_pSimulator->m_log.EndOfLog())
+	// drain all events written since the last update
+	CSimulatorLog::SEvent event;
+	bool hasProgress = false;
+	SSimulationProgress progress;
+	while (m_pSimulator->ReadLogEvent(event))
 	{
-		switch (m_pSimulator->m_log.GetReadColor())
+		if (event.type == CSimulatorLog::EEventType::PROGRESS)
+		{
+			progress = std::move(event.progress);
+			hasProgress = true;
+			continue;
+		}
+		switch (event.color)
 		{
 		case CSimulatorLog::ELogColor::DEFAULT: ui.textBrowserLog->setTextColor(QColor(Qt::black));		break;
 		case CSimulatorLog::ELogColor::RED:		ui.textBrowserLog->setTextColor(QColor(Qt::red));		break;
 		case CSimulatorLog::ELogColor::ORANGE:	ui.textBrowserLog->setTextColor(QColor(255, 128, 0));	break;
 		}
-		ui.textBrowserLog->append(QString::fromStdString(m_pSimulator->m_log.Read()));
+		ui.textBrowserLog->append(QString::fromStdString(event.text));
 	}
 	ui.textBrowserLog->setTextColor(QColor(Qt::black));
 
-	const auto status = m_pSimulator->GetCurrentPartitionStatus();
-	ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_START,   0, status.dTWStart);
-	ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_END,     0, status.dTWEnd);
-	ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_LENGTH,  0, status.dTWLength);
-	ui.tableLog->SetItemNotEditable(EStatTable::ITERATION_NUMBER, 0, status.iTWIterationFull);
-	ui.tableLog->SetItemNotEditable(EStatTable::WINDOW_NUMBER,    0, status.iWindowNumber);
-	ui.tableLog->SetItemNotEditable(EStatTable::UNIT_NAME,        0, m_pSimulator->m_unitName);
+	if (hasProgress)
+	{
+		ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_START,   0, progress.dTWStart);
+		ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_END,     0, progress.dTWEnd);
+		ui.tableLog->SetItemNotEditable(EStatTable::TIME_WIN_LENGTH,  0, progress.dTWEnd - progress.dTWStart);
+		ui.tableLog->SetItemNotEditable(EStatTable::ITERATION_NUMBER, 0, progress.iIteration);
+		ui.tableLog->SetItemNotEditable(EStatTable::WINDOW_NUMBER,    0, progress.iWindowNumber);
+		ui.tableLog->SetItemNotEditable(EStatTable::UNIT_NAME,        0, progress.unitName);
+	}
 	ui.tableLog->SetItemNotEditable(EStatTable::ELAPSED_TIME,     0, QDateTime::fromTime_t(m_simulationTimer.elapsed() / 1000).toUTC().toString("hh:mm:ss"));
 }
 
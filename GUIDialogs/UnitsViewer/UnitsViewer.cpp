@@ -103,15 +103,15 @@ void CUnitsViewer::UpdateVariablesView()
 	if (m_pSelectedModel == NULL || !m_pSelectedModel->GetModel()) return;
 	m_bAvoidSignal = true;
 
-	const auto& manager = m_pSelectedModel->GetModel()->GetStateVariablesManager();
+	const auto names = VariablesNames();
 	int nOldSelected = ui.listWidgetVariables->currentRow();
 	ui.listWidgetVariables->clear();
-	for (const auto& variable : manager.GetAllStateVariablesWithHistory())
-		ui.listWidgetVariables->insertItem(ui.listWidgetVariables->count(), new QListWidgetItem(QString::fromStdString(variable->GetName())));
+	for (const auto& name : names)
+		ui.listWidgetVariables->insertItem(ui.listWidgetVariables->count(), new QListWidgetItem(QString::fromStdString(name)));
 
-	if ((nOldSelected != -1) && (nOldSelected < (int)manager.GetAllStateVariablesWithHistory().size()))
+	if ((nOldSelected != -1) && (nOldSelected < (int)names.size()))
 		ui.listWidgetVariables->setCurrentRow(nOldSelected);
-	else if (manager.GetAllStateVariablesWithHistory().size() > 0)
+	else if (!names.empty())
 		ui.listWidgetVariables->setCurrentRow(0);
 	else
 		ui.listWidgetVariables->setCurrentRow(-1);
@@ -122,7 +122,8 @@ void CUnitsViewer::UpdateVariablesView()
 void CUnitsViewer::UpdateValuesView()
 {
 	if (m_bAvoidSignal) return;
-	if(!m_pSelectedModel || !m_pSelectedModel->GetModel() || m_nSelectedVariable == -1 || m_pSelectedModel->GetModel()->GetStateVariablesManager().GetAllStateVariablesWithHistory().empty())
+	const auto names = m_pSelectedModel && m_pSelectedModel->GetModel() ? VariablesNames() : std::vector<std::string>{};
+	if(m_nSelectedVariable == -1 || m_nSelectedVariable >= (int)names.size())
 	{
 		m_pTabWidget->setEnabled(false);
 		if (m_pTabWidget->currentIndex() == 0)
@@ -133,11 +134,10 @@ void CUnitsViewer::UpdateValuesView()
 	}
 	m_pTabWidget->setEnabled(true);
 
-	const auto& variables = m_pSelectedModel->GetModel()->GetStateVariablesManager().GetAllStateVariablesWithHistory();
+	const auto data = VariableHistory(m_nSelectedVariable);
 	if (m_pTabWidget->currentIndex() == 0)
 	{
 		m_pTableWidget->setRowCount(0);
-		const auto data = variables[m_nSelectedVariable]->GetHistory();
 		for (unsigned i = 0; i < data.size(); ++i)
 		{
 			m_pTableWidget->insertRow(i);
@@ -148,8 +148,7 @@ void CUnitsViewer::UpdateValuesView()
 	else
 	{
 		m_pPlot->ClearCurve(0);
-		m_pPlot->SetCurveName(0, QString::fromStdString(variables[m_nSelectedVariable]->GetName()));
-		const auto& data = variables[m_nSelectedVariable]->GetHistory();
+		m_pPlot->SetCurveName(0, QString::fromStdString(names[m_nSelectedVariable]));
 		std::vector<double> vTimes;		vTimes.reserve(data.size());
 		std::vector<double> vValues;	vValues.reserve(data.size());
 		for (const auto& entry : data)
@@ -163,6 +162,34 @@ void CUnitsViewer::UpdateValuesView()
 	}
 }
 
+std::vector<std::string> CUnitsViewer::VariablesNames() const
+{
+	std::vector<std::string> res;
+	const auto& manager = m_pSelectedModel->GetModel()->GetStateVariablesManager();
+	for (const auto& variable : manager.GetAllStateVariablesWithHistory())
+		res.push_back(variable->GetName());
+	for (const auto& variable : manager.GetAllArrayStateVariablesWithHistory())
+		for (size_t i = 0; i < variable->GetSize(); ++i)
+			res.push_back(variable->GetName() + "[" + std::to_string(i) + "]");
+	return res;
+}
+
+std::vector<STDValue> CUnitsViewer::VariableHistory(size_t _index) const
+{
+	const auto& manager = m_pSelectedModel->GetModel()->GetStateVariablesManager();
+	const auto variables = manager.GetAllStateVariablesWithHistory();
+	if (_index < variables.size())
+		return variables[_index]->GetHistory();
+	_index -= variables.size();
+	for (const auto& variable : manager.GetAllArrayStateVariablesWithHistory())
+	{
+		if (_index < variable->GetSize())
+			return variable->GetHistory(_index);
+		_index -= variable->GetSize();
+	}
+	return {};
+}
+
 void CUnitsViewer::UpdateHoldupsView()
 {
 	if (m_bAvoidSignal) return;
@@ -257,7 +284,7 @@ void CUnitsViewer::UnitChanged()
 void CUnitsViewer::VariableChanged()
 {
 	m_nSelectedVariable = ui.listWidgetVariables->currentRow();
-	if (m_nSelectedVariable == -1 && !m_pSelectedModel->GetModel()->GetStateVariablesManager().GetAllStateVariablesWithHistory().empty())
+	if (m_nSelectedVariable == -1 && !VariablesNames().empty())
 		m_nSelectedVariable = 0;
 	UpdateValuesView();
 }
@@ -7,6 +7,7 @@
 #include "ui_UnitsViewer.h"
 #include "QtPlot.h"
 #include "QtDialog.h"
+#include "DyssolTypes.h"
 #include <QStackedWidget>
 
 class CPlotsViewer;
@@ -54,6 +55,11 @@ private:
 	void SaveViewState();
 	void LoadViewState();
 
+	// Returns names of all state variables with history. Each element of array state variables is listed separately.
+	std::vector<std::string> VariablesNames() const;
+	// Returns history of the state variable with the given index in the list returned by VariablesNames().
+	std::vector<STDValue> VariableHistory(size_t _index) const;
+
 private slots:
 	void TabChanged();
 	void UpdateUnitsView();
@@ -6,6 +6,7 @@
 #include "PacketTable.h"
 #include "DyssolStringConstants.h"
 #include "FileSystem.h"
+#include "Profiler.h"
 
 using namespace H5;
 
@@ -14,6 +15,7 @@ CH5Handler::CH5Handler() :
 	m_bFileValid(false),
 	m_ph5File(nullptr)
 {
+	std::lock_guard lock{ LibraryMutex() };
 	Exception::dontPrint();
 }
 
@@ -24,6 +26,7 @@ CH5Handler::~CH5Handler()
 
 void CH5Handler::Create(const std::filesystem::path& _sFileName, bool _bSingleFile /*= true*/)
 {
+	std::lock_guard lock{ LibraryMutex() };
 	Exception::dontPrint();
 
 	OpenH5File(_sFileName, false, _bSingleFile);
@@ -31,6 +34,7 @@ void CH5Handler::Create(const std::filesystem::path& _sFileName, bool _bSingleFi
 
 void CH5Handler::Open(const std::filesystem::path& _sFileName)
 {
+	std::lock_guard lock{ LibraryMutex() };
 	Exception::dontPrint();
 
 	OpenH5File(_sFileName, true, true);
@@ -40,6 +44,7 @@ void CH5Handler::Open(const std::filesystem::path& _sFileName)
 
 void CH5Handler::Close()
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_ph5File) return;
 
 	m_ph5File->close();
@@ -55,6 +60,7 @@ std::filesystem::path CH5Handler::FileName() const
 
 std::string CH5Handler::CreateGroup(const std::string& _sPath, const std::string& _sGroupName) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return "";
 
 	std::string sPath = _sPath + "/" + _sGroupName;
@@ -65,6 +71,7 @@ std::string CH5Handler::CreateGroup(const std::string& _sPath, const std::string
 
 void CH5Handler::WriteAttribute(const std::string& _sPath, const std::string& _sAttrName, int _nValue) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return;
 
 	DataSpace h5Dataspace(H5S_SCALAR);
@@ -80,6 +87,7 @@ void CH5Handler::WriteAttribute(const std::string& _sPath, const std::string& _s
 
 int CH5Handler::ReadAttribute(const std::string& _sPath, const std::string& _sAttrName) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return 0;
 
 	int nAttrValue;
@@ -176,6 +184,7 @@ void CH5Handler::WriteData(const std::string& _sPath, const std::string& _sDatas
 
 void CH5Handler::WriteData(const std::string& _sPath, const std::string& _sDatasetName, const std::vector<std::vector<double>>& _vvData) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return;
 	if (_vvData.empty()) return;
 
@@ -303,6 +312,7 @@ void CH5Handler::ReadData(const std::string& _sPath, const std::string& _sDatase
 
 void CH5Handler::ReadData(const std::string& _sPath, const std::string& _sDatasetName, std::vector<std::vector<double>>& _vvData) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return;
 
 	try
@@ -344,6 +354,7 @@ void CH5Handler::ReadData(const std::string& _sPath, const std::string& _sDatase
 
 void CH5Handler::ReadDataOld(const std::string& _sPath, const std::string& _sDatasetName, std::vector<std::vector<double>>& _vvData) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return;
 
 	try
@@ -412,6 +423,8 @@ bool CH5Handler::IsValid() const
 
 void CH5Handler::WriteValue(const std::string& _sPath, const std::string& _sDatasetName, const hsize_t _size, const DataType& _type, const void* _pValue) const
 {
+	PROFILE_SCOPE("HDF5 write")
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return;
 
 	Group h5Group(m_ph5File->openGroup(_sPath));
@@ -427,6 +440,7 @@ void CH5Handler::WriteValue(const std::string& _sPath, const std::string& _sData
 
 size_t CH5Handler::ReadSize(const std::string& _sPath, const std::string& _sDatasetName) const
 {
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return 0;
 
 	try
@@ -455,6 +469,8 @@ size_t CH5Handler::ReadSize(const std::string& _sPath, const std::string& _sData
 
 bool CH5Handler::ReadValue(const std::string& _sPath, const std::string& _sDatasetName, const H5::DataType& _type, void* _pRes) const
 {
+	PROFILE_SCOPE("HDF5 read")
+	std::lock_guard lock{ LibraryMutex() };
 	if (!m_bFileValid) return false;
 
 	try
@@ -482,6 +498,7 @@ void CH5Handler::OpenH5File(const std::filesystem::path& _sFileName, bool _bOpen
 	m_sFileName = ConvertFileName(_sFileName, _bOpen, _bSingleFile);
 	if (m_ph5File || m_sFileName.empty()) return;
 
+	std::lock_guard lock{ LibraryMutex() };
 	FileAccPropList h5AccPropList = CreateFileAccPropList(_bSingleFile);
 	try
 	{
@@ -511,41 +528,43 @@ FileAccPropList CH5Handler::CreateFileAccPropList(bool _bSingleFile)
 	return h5AccPropList;
 }
 
-CompType& CH5Handler::h5CPoint_type()
+std::recursive_mutex& CH5Handler::LibraryMutex()
 {
-	static std::unique_ptr<CompType> type{};
+	static std::recursive_mutex mutex;
+	return mutex;
+}
 
-	if (!type)
+CompType& CH5Handler::h5CPoint_type()
+{
+	std::lock_guard lock{ LibraryMutex() };
+	static CompType type = []
 	{
-		type = std::make_unique<CompType>(sizeof(CPoint));
-		type->insertMember("x", HOFFSET(CPoint, x), PredType::NATIVE_DOUBLE);
-		type->insertMember("y", HOFFSET(CPoint, y), PredType::NATIVE_DOUBLE);
-	}
-	return *type;
+		CompType res(sizeof(CPoint));
+		res.insertMember("x", HOFFSET(CPoint, x), PredType::NATIVE_DOUBLE);
+		res.insertMember("y", HOFFSET(CPoint, y), PredType::NATIVE_DOUBLE);
+		return res;
+	}();
+	return type;
 }
 
 H5::CompType& CH5Handler::h5STDValue_type()
 {
-	static std::unique_ptr<CompType> type{};
-
-	if (!type)
+	std::lock_guard lock{ LibraryMutex() };
+	static CompType type = []
 	{
-		type = std::make_unique<CompType>(sizeof(STDValue));
-		type->insertMember("time" , HOFFSET(STDValue, time ), PredType::NATIVE_DOUBLE);
-		type->insertMember("value", HOFFSET(STDValue, value), PredType::NATIVE_DOUBLE);
-	}
-	return *type;
+		CompType res(sizeof(STDValue));
+		res.insertMember("time" , HOFFSET(STDValue, time ), PredType::NATIVE_DOUBLE);
+		res.insertMember("value", HOFFSET(STDValue, value), PredType::NATIVE_DOUBLE);
+		return res;
+	}();
+	return type;
 }
 
 H5::StrType& CH5Handler::h5String_type()
 {
-	static std::unique_ptr<StrType> type{};
-
-	if (!type)
-	{
-		type = std::make_unique<StrType>(PredType::C_S1, H5T_VARIABLE);
-	}
-	return *type;
+	std::lock_guard lock{ LibraryMutex() };
+	static StrType type{ PredType::C_S1, H5T_VARIABLE };
+	return type;
 }
 
 std::filesystem::path CH5Handler::ConvertFileName(const std::filesystem::path& _sFileName, bool _bOpen, bool _bSingleFile)
@@ -9,12 +9,14 @@
 #include "H5Cpp.h"
 #include "DyssolFilesystem.h"
 #include <regex>
+#include <mutex>
 
 
 /**
  *	IO with HDF5 files. Two modes:
  *	1. Single file: all data stored in a single file.
  *	2. Multi file: the file is split into parts of 2000 Mb each.
+ *	The HDF5 library is not thread-safe, so each call to it is serialized with a process-wide lock. Files can be kept open in several threads at once.
  */
 class CH5Handler
 {
@@ -80,10 +82,11 @@ private:
 
 	void OpenH5File(const std::filesystem::path& _sFileName, bool _bOpen, bool _bSingleFile);
 	static H5::FileAccPropList CreateFileAccPropList(bool _bSingleFile);
+	static std::recursive_mutex& LibraryMutex();	// Returns the mutex serializing access to the HDF5 library.
 
-	static H5::CompType& h5CPoint_type();	// Lazily initializes HDF5 type for CPoint and returns it.
-	static H5::CompType& h5STDValue_type(); // Lazily initializes HDF5 type for STDValue and returns it.
-	static H5::StrType& h5String_type();	// Lazily initializes HDF5 type for std::string representation and returns it.
+	static H5::CompType& h5CPoint_type();	// Lazily and thread-safely initializes HDF5 type for CPoint and returns it.
+	static H5::CompType& h5STDValue_type(); // Lazily and thread-safely initializes HDF5 type for STDValue and returns it.
+	static H5::StrType& h5String_type();	// Lazily and thread-safely initializes HDF5 type for std::string representation and returns it.
 
 	static std::filesystem::path ConvertFileName(const std::filesystem::path& _sFileName, bool _bOpen, bool _bSingleFile);	// Converts the file name to a Dyssol format.
 	static std::filesystem::path MultiFileReadName(const std::filesystem::path& _sFileName);								// Transforms the file name to the form needed to read from multi-file.
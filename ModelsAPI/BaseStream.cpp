@@ -8,6 +8,8 @@
 #include "MultidimensionalGrid.h"
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
+#include "Profiler.h"
+#include <numeric>
 
 // TODO: remove all reinterpret_cast and static_cast for MDMatrix.
 
@@ -68,6 +70,7 @@ CBaseStream::CBaseStream(CBaseStream&& _other) noexcept :
 
 void CBaseStream::Clear()
 {
+	m_version.MarkModified();
 	m_timePoints.clear();
 	m_overall.clear();
 	m_phases.clear();
@@ -174,6 +177,7 @@ void CBaseStream::RemoveTimePoints(double _timeBeg, double _timeEnd, bool _inclu
 								 : std::lower_bound(m_timePoints.begin(), m_timePoints.end(), _timeEnd);
 	if (end == m_timePoints.begin() || beg == m_timePoints.end() || beg == end) return;
 	m_timePoints.erase(beg, end);
+	m_version.MarkModified();
 
 	// remove data in overall parameters
 	for (auto& [type, param] : m_overall)
@@ -196,6 +200,7 @@ void CBaseStream::RemoveAllTimePoints()
 {
 	// remove time points
 	m_timePoints.clear();
+	m_version.MarkModified();
 	// remove data in overall parameters
 	for (auto& [type, param] : m_overall)
 		param->RemoveAllTimePoints();
@@ -294,6 +299,7 @@ CTimeDependentValue* CBaseStream::AddOverallProperty(EOverall _property, const s
 
 	if (flag) // a new property added
 	{
+		m_version.MarkModified();
 		// add time points
 		// TODO: maybe remove this
 		for (const auto& t : m_timePoints)
@@ -305,6 +311,7 @@ CTimeDependentValue* CBaseStream::AddOverallProperty(EOverall _property, const s
 
 void CBaseStream::RemoveOverallProperty(EOverall _property)
 {
+	m_version.MarkModified();
 	m_overall.erase(_property);
 }
 
@@ -395,6 +402,7 @@ void CBaseStream::AddCompound(const std::string& _compoundKey)
 
 	// add to the grid
 	m_grid.GetGridDimensionSymbolic(DISTR_COMPOUNDS)->AddClass(_compoundKey);
+	m_version.MarkModified();
 
 	// invalidate enthalpy calculator
 	ClearEnthalpyCalculator();
@@ -410,6 +418,7 @@ void CBaseStream::RemoveCompound(const std::string& _compoundKey)
 
 	// remove from the grid
 	m_grid.GetGridDimensionSymbolic(DISTR_COMPOUNDS)->RemoveClass(_compoundKey);
+	m_version.MarkModified();
 
 	// invalidate enthalpy calculator
 	ClearEnthalpyCalculator();
@@ -562,6 +571,7 @@ CPhase* CBaseStream::AddPhase(EPhase _phase, const std::string& _name)
 
 	if (flag) // a new phase added
 	{
+		m_version.MarkModified();
 		// add time points
 		// TODO: maybe remove this
 		for (const auto& t : m_timePoints)
@@ -575,6 +585,7 @@ void CBaseStream::RemovePhase(EPhase _phase)
 {
 	if (!HasPhase(_phase)) return;
 
+	m_version.MarkModified();
 	m_phases.erase(_phase);
 }
 
@@ -1057,6 +1068,23 @@ CDenseMDMatrix CBaseStream::GetDistribution(double _time, const std::vector<EDis
 	return res;
 }
 
+std::vector<double> CBaseStream::GetDistributions(const std::vector<double>& _times, EDistrTypes _distribution) const
+{
+	return GetDistributions(_times, std::vector<EDistrTypes>{ _distribution });
+}
+
+std::vector<double> CBaseStream::GetDistributions(double _timeBeg, double _timeEnd, EDistrTypes _distribution) const
+{
+	return GetDistributions(GetTimePoints(_timeBeg, _timeEnd), _distribution);
+}
+
+std::vector<double> CBaseStream::GetDistributions(const std::vector<double>& _times, const std::vector<EDistrTypes>& _distributions) const
+{
+	if (!HasPhase(EPhase::SOLID)) return {};
+
+	return m_phases.at(EPhase::SOLID)->MDDistr()->GetDistributions(_times, vector_cast<unsigned>(_distributions));
+}
+
 void CBaseStream::SetDistribution(double _time, EDistrTypes _distribution, const std::vector<double>& _value)
 {
 	if (!HasPhase(EPhase::SOLID)) return;
@@ -1312,6 +1340,46 @@ std::vector<double> CBaseStream::GetPSD(double _time, EPSDTypes _type, const std
 	return {};
 }
 
+std::vector<double> CBaseStream::GetPSDs(const std::vector<double>& _times, EPSDTypes _type, const std::vector<std::string>& _compoundKeys, EPSDGridType _grid) const
+{
+	if (!HasPhase(EPhase::SOLID)) return {};
+	if (!m_grid.HasDimension(DISTR_SIZE)) return {};
+	if (!HasCompounds(_compoundKeys)) return {};
+
+	const size_t nClasses = m_grid.GetGridDimension(DISTR_SIZE)->ClassesNumber();
+
+	// number-related distributions depend on time-dependent densities - calculate them separately
+	if (_type != PSD_MassFrac && _type != PSD_q3 && _type != PSD_Q3)
+	{
+		std::vector<double> res(_times.size() * nClasses, 0.0);
+		for (size_t i = 0; i < _times.size(); ++i)
+		{
+			const std::vector<double> psd = GetPSD(_times[i], _type, _compoundKeys, _grid);
+			std::copy_n(psd.begin(), std::min(psd.size(), nClasses), res.begin() + i * nClasses);
+		}
+		return res;
+	}
+
+	std::vector<double> res = GetPSDMassFractions(_times, _compoundKeys);
+	if (_type == PSD_MassFrac || res.size() != _times.size() * nClasses) return res;
+
+	// convert mass fractions
+	const std::vector<double> grid = m_grid.GetPSDGrid(_grid);
+	for (size_t i = 0; i < _times.size(); ++i)
+	{
+		const auto beg = res.begin() + i * nClasses;
+		const std::vector<double> massFrac(beg, beg + nClasses);
+		const std::vector<double> psd = _type == PSD_q3 ? ConvertMassFractionsToq3(grid, massFrac) : ConvertMassFractionsToQ3(massFrac);
+		std::copy_n(psd.begin(), std::min(psd.size(), nClasses), beg);
+	}
+	return res;
+}
+
+std::vector<double> CBaseStream::GetPSDs(double _timeBeg, double _timeEnd, EPSDTypes _type, const std::vector<std::string>& _compoundKeys, EPSDGridType _grid) const
+{
+	return GetPSDs(GetTimePoints(_timeBeg, _timeEnd), _type, _compoundKeys, _grid);
+}
+
 void CBaseStream::SetPSD(double _time, EPSDTypes _type, const std::vector<double>& _value, EPSDGridType _grid)
 {
 	SetPSD(_time, _type, "", _value, _grid);
@@ -1349,6 +1417,7 @@ void CBaseStream::SetPSD(double _time, EPSDTypes _type, const std::string& _comp
 
 void CBaseStream::Copy(double _time, const CBaseStream& _source)
 {
+	PROFILE_SCOPE("Stream copy")
 	if (!HaveSameOverallAndPhases(*this, _source)) return;
 
 	// remove redundant time points
@@ -1368,14 +1437,14 @@ void CBaseStream::Copy(double _time, const CBaseStream& _source)
 
 void CBaseStream::Copy(double _timeBeg, double _timeEnd, const CBaseStream& _source)
 {
+	PROFILE_SCOPE("Stream copy")
 	if (!HaveSameOverallAndPhases(*this, _source)) return;
 
 	// remove redundant time points
 	RemoveTimePointsAfter(_timeBeg, true);
 
 	// insert time points
-	for (double t : _source.GetTimePoints(_timeBeg, _timeEnd))
-		InsertTimePoint(t);
+	InsertTimePoints(_source.GetTimePoints(_timeBeg, _timeEnd));
 
 	// copy data in overall parameters
 	for (auto& [type, param] : m_overall)
@@ -1388,6 +1457,7 @@ void CBaseStream::Copy(double _timeBeg, double _timeEnd, const CBaseStream& _sou
 
 void CBaseStream::Copy(double _timeDst, const CBaseStream& _source, double _timeSrc)
 {
+	PROFILE_SCOPE("Stream copy")
 	if (!HaveSameOverallAndPhases(*this, _source)) return;
 
 	// remove redundant time points
@@ -1412,6 +1482,7 @@ void CBaseStream::Add(double _time, const CBaseStream& _source)
 
 void CBaseStream::Add(double _timeBeg, double _timeEnd, const CBaseStream& _source)
 {
+	PROFILE_SCOPE("Stream mix")
 	if (!HaveSameStructure(*this, _source)) return;
 
 	// gather all time points
@@ -1431,9 +1502,8 @@ void CBaseStream::Add(double _timeBeg, double _timeEnd, const CBaseStream& _sour
 		mix[i] = CalculateMix(timePoints[i], _source, massSrc, timePoints[i], *this, massDst);
 	}
 
-	// set mixture data for each time point
-	for (size_t i = 0; i < timePoints.size(); ++i)
-		SetMix(timePoints[i], mix[i]);
+	// set mixture data for all time points
+	SetMix(timePoints, mix);
 }
 
 bool CBaseStream::AreEqual(double _time, const CBaseStream& _stream1, const CBaseStream& _stream2)
@@ -1464,14 +1534,9 @@ bool CBaseStream::AreEqual(double _time, const CBaseStream& _stream1, const CBas
 
 		const auto distr1 = param->MDDistr()->GetDistribution(_time);
 		const auto distr2 = _stream2.m_phases.at(key)->MDDistr()->GetDistribution(_time);
-		const double* arr1 = distr1.GetDataPtr();
-		const double* arr2 = distr2.GetDataPtr();
-		for (size_t i = 0; i < distr1.GetDataLength(); ++i)
+		if (!distr1.IsEqual(distr2, _stream1.m_toleranceSettings.toleranceAbs, _stream1.m_toleranceSettings.toleranceRel))
 		{
-			if (!Same(arr1[i], arr2[i]))
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
@@ -1504,14 +1569,9 @@ bool CBaseStream::AreEqual(double _time1, double _time2, const CBaseStream& _str
 
 		const auto distr1 = param->MDDistr()->GetDistribution(_time1);
 		const auto distr2 = param->MDDistr()->GetDistribution(_time2);
-		const double* arr1 = distr1.GetDataPtr();
-		const double* arr2 = distr2.GetDataPtr();
-		for (size_t i = 0; i < distr1.GetDataLength(); ++i)
+		if (!distr1.IsEqual(distr2, _absTol, _relTol))
 		{
-			if (!Same(arr1[i], arr2[i]))
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
@@ -1523,6 +1583,67 @@ bool CBaseStream::AreEqual(double _time1, double _time2, const CBaseStream& _str
 	return AreEqual(_time1, _time2, _stream, _stream.m_toleranceSettings.toleranceAbs, _stream.m_toleranceSettings.toleranceRel);
 }
 
+size_t CBaseStream::GetPackedDataSize() const
+{
+	size_t size = m_overall.size();
+	for (const auto& [state, phase] : m_phases)
+	{
+		const auto classes = phase->MDDistr()->GetClasses();
+		size += 1 + std::accumulate(classes.begin(), classes.end(), size_t{ 1 }, std::multiplies<>());
+	}
+	return size;
+}
+
+std::vector<double> CBaseStream::GetPackedData(const std::vector<double>& _times) const
+{
+	std::vector<double> res;
+	res.reserve(_times.size() * GetPackedDataSize());
+	const auto Append = [&](std::vector<double> _values, size_t _size)
+	{
+		_values.resize(_times.size() * _size);
+		res.insert(res.end(), _values.begin(), _values.end());
+	};
+
+	for (const auto& [type, param] : m_overall)
+		Append(param->GetValues(_times), 1);
+	for (const auto& [state, phase] : m_phases)
+	{
+		const auto* distr = phase->MDDistr();
+		const auto classes = distr->GetClasses();
+		Append(phase->Fractions()->GetValues(_times), 1);
+		Append(distr->GetDistributions(_times, distr->GetDimensions()), std::accumulate(classes.begin(), classes.end(), size_t{ 1 }, std::multiplies<>()));
+	}
+	return res;
+}
+
+void CBaseStream::SetPackedData(const std::vector<double>& _times, const std::vector<double>& _data)
+{
+	if (_data.size() != _times.size() * GetPackedDataSize()) return;
+
+	for (const double time : _times)
+		AddTimePoint(time);
+
+	auto pos = _data.begin();
+	for (auto& [type, param] : m_overall)
+	{
+		param->SetValues(_times, std::vector<double>(pos, pos + _times.size()));
+		pos += _times.size();
+	}
+	for (auto& [state, phase] : m_phases)
+	{
+		phase->Fractions()->SetValues(_times, std::vector<double>(pos, pos + _times.size()));
+		pos += _times.size();
+		auto* distr = phase->MDDistr();
+		CDenseMDMatrix dense(distr->GetDimensions(), distr->GetClasses());
+		for (const double time : _times)
+		{
+			std::copy(pos, pos + dense.GetDataLength(), dense.GetDataPtr());
+			distr->SetDistribution(time, dense);
+			pos += dense.GetDataLength();
+		}
+	}
+}
+
 CMixtureEnthalpyLookup* CBaseStream::GetEnthalpyCalculator() const
 {
 	// lazy initialization
@@ -1556,11 +1677,22 @@ void CBaseStream::SetMaterialsDatabase(const CMaterialsDatabase* _database)
 	ClearEnthalpyCalculator();
 }
 
+uint64_t CBaseStream::GetDataVersion() const
+{
+	uint64_t version = m_version.Get();
+	for (const auto& [type, param] : m_overall)
+		version = std::max(version, param->GetDataVersion());
+	for (const auto& [state, phase] : m_phases)
+		version = std::max(version, phase->GetDataVersion());
+	return version;
+}
+
 void CBaseStream::SetGrid(const CMultidimensionalGrid& _grid)
 {
 	if (m_grid == _grid) return;
 	// save new grid
 	m_grid = _grid;
+	m_version.MarkModified();
 	// update phases
 	for (auto& [state, phase] : m_phases)
 		phase->SetGrid(_grid);
@@ -1700,10 +1832,7 @@ void CBaseStream::LoadFromFile(const CH5Handler& _h5File, const std::string& _pa
 	}
 
 	// clear current state
-	m_timePoints.clear();
-	m_overall.clear();
-	m_phases.clear();
-	ClearEnthalpyCalculator();
+	Clear();
 
 	// basic data
 	_h5File.ReadData(_path, StrConst::Stream_H5StreamName, m_name);
@@ -1753,10 +1882,7 @@ void CBaseStream::LoadFromFile_v1(const CH5Handler& _h5File, const std::string&
 	const std::string massUnit = m_overall[EOverall::OVERALL_MASS]->GetUnits();
 
 	// clear current state
-	m_timePoints.clear();
-	m_overall.clear();
-	m_phases.clear();
-	ClearEnthalpyCalculator();
+	Clear();
 
 	// prepare some values
 	const std::string distrPathBase = _path + "/" + StrConst::Stream_H5Group2DDistrs + "/" + StrConst::Stream_H5Group2DDistrName;
@@ -1888,6 +2014,35 @@ void CBaseStream::SetMix(double _time, const mix_type& _data)
 	}
 }
 
+void CBaseStream::SetMix(const std::vector<double>& _times, const std::vector<mix_type>& _data)
+{
+	if (_times.empty()) return;
+
+	// add time points
+	InsertTimePoints(_times);
+
+	std::vector<double> values(_times.size());
+
+	// overall properties
+	for (auto& [type, param] : m_overall)
+	{
+		for (size_t i = 0; i < _times.size(); ++i)
+			values[i] = std::get<0>(_data[i]).at(type);
+		param->SetValues(_times, values);
+	}
+
+	// phases
+	for (auto& [key, param] : m_phases)
+	{
+		for (size_t i = 0; i < _times.size(); ++i)
+			values[i] = std::get<1>(_data[i]).at(key);
+		param->Fractions()->SetValues(_times, values);
+		param->MDDistr()->AddTimePoints(_times);
+		for (size_t i = 0; i < _times.size(); ++i)
+			param->MDDistr()->SetDistribution(_times[i], std::get<2>(_data[i]).at(key));
+	}
+}
+
 double CBaseStream::CalculateMixPressure(double _time1, const CBaseStream& _stream1, double _time2, const CBaseStream& _stream2)
 {
 	const double pressure1 = _stream1.GetPressure(_time1);
@@ -1950,14 +2105,13 @@ CDenseMDMatrix CBaseStream::CalculateMixDistribution(double _time1, const CBaseS
 	const auto& phase2 = _stream2.m_phases.at(_phase);
 	const double phaseFrac1 = phase1->GetFraction(_time1);
 	const double phaseFrac2 = phase2->GetFraction(_time2);
-	CDenseMDMatrix distr1 = phase1->MDDistr()->GetDistribution(_time1);
-	CDenseMDMatrix distr2 = phase2->MDDistr()->GetDistribution(_time2);
-	// TODO: more elegant/effective solution
+	const CDenseMDMatrix distr1 = phase1->MDDistr()->GetDistribution(_time1);
+	const CDenseMDMatrix distr2 = phase2->MDDistr()->GetDistribution(_time2);
 	CDenseMDMatrix mix;
 	if (phaseFrac1 != 0.0 || phaseFrac2 != 0.0) // normal calculation
-		mix = distr1 * _mass1 * phaseFrac1 + distr2 * _mass2 * phaseFrac2;
+		mix = CDenseMDMatrix::Mix(_mass1 * phaseFrac1, distr1, _mass2 * phaseFrac2, distr2);
 	else // preserve compounds distributions, if phase fractions are zero
-		mix = distr1 * _mass1 + distr2 * _mass2;
+		mix = CDenseMDMatrix::Mix(_mass1, distr1, _mass2, distr2);
 
 	mix.Normalize();
 	return mix;
@@ -1966,6 +2120,7 @@ CDenseMDMatrix CBaseStream::CalculateMixDistribution(double _time1, const CBaseS
 void CBaseStream::InsertTimePoint(double _time)
 {
 	const auto pos = std::lower_bound(m_timePoints.begin(), m_timePoints.end(), _time);
+	m_version.MarkModified();
 	if (pos == m_timePoints.end())					// all existing times are smaller
 		m_timePoints.emplace_back(_time);
 	else if (std::fabs(*pos - _time) <= m_epsilon)	// this time already exists
@@ -1974,6 +2129,31 @@ void CBaseStream::InsertTimePoint(double _time)
 		m_timePoints.insert(pos, _time);
 }
 
+void CBaseStream::InsertTimePoints(const std::vector<double>& _times)
+{
+	if (_times.empty()) return;
+	m_version.MarkModified();
+	// all new times are bigger
+	if (m_timePoints.empty() || m_timePoints.back() < _times.front())
+	{
+		m_timePoints.insert(m_timePoints.end(), _times.begin(), _times.end());
+		return;
+	}
+	std::vector<double> res;
+	res.reserve(m_timePoints.size() + _times.size());
+	auto pos = m_timePoints.cbegin();
+	for (double t : _times)
+	{
+		while (pos != m_timePoints.cend() && *pos < t)
+			res.push_back(*pos++);
+		if (pos != m_timePoints.cend() && std::fabs(*pos - t) <= m_epsilon)	// this time already exists
+			++pos;
+		res.push_back(t);
+	}
+	res.insert(res.end(), pos, m_timePoints.cend());
+	m_timePoints = std::move(res);
+}
+
 bool CBaseStream::HasTime(double _time) const
 {
 	if (m_timePoints.empty()) return false;
@@ -2026,6 +2206,36 @@ std::vector<double> CBaseStream::GetPSDMassFraction(double _time, const std::vec
 	return distr;
 }
 
+std::vector<double> CBaseStream::GetPSDMassFractions(const std::vector<double>& _times, const std::vector<std::string>& _compoundKeys) const
+{
+	const auto* distr = m_phases.at(EPhase::SOLID)->MDDistr();
+
+	// for all available compounds
+	if (_compoundKeys.empty() || _compoundKeys.size() == GetAllCompounds().size())
+		return distr->GetDistributions(_times, { DISTR_SIZE });
+
+	// only for selected compounds: sizes change fastest, then compounds, then times
+	const std::vector<double> all = distr->GetDistributions(_times, { DISTR_SIZE, DISTR_COMPOUNDS });
+	if (all.empty()) return {};
+	const size_t nClasses = m_grid.GetGridDimension(DISTR_SIZE)->ClassesNumber();
+	const size_t nCompounds = all.size() / _times.size() / nClasses;
+	std::vector<double> res(_times.size() * nClasses, 0.0);
+	for (size_t i = 0; i < _times.size(); ++i)
+	{
+		double* psd = &res[i * nClasses];
+		for (const auto& key : _compoundKeys)
+		{
+			const double* vec = &all[(i * nCompounds + CompoundIndex(key)) * nClasses];
+			for (size_t j = 0; j < nClasses; ++j)
+				psd[j] += vec[j];
+		}
+		const double sum = std::accumulate(psd, psd + nClasses, 0.0);
+		if (sum != 0.0 && sum != 1.0)
+			std::transform(psd, psd + nClasses, psd, [sum](double _v) { return _v / sum; });
+	}
+	return res;
+}
+
 std::vector<double> CBaseStream::GetPSDNumber(double _time, const std::vector<std::string>& _compoundKeys, EPSDGridType _grid) const
 {
 	const auto& compounds = GetAllCompounds();
@@ -7,6 +7,7 @@
 #include "DefinesMDB.h"
 #include "MixtureEnthalpyLookup.h"
 #include "MultidimensionalGrid.h"
+#include "DataVersion.h"
 #include <limits>
 
 class CH5Handler;
@@ -78,6 +79,11 @@ protected:
 	 * Defined phases.
 	 */
 	std::map<EPhase, std::unique_ptr<CPhase>> m_phases;
+	/**
+	 * \private
+	 * Version of time points and structure of the stream.
+	 */
+	CDataVersion m_version;
 	/**
 	 * \private
 	 * Lookup table to calculate temperature<->enthalpy.
@@ -1072,6 +1078,33 @@ public:
 	 * \return Multi-dimensional distribution of the solid material.
 	 */
 	CDenseMDMatrix GetDistribution(double _time, const std::vector<EDistrTypes>& _distributions, const std::string& _compoundKey) const;
+	/**
+	 * \brief Returns one-dimensional distributions of the solid material over the specified parameter at all given time points.
+	 * \details The result is a contiguous block [_times.size() x number of classes] with the distribution at each time point following the previous one.
+	 * All time points are calculated at once, which is faster than calling CBaseStream::GetDistribution(double, EDistrTypes) const for each of them, especially for sorted time points.
+	 * \param _times Target time points.
+	 * \param _distribution Type of distributed parameter of the solid phase.
+	 * \return One-dimensional distributions of the solid material for all time points.
+	 */
+	std::vector<double> GetDistributions(const std::vector<double>& _times, EDistrTypes _distribution) const;
+	/**
+	 * \brief Returns one-dimensional distributions of the solid material over the specified parameter at all time points defined in the given interval.
+	 * \details Refer to function CBaseStream::GetDistributions(const std::vector<double>&, EDistrTypes) const.
+	 * \param _timeBeg Begin of the time interval.
+	 * \param _timeEnd End of the time interval.
+	 * \param _distribution Type of distributed parameter of the solid phase.
+	 * \return One-dimensional distributions of the solid material for all time points in the interval.
+	 */
+	std::vector<double> GetDistributions(double _timeBeg, double _timeEnd, EDistrTypes _distribution) const;
+	/**
+	 * \brief Returns multi-dimensional distributions of the solid material over the specified parameters at all given time points.
+	 * \details The result is a contiguous block [_times.size() x number of classes] with the distribution at each time point following the previous one.
+	 * Each distribution is arranged as in CDenseMDMatrix with the first dimension changing fastest.
+	 * \param _times Target time points.
+	 * \param _distributions List of distributed parameter types of the solid phase.
+	 * \return Multi-dimensional distributions of the solid material for all time points.
+	 */
+	std::vector<double> GetDistributions(const std::vector<double>& _times, const std::vector<EDistrTypes>& _distributions) const;
 
 	/**
 	 * \brief Sets one-dimensional distribution of the solid material over the specified parameter at the given time point.
@@ -1200,6 +1233,28 @@ public:
 	*/
 	std::vector<double> GetPSD(double _time, EPSDTypes _type, const std::vector<std::string>& _compoundKeys, EPSDGridType _grid = EPSDGridType::DIAMETER) const;
 	/**
+	* \brief Returns the specified type of the PSD of the mixture of selected compounds at all given time points.
+	* \details The result is a contiguous block [_times.size() x number of size classes] with the PSD at each time point following the previous one.
+	* If the list of compounds is empty, the whole mixture is considered. Mass-related PSDs are calculated for all time points at once.
+	* \param _times Target time points.
+	* \param _type Identifier of the PSD type.
+	* \param _compoundKeys Unique keys of the compounds.
+	* \param _grid Identifier of grid units type.
+	* \return Particle size distributions for all time points.
+	*/
+	std::vector<double> GetPSDs(const std::vector<double>& _times, EPSDTypes _type, const std::vector<std::string>& _compoundKeys = {}, EPSDGridType _grid = EPSDGridType::DIAMETER) const;
+	/**
+	* \brief Returns the specified type of the PSD of the mixture of selected compounds at all time points defined in the given interval.
+	* \details Refer to function CBaseStream::GetPSDs(const std::vector<double>&, EPSDTypes, const std::vector<std::string>&, EPSDGridType) const.
+	* \param _timeBeg Begin of the time interval.
+	* \param _timeEnd End of the time interval.
+	* \param _type Identifier of the PSD type.
+	* \param _compoundKeys Unique keys of the compounds.
+	* \param _grid Identifier of grid units type.
+	* \return Particle size distributions for all time points in the interval.
+	*/
+	std::vector<double> GetPSDs(double _timeBeg, double _timeEnd, EPSDTypes _type, const std::vector<std::string>& _compoundKeys = {}, EPSDGridType _grid = EPSDGridType::DIAMETER) const;
+	/**
 	* \brief Sets the specified type of the PSD of the total mixture of all solid materials at the given time point.
 	* \details For number-related PSD, the distribution is normalized and the total particle mass remains unchanged.
 	* If the specified time point does not exist, it is added to the stream.
@@ -1301,6 +1356,31 @@ public:
 	 */
 	static bool AreEqual(double _time1, double _time2, const CBaseStream& _stream);
 
+	/**
+	 * \private
+	 * \brief Returns the number of values describing the stream at a single time point in CBaseStream::GetPackedData().
+	 * \return Number of values per time point.
+	 */
+	size_t GetPackedDataSize() const;
+	/**
+	 * \private
+	 * \brief Returns all data of the stream at the given time points as one contiguous array.
+	 * \details The array contains values of all overall properties, followed by the fraction and the multidimensional distribution of each phase.
+	 * Each entry is stored for all time points at once, distributions as a block [_times.size() x number of classes].
+	 * Streams with the same structure have the same layout, so that element-wise operations can be applied to the data of several streams at once.
+	 * \param _times Sorted target time points.
+	 * \return All data of the stream, _times.size() * GetPackedDataSize() values.
+	 */
+	std::vector<double> GetPackedData(const std::vector<double>& _times) const;
+	/**
+	 * \private
+	 * \brief Sets all data of the stream at the given time points from one contiguous array.
+	 * \details The array must have the layout of CBaseStream::GetPackedData(). Time points are added if needed. Does nothing if the size of the array does not match.
+	 * \param _times Sorted target time points.
+	 * \param _data All data of the stream, _times.size() * GetPackedDataSize() values.
+	 */
+	void SetPackedData(const std::vector<double>& _times, const std::vector<double>& _data);
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Thermodynamics
 	//
@@ -1338,6 +1418,14 @@ public:
 	 */
 	const CMultidimensionalGrid& GetGrid() const;
 
+	/**
+	 * \private
+	 * \brief Returns version of the stream data, which changes with each modification of the stream.
+	 * \details Can be used to check whether the stream has been changed since the version was obtained. Must not be called concurrently for the same stream.
+	 * \return Current version of data.
+	 */
+	uint64_t GetDataVersion() const;
+
 	// TODO: remove, initialize MDB in constructor
 	/**
 	 * \private
@@ -1512,6 +1600,13 @@ protected:
 	 * \param _data Mixture of two streams.
 	 */
 	void SetMix(double _time, const mix_type& _data);
+	/**
+	 * \private
+	 * \brief Sets the results of mixing two streams into this stream at the given sorted time points at once.
+	 * \param _times Sorted target time points.
+	 * \param _data Mixtures of two streams for each time point.
+	 */
+	void SetMix(const std::vector<double>& _times, const std::vector<mix_type>& _data);
 
 private:
 	/**
@@ -1520,6 +1615,12 @@ private:
 	 * \param _time New time point that needs to be inserted.
 	 */
 	void InsertTimePoint(double _time);
+	/**
+	 * \private
+	 * \brief Inserts the new sorted times into the list of time points in one pass, if they do not exist yet.
+	 * \param _times New sorted time points that need to be inserted.
+	 */
+	void InsertTimePoints(const std::vector<double>& _times);
 	/**
 	 * \private
 	 * \brief Checks whether the given time point exists.
@@ -1568,6 +1669,15 @@ private:
 	 * \return Calculated PSD in mass fractions.
 	 */
 	std::vector<double> GetPSDMassFraction(double _time, const std::vector<std::string>& _compoundKeys) const;
+	/**
+	 * \private
+	 * \brief Calculates the PSDs of the stream in mass fractions for the selected compounds at all given time points.
+	 * \details Refer to function CBaseStream::GetPSDMassFraction(double, const std::vector<std::string>&) const.
+	 * \param _times Target time points.
+	 * \param _compoundKeys Unique keys of the compounds.
+	 * \return Calculated PSDs in mass fractions as a contiguous block [_times.size() x number of size classes].
+	 */
+	std::vector<double> GetPSDMassFractions(const std::vector<double>& _times, const std::vector<std::string>& _compoundKeys) const;
 	/**
 	 * \private
 	 * \brief Calculates the number particle distribution of the stream for the selected compounds.
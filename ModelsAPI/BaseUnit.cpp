@@ -9,6 +9,7 @@
 #include "ContainerFunctions.h"
 #include "DyssolUtilities.h"
 #include "DyssolStringConstants.h"
+#include "Profiler.h"
 #include <stdexcept>
 #include <numeric>
 
@@ -86,6 +87,7 @@ void swap(CBaseUnit& _first, CBaseUnit& _second) noexcept
 	swap(_first.m_errorMessage      , _second.m_errorMessage);
 	swap(_first.m_warningMessage    , _second.m_warningMessage);
 	swap(_first.m_infoMessage       , _second.m_infoMessage);
+	swap(_first.m_messageHandler    , _second.m_messageHandler);
 }
 
 void CBaseUnit::ConfigureUnitStructures(const CMaterialsDatabase* _materialsDB, const CMultidimensionalGrid& _grid, const std::vector<SOverallDescriptor>* _overall,
@@ -113,6 +115,16 @@ void CBaseUnit::ConfigureUnitStructures(const CBaseUnit* _other)
 	m_streams.SetPointers(m_materialsDB, &m_grid, m_overall, m_phases, m_cache, m_tolerances, m_thermodynamics);
 }
 
+void CBaseUnit::CopyUserData(const CBaseUnit& _other)
+{
+	m_grid = _other.m_grid;
+	m_ports.CopyUserData(_other.m_ports);
+	m_streams.CopyUserData(_other.m_streams);
+	m_unitParameters.CopyUserData(_other.m_unitParameters);
+	m_stateVariables = _other.m_stateVariables;
+	m_plots = _other.m_plots;
+}
+
 void CBaseUnit::SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB)
 {
 	m_materialsDB = _materialsDB;
@@ -526,6 +538,19 @@ CSolverUnitParameter* CBaseUnit::AddSolverAgglomeration(const std::string& _name
 	return m_unitParameters.GetSolverParameter(_name);
 }
 
+CSolverUnitParameter* CBaseUnit::AddSolverAgglomeration2D(const std::string& _name, const std::string& _description)
+{
+	if (m_unitParameters.IsNameExist(_name))
+	{
+		auto* param = m_unitParameters.GetSolverParameter(_name);
+		if (param->GetSolverType() == ESolverTypes::SOLVER_AGGLOMERATION_2) // exists with the same name and type
+			return param;
+		throw std::logic_error(StrConst::BUnit_ErrAddParam(m_unitName, _name, __func__)); // same name but wrong type
+	}
+	m_unitParameters.AddSolverParameter(_name, _description, ESolverTypes::SOLVER_AGGLOMERATION_2);
+	return m_unitParameters.GetSolverParameter(_name);
+}
+
 CSolverUnitParameter* CBaseUnit::AddSolverPBM(const std::string& _name, const std::string& _description)
 {
 	if (m_unitParameters.IsNameExist(_name))
@@ -706,6 +731,18 @@ CAgglomerationSolver* CBaseUnit::GetSolverAgglomeration(const CSolverUnitParamet
 	return GetSolverAgglomeration(_param->GetName());
 }
 
+CAgglomeration2DSolver* CBaseUnit::GetSolverAgglomeration2D(const std::string& _name) const
+{
+	if (const CSolverUnitParameter* param = m_unitParameters.GetSolverParameter(_name))
+		return dynamic_cast<CAgglomeration2DSolver*>(param->GetSolver());
+	throw std::logic_error(StrConst::BUnit_ErrGetParam(m_unitName, _name, __func__));
+}
+
+CAgglomeration2DSolver* CBaseUnit::GetSolverAgglomeration2D(const CSolverUnitParameter* _param) const
+{
+	return GetSolverAgglomeration2D(_param->GetName());
+}
+
 CPBMSolver* CBaseUnit::GetSolverPBM(const std::string& _name) const
 {
 	if (const CSolverUnitParameter* param = m_unitParameters.GetSolverParameter(_name))
@@ -718,6 +755,13 @@ CPBMSolver* CBaseUnit::GetSolverPBM(const CSolverUnitParameter* _param) const
 	return GetSolverPBM(_param->GetName());
 }
 
+CTDParameterHandle CBaseUnit::GetTDParameterHandle(const std::string& _name) const
+{
+	if (const CTDUnitParameter* param = m_unitParameters.GetTDParameter(_name))
+		return CTDParameterHandle{ param };
+	throw std::logic_error(StrConst::BUnit_ErrGetParam(m_unitName, _name, __func__));
+}
+
 const CStateVariablesManager& CBaseUnit::GetStateVariablesManager() const
 {
 	return m_stateVariables;
@@ -730,7 +774,7 @@ CStateVariablesManager& CBaseUnit::GetStateVariablesManager()
 
 CStateVariable* CBaseUnit::AddStateVariable(const std::string& _name, double _initValue)
 {
-	if (m_stateVariables.GetStateVariable(_name)) // already exists
+	if (m_stateVariables.GetStateVariable(_name) || m_stateVariables.GetArrayStateVariable(_name)) // already exists
 		throw std::logic_error(StrConst::BUnit_ErrAddSV(m_unitName, _name, __func__));
 	return m_stateVariables.AddStateVariable(_name, _initValue);
 }
@@ -758,6 +802,44 @@ void CBaseUnit::SetStateVariable(const std::string& _name, double _value, double
 		throw std::logic_error(StrConst::BUnit_ErrGetSV(m_unitName, _name, __func__));
 }
 
+CStateVariableHandle CBaseUnit::GetStateVariableHandle(const std::string& _name)
+{
+	if (CStateVariable* variable = m_stateVariables.GetStateVariable(_name))
+		return CStateVariableHandle{ variable };
+	throw std::logic_error(StrConst::BUnit_ErrGetSV(m_unitName, _name, __func__));
+}
+
+CArrayStateVariable* CBaseUnit::AddArrayStateVariable(const std::string& _name, const std::vector<double>& _initValues)
+{
+	if (m_stateVariables.GetStateVariable(_name) || m_stateVariables.GetArrayStateVariable(_name)) // already exists
+		throw std::logic_error(StrConst::BUnit_ErrAddSV(m_unitName, _name, __func__));
+	return m_stateVariables.AddArrayStateVariable(_name, _initValues);
+}
+
+std::vector<double> CBaseUnit::GetArrayStateVariable(const std::string& _name) const
+{
+	if (const CArrayStateVariable* variable = m_stateVariables.GetArrayStateVariable(_name))
+		return variable->GetValues();
+	throw std::logic_error(StrConst::BUnit_ErrGetSV(m_unitName, _name, __func__));
+}
+
+void CBaseUnit::SetArrayStateVariable(const std::string& _name, const std::vector<double>& _values, double _time)
+{
+	CArrayStateVariable* variable = m_stateVariables.GetArrayStateVariable(_name);
+	if (!variable)
+		throw std::logic_error(StrConst::BUnit_ErrGetSV(m_unitName, _name, __func__));
+	if (_values.size() != variable->GetSize())
+		throw std::logic_error(StrConst::BUnit_ErrSetASV(m_unitName, _name, __func__));
+	variable->SetValues(_time, _values.data());
+}
+
+CArrayStateVariableHandle CBaseUnit::GetArrayStateVariableHandle(const std::string& _name)
+{
+	if (CArrayStateVariable* variable = m_stateVariables.GetArrayStateVariable(_name))
+		return CArrayStateVariableHandle{ variable };
+	throw std::logic_error(StrConst::BUnit_ErrGetSV(m_unitName, _name, __func__));
+}
+
 const CPlotManager& CBaseUnit::GetPlotsManager() const
 {
 	return m_plots;
@@ -1459,9 +1541,14 @@ void CBaseUnit::RaiseError(const std::string& _message)
 void CBaseUnit::RaiseWarning(const std::string& _message)
 {
 	const std::lock_guard lock(m_messageMutex);
+	const std::string text = !_message.empty() ? _message : StrConst::BUnit_UnknownWarning;
+	if (m_messageHandler)
+	{
+		m_messageHandler(EMessageType::WARNING, text);
+		return;
+	}
 	m_hasWarning = true;
 	const std::string suffix = m_warningMessage.empty() ? "" : "\n";
-	const std::string text = !_message.empty() ? _message : StrConst::BUnit_UnknownWarning;
 	m_warningMessage += suffix + text;
 }
 
@@ -1469,6 +1556,11 @@ void CBaseUnit::ShowInfo(const std::string& _message)
 {
 	const std::lock_guard lock(m_messageMutex);
 	if (_message.empty()) return;
+	if (m_messageHandler)
+	{
+		m_messageHandler(EMessageType::INFO, _message);
+		return;
+	}
 	m_hasInfo = true;
 	const std::string suffix = m_infoMessage.empty() ? "" : "\n";
 	m_infoMessage += suffix + _message;
@@ -1558,6 +1650,12 @@ std::string CBaseUnit::PopInfoMessage()
 	return message;
 }
 
+void CBaseUnit::SetMessageHandler(message_handler_t _handler)
+{
+	const std::lock_guard lock(m_messageMutex);
+	m_messageHandler = std::move(_handler);
+}
+
 void CBaseUnit::DoCreateStructure()
 {
 	m_ports.Clear();
@@ -1570,6 +1668,7 @@ void CBaseUnit::DoCreateStructure()
 
 void CBaseUnit::DoInitializeUnit()
 {
+	PROFILE_SCOPE("Initialize")
 	ClearError();
 	ClearWarning();
 	ClearInfo();
@@ -1586,6 +1685,7 @@ void CBaseUnit::DoInitializeUnit()
 
 void CBaseUnit::DoFinalizeUnit()
 {
+	PROFILE_SCOPE("Finalize")
 	Finalize();
 	for (auto& param : m_unitParameters.GetAllSolverParameters())
 		param->GetSolver()->Finalize();
@@ -1594,6 +1694,7 @@ void CBaseUnit::DoFinalizeUnit()
 
 void CBaseUnit::DoSaveStateUnit(double _timeBeg, double _timeEnd)
 {
+	PROFILE_SCOPE("Save state")
 	SaveState();
 	for (const auto& param : m_unitParameters.GetAllSolverParameters())
 		if (CBaseSolver* solver = param->GetSolver())
@@ -1605,6 +1706,7 @@ void CBaseUnit::DoSaveStateUnit(double _timeBeg, double _timeEnd)
 
 void CBaseUnit::DoLoadStateUnit()
 {
+	PROFILE_SCOPE("Load state")
 	LoadState();
 	for (auto& param : m_unitParameters.GetAllSolverParameters())
 		param->GetSolver()->LoadState();
@@ -1804,6 +1906,8 @@ void CBaseUnit::SaveStateVariables(double _time)
 {
 	for (auto& sv : m_stateVariables.GetAllStateVariables())
 		sv->SetValue(_time, sv->GetValue());
+	for (auto& sv : m_stateVariables.GetAllArrayStateVariables())
+		sv->SetValues(_time, sv->GetValues().data());
 }
 
 void CBaseUnit::AddPointOnCurve(const std::string& _plotName, const std::string& _curveName, const std::vector<double>& _x, const std::vector<double>& _y)
@@ -6,12 +6,15 @@
 
 #include "UnitParametersManager.h"
 #include "AgglomerationSolver.h"
+#include "Agglomeration2DSolver.h"
 #include "PBMSolver.h"
 #include "PlotManager.h"
 #include "UnitPorts.h"
 #include "StateVariable.h"
 #include "StreamManager.h"
+#include "UnitHandles.h"
 #include "DyssolUtilities.h"
+#include <functional>
 #include <mutex>
 
 #ifdef _DEBUG
@@ -58,6 +61,22 @@ class CBaseUnit
 {
 	static constexpr unsigned m_saveVersion{ 4 };	// Current version of the saving procedure.
 
+public:
+	/**
+	 * \private
+	 * \brief Types of messages passed to the message handler.
+	 */
+	enum class EMessageType
+	{
+		WARNING,
+		INFO
+	};
+	/**
+	 * \private
+	 * \brief Function receiving warnings and infos as soon as they are generated.
+	 */
+	using message_handler_t = std::function<void(EMessageType, const std::string&)>;
+
 protected:
 	////////////////////////////////////////////////////////////////////////////////
 	// Basic unit information
@@ -128,6 +147,7 @@ private:
 	std::string m_infoMessage;		// Description of the last info.
 
 	mutable std::mutex m_messageMutex;		// Mutex for thread-safe work with messages.
+	message_handler_t m_messageHandler;		// If set, receives warnings and infos instead of storing them. Called under m_messageMutex.
 
 public:
 	// TODO: initialize all pointers in constructor and make them references.
@@ -189,6 +209,15 @@ public:
 	 */
 	void ConfigureUnitStructures(const CBaseUnit* _other);
 
+	/**
+	 * \private
+	 * \brief Copies all user-defined data from an existing unit of the same type.
+	 * \details Copies the grid, connections of ports, values of unit parameters, feeds, holdups, streams, state variables and plots.
+	 * Own objects created in CreateStructure() are kept and filled with the values, so pointers to them remain valid.
+	 * \param _other Reference to an existing unit.
+	 */
+	void CopyUserData(const CBaseUnit& _other);
+
 	/**
 	 * \private
 	 * \brief Sets new pointer to global materials database.
@@ -693,6 +722,16 @@ public:
 	 * \return Pointer to the added unit parameter.
 	 */
 	CSolverUnitParameter* AddSolverAgglomeration(const std::string& _name, const std::string& _description);
+	/**
+	 * \brief Adds a new two-dimensional agglomeration solver unit parameter to the unit.
+	 * \details Should be used in the CBaseUnit::CreateStructure() function.
+	 * Adds the possibility to choose one of the available two-dimensional agglomeration solvers of this type.
+	 * The name of the parameter should be unique within the unit. If the unit already has a parameter with the same name, logic_error exception is thrown.
+	 * \param _name Name of the unit parameter.
+	 * \param _description Extended parameter description.
+	 * \return Pointer to the added unit parameter.
+	 */
+	CSolverUnitParameter* AddSolverAgglomeration2D(const std::string& _name, const std::string& _description);
 	/**
 	 * \private
 	 * \brief Adds a new PBM solver unit parameter to the unit.
@@ -885,6 +924,20 @@ public:
 	 * \return Pointer to the selected agglomeration solver.
 	 */
 	CAgglomerationSolver* GetSolverAgglomeration(const CSolverUnitParameter* _param) const;
+	/**
+	 * \brief Returns value of the two-dimensional agglomeration solver unit parameter.
+	 * \details Throws logic_error exception if a unit parameter with the given name and type does not exist.
+	 * \param _name Name of the unit parameter.
+	 * \return Pointer to the selected two-dimensional agglomeration solver.
+	 */
+	CAgglomeration2DSolver* GetSolverAgglomeration2D(const std::string& _name) const;
+	/**
+	 * \brief Returns value of the two-dimensional agglomeration solver unit parameter.
+	 * \details Throws logic_error exception if the provided pointer to the unit parameter is of the wrong type.
+	 * \param _param Pointer to the two-dimensional agglomeration solver unit parameter.
+	 * \return Pointer to the selected two-dimensional agglomeration solver.
+	 */
+	CAgglomeration2DSolver* GetSolverAgglomeration2D(const CSolverUnitParameter* _param) const;
 	/**
 	 * \private
 	 * \brief Returns value of the PBM solver unit parameter.
@@ -902,6 +955,27 @@ public:
 	 */
 	CPBMSolver* GetSolverPBM(const CSolverUnitParameter* _param) const;
 
+	/**
+	 * \brief Returns a handle to the unit parameter of the given type.
+	 * \details The handle allows to access the unit parameter without searching for it by name on each call.
+	 * Should be obtained once, e.g. in CBaseUnit::Initialize(), and used during the simulation.
+	 * Throws logic_error exception if a unit parameter with the given name and type does not exist.
+	 * \tparam T Type of the unit parameter.
+	 * \param _name Name of the unit parameter.
+	 * \return Handle to the unit parameter.
+	 */
+	template<typename T>
+	CUnitParameterHandle<T> GetParameterHandle(const std::string& _name) const;
+	/**
+	 * \brief Returns a handle to the real time-dependent unit parameter.
+	 * \details The handle allows to get values of the unit parameter without searching for it by name on each call.
+	 * Should be obtained once, e.g. in CBaseUnit::Initialize(), and used during the simulation.
+	 * Throws logic_error exception if a unit parameter with the given name and type does not exist.
+	 * \param _name Name of the unit parameter.
+	 * \return Handle to the unit parameter.
+	 */
+	CTDParameterHandle GetTDParameterHandle(const std::string& _name) const;
+
 	////////////////////////////////////////////////////////////////////////////////
 	// State variables
 	//
@@ -951,6 +1025,51 @@ public:
 	 * \param _time Time point for which new value is added to the history.
 	 */
 	void SetStateVariable(const std::string& _name, double _value, double _time);
+	/**
+	 * \brief Returns a handle to the state variable.
+	 * \details The handle allows to get and set values of the state variable without searching for it by name on each call.
+	 * Should be obtained once, e.g. in CBaseUnit::Initialize(), and used during the simulation.
+	 * If a state variable with the given name does not exist in this unit, logic_error exception is thrown.
+	 * \param _name Name of the variable.
+	 * \return Handle to the state variable.
+	 */
+	CStateVariableHandle GetStateVariableHandle(const std::string& _name);
+	/**
+	 * \brief Adds a new array state variable.
+	 * \details Array state variables hold several values, which are set simultaneously and share a single history of time points, e.g. a particle size distribution.
+	 * They are automatically saved and restored during the simulation, as scalar state variables.
+	 * The name must by unique within the unit. If the unit already has a state variable with the same name, logic_error exception is thrown.
+	 * Should be used in the CBaseUnit::CreateStructure() or CBaseUnit::Initialize() function.
+	 * \param _name Name of the variable.
+	 * \param _initValues Initial values of the variable. Define the size of the variable.
+	 * \return Pointer to the added state variable.
+	 */
+	CArrayStateVariable* AddArrayStateVariable(const std::string& _name, const std::vector<double>& _initValues);
+	/**
+	 * \brief Returns current values of the array state variable.
+	 * \details If an array state variable with the given name does not exist in this unit, logic_error exception is thrown.
+	 * \param _name Name of the variable.
+	 * \return Current values of the state variable.
+	 */
+	std::vector<double> GetArrayStateVariable(const std::string& _name) const;
+	/**
+	 * \brief Sets new values of the array state variable and adds them to the history.
+	 * \details If an array state variable with the given name does not exist in this unit, logic_error exception is thrown.
+	 * If the number of values does not match the size of the variable, logic_error exception is thrown.
+	 * \param _name Name of the variable.
+	 * \param _values New values of the variable.
+	 * \param _time Time point for which new values are added to the history.
+	 */
+	void SetArrayStateVariable(const std::string& _name, const std::vector<double>& _values, double _time);
+	/**
+	 * \brief Returns a handle to the array state variable.
+	 * \details The handle allows to get and set values of the state variable without searching for it by name on each call.
+	 * Should be obtained once, e.g. in CBaseUnit::Initialize(), and used during the simulation.
+	 * If an array state variable with the given name does not exist in this unit, logic_error exception is thrown.
+	 * \param _name Name of the variable.
+	 * \return Handle to the state variable.
+	 */
+	CArrayStateVariableHandle GetArrayStateVariableHandle(const std::string& _name);
 
 	////////////////////////////////////////////////////////////////////////////////
 	// Plots
@@ -1739,6 +1858,13 @@ public:
 	 */
 	std::string PopInfoMessage();
 
+	/**
+	 * \private
+	 * Sets a function to receive warnings and infos as soon as they are generated, instead of storing them.
+	 * Calls to the handler are serialized, even if messages are generated from several threads. Pass an empty function to restore storing.
+	 */
+	void SetMessageHandler(message_handler_t _handler);
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Simulation-time operations
 	//
@@ -2132,4 +2258,12 @@ void CBaseUnit::AddParametersToGroup(const CComboUnitParameter* _selector, T _se
 	return AddParametersToGroup(_selector, static_cast<size_t>(_selectedValue), _groupedParams);
 }
 
+template <typename T>
+CUnitParameterHandle<T> CBaseUnit::GetParameterHandle(const std::string& _name) const
+{
+	if (const auto* param = dynamic_cast<const T*>(m_unitParameters.GetParameter(_name)))
+		return CUnitParameterHandle<T>{ param };
+	throw std::logic_error(StrConst::BUnit_ErrGetParam(m_unitName, _name, __func__));
+}
+
 typedef DECLDIR CBaseUnit* (*CreateUnit2)();
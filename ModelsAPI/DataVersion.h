@@ -0,0 +1,45 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/*
+ * Version of modifiable data, which allows to detect whether the data have changed since the version was last requested.
+ * Modifications only set a flag. A new version is drawn from a global counter when the version is requested after a modification,
+ * so versions of all objects are unique and grow monotonically. Copies share the version of the original until one of them is modified.
+ * Not thread-safe: the version of an object must not be requested concurrently.
+ */
+class CDataVersion
+{
+	mutable uint64_t m_version{ 0 };	// Last assigned version.
+	mutable bool m_modified{ true };	// Whether the data have been modified since the version was last requested.
+
+public:
+	// Marks the data as modified.
+	void MarkModified()
+	{
+		m_modified = true;
+	}
+
+	// Returns the current version of the data.
+	[[nodiscard]] uint64_t Get() const
+	{
+		if (m_modified)
+		{
+			m_version = Next();
+			m_modified = false;
+		}
+		return m_version;
+	}
+
+private:
+	// Returns a new unique version.
+	static uint64_t Next()
+	{
+		static std::atomic<uint64_t> counter{ 0 };
+		return ++counter;
+	}
+};
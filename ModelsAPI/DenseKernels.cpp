@@ -0,0 +1,246 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "DenseKernels.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	// Number of independent accumulators in reductions, allowing the compiler to vectorize them without reordering floating point operations.
+	constexpr size_t LANES = 4;
+	// Number of values checked at once in comparisons before a possible early exit.
+	constexpr size_t COMPARE_BLOCK = 256;
+
+	// Returns the number of chunks, into which _count items with _work values in total are split for parallel processing.
+	// Items are processed in one chunk if the total work is too small to compensate the overhead of the thread pool.
+	size_t ChunksNumber(size_t _count, size_t _work)
+	{
+		if (_work < DenseKernels::PARALLEL_THRESHOLD) return 1;
+		return std::max(size_t{ 1 }, std::min({ getThreadPool().GetThreadsNumber(), _count, _work / (DenseKernels::PARALLEL_THRESHOLD / 4) }));
+	}
+
+	// Runs _fun(begin, end) for each chunk of _count items, which together contain _work values.
+	template<typename F>
+	void ForChunks(size_t _count, size_t _work, const F& _fun)
+	{
+		const size_t chunks = ChunksNumber(_count, _work);
+		if (chunks == 1)
+		{
+			_fun(size_t{ 0 }, _count);
+			return;
+		}
+		const size_t size = (_count + chunks - 1) / chunks;
+		ParallelFor(chunks, [&](size_t i)
+		{
+			const size_t beg = std::min(i * size, _count);
+			_fun(beg, std::min(beg + size, _count));
+		});
+	}
+
+	// Runs _fun(begin, end) for each chunk of the array and combines partial results of all chunks with _combine.
+	template<typename F, typename C>
+	double Reduce(size_t _len, const F& _fun, const C& _combine)
+	{
+		const size_t chunks = ChunksNumber(_len, _len);
+		if (chunks == 1)
+			return _fun(size_t{ 0 }, _len);
+		const size_t size = (_len + chunks - 1) / chunks;
+		std::vector<double> partial(chunks);
+		ParallelFor(chunks, [&](size_t i)
+		{
+			const size_t beg = std::min(i * size, _len);
+			partial[i] = _fun(beg, std::min(beg + size, _len));
+		});
+		double res = partial.front();
+		for (size_t i = 1; i < chunks; ++i)
+			res = _combine(res, partial[i]);
+		return res;
+	}
+
+	double SumRange(const double* _x, size_t _beg, size_t _end)
+	{
+		double acc[LANES]{};
+		size_t i = _beg;
+		for (; i + LANES <= _end; i += LANES)
+			for (size_t j = 0; j < LANES; ++j)
+				acc[j] += _x[i + j];
+		for (; i < _end; ++i)
+			acc[0] += _x[i];
+		return acc[0] + acc[1] + (acc[2] + acc[3]);
+	}
+
+	double DotRange(const double* _x, const double* _y, size_t _beg, size_t _end)
+	{
+		double acc[LANES]{};
+		size_t i = _beg;
+		for (; i + LANES <= _end; i += LANES)
+			for (size_t j = 0; j < LANES; ++j)
+				acc[j] += _x[i + j] * _y[i + j];
+		for (; i < _end; ++i)
+			acc[0] += _x[i] * _y[i];
+		return acc[0] + acc[1] + (acc[2] + acc[3]);
+	}
+
+	double DotRange(const double* _x, const double* _y, const double* _w, size_t _beg, size_t _end)
+	{
+		double acc[LANES]{};
+		size_t i = _beg;
+		for (; i + LANES <= _end; i += LANES)
+			for (size_t j = 0; j < LANES; ++j)
+				acc[j] += _w[i + j] * _x[i + j] * _y[i + j];
+		for (; i < _end; ++i)
+			acc[0] += _w[i] * _x[i] * _y[i];
+		return acc[0] + acc[1] + (acc[2] + acc[3]);
+	}
+
+	double MaxAbsDiffRange(const double* _x1, const double* _x2, size_t _beg, size_t _end)
+	{
+		double acc[LANES]{};
+		size_t i = _beg;
+		for (; i + LANES <= _end; i += LANES)
+			for (size_t j = 0; j < LANES; ++j)
+			{
+				const double diff = std::fabs(_x1[i + j] - _x2[i + j]);
+				acc[j] = acc[j] < diff ? diff : acc[j];
+			}
+		for (; i < _end; ++i)
+		{
+			const double diff = std::fabs(_x1[i] - _x2[i]);
+			acc[0] = acc[0] < diff ? diff : acc[0];
+		}
+		return std::max(std::max(acc[0], acc[1]), std::max(acc[2], acc[3]));
+	}
+}
+
+void DenseKernels::Axpy(size_t _len, double _a, const double* _x, double* _y)
+{
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+			_y[i] += _a * _x[i];
+	});
+}
+
+void DenseKernels::Scale(size_t _len, double _a, double* _x)
+{
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+			_x[i] *= _a;
+	});
+}
+
+void DenseKernels::Mix(size_t _len, double _w1, const double* _x1, double _w2, const double* _x2, double* _res)
+{
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+			_res[i] = _w1 * _x1[i] + _w2 * _x2[i];
+	});
+}
+
+double DenseKernels::Sum(size_t _len, const double* _x)
+{
+	return Reduce(_len, [&](size_t _beg, size_t _end) { return SumRange(_x, _beg, _end); }, [](double _a, double _b) { return _a + _b; });
+}
+
+double DenseKernels::Dot(size_t _len, const double* _x, const double* _y)
+{
+	return Reduce(_len, [&](size_t _beg, size_t _end) { return DotRange(_x, _y, _beg, _end); }, [](double _a, double _b) { return _a + _b; });
+}
+
+double DenseKernels::Dot(size_t _len, const double* _x, const double* _y, const double* _w)
+{
+	return Reduce(_len, [&](size_t _beg, size_t _end) { return DotRange(_x, _y, _w, _beg, _end); }, [](double _a, double _b) { return _a + _b; });
+}
+
+double DenseKernels::MaxAbsDiff(size_t _len, const double* _x1, const double* _x2)
+{
+	return Reduce(_len, [&](size_t _beg, size_t _end) { return MaxAbsDiffRange(_x1, _x2, _beg, _end); }, [](double _a, double _b) { return std::max(_a, _b); });
+}
+
+bool DenseKernels::AreEqual(size_t _len, const double* _x1, const double* _x2, double _absTol, double _relTol)
+{
+	// checked sequentially in blocks, since usually the first differing block ends the comparison
+	for (size_t beg = 0; beg < _len; beg += COMPARE_BLOCK)
+	{
+		const size_t end = std::min(beg + COMPARE_BLOCK, _len);
+		size_t failed = 0;
+		for (size_t i = beg; i < end; ++i)
+			failed += !(std::fabs(_x1[i] - _x2[i]) < std::fabs(_x1[i]) * _relTol + _absTol);
+		if (failed != 0)
+			return false;
+	}
+	return true;
+}
+
+double DenseKernels::Normalize(size_t _len, double* _x)
+{
+	const double sum = Sum(_len, _x);
+	if (sum == 0.0 || sum == 1.0) return sum;
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+			_x[i] /= sum;
+	});
+	return sum;
+}
+
+void DenseKernels::Normalize(double* _data, size_t _inner, size_t _size, size_t _outer)
+{
+	const size_t block = _inner * _size;
+	if (block == 0) return;
+	ForChunks(_outer, block * _outer, [&](size_t _beg, size_t _end)
+	{
+		std::vector<double> sums(_inner);
+		for (size_t o = _beg; o < _end; ++o)
+		{
+			double* data = _data + o * block;
+			// sums of all slices of this block at once, running over contiguous memory
+			std::fill(sums.begin(), sums.end(), 0.0);
+			for (size_t k = 0; k < _size; ++k)
+				for (size_t i = 0; i < _inner; ++i)
+					sums[i] += data[k * _inner + i];
+			for (size_t i = 0; i < _inner; ++i)
+				sums[i] = sums[i] != 0.0 ? sums[i] : 1.0;
+			for (size_t k = 0; k < _size; ++k)
+				for (size_t i = 0; i < _inner; ++i)
+					data[k * _inner + i] /= sums[i];
+		}
+	});
+}
+
+void DenseKernels::Wegstein(size_t _len, const double* _f2, const double* _f1, const double* _x2, const double* _x1, double _qMin, double _qMax, double _absTol, double _relTol, double* _res)
+{
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+		{
+			const double dx = _x2[i] - _x1[i];
+			const bool converged = std::fabs(dx) <= std::fabs(_x2[i]) * _relTol + _absTol;
+			const double s = (_f2[i] - _f1[i]) / (converged ? 1.0 : dx);
+			double q = s / (s - 1);
+			q = q < _qMin ? _qMin : q > _qMax ? _qMax : q;
+			const double value = q * _x2[i] + (1 - q) * _f2[i];
+			_res[i] = converged ? _f2[i] : value;
+		}
+	});
+}
+
+void DenseKernels::Steffensen(size_t _len, const double* _f3, const double* _f2, const double* _f1, double _absTol, double _relTol, double* _res)
+{
+	ForChunks(_len, _len, [&](size_t _beg, size_t _end)
+	{
+		for (size_t i = _beg; i < _end; ++i)
+		{
+			const double denom = _f3[i] - 2 * _f2[i] + _f1[i];
+			const bool converged = std::fabs(denom) <= std::fabs(denom) * _relTol + _absTol;
+			const double df = _f2[i] - _f1[i];
+			const double value = _f1[i] - df * df / (converged ? 1.0 : denom);
+			_res[i] = converged ? _f3[i] : value;
+		}
+	});
+}
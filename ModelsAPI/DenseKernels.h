@@ -0,0 +1,48 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include <cstddef>
+
+/*
+ * Element-wise operations on contiguous arrays of doubles, used by dense matrices and convergence methods.
+ * All loops run over contiguous memory without branches, so that the compiler can vectorize them.
+ * Arrays longer than PARALLEL_THRESHOLD are split into chunks, which are processed in parallel with the thread pool.
+ * Output arrays may coincide with input arrays, other overlaps are not allowed.
+ */
+namespace DenseKernels
+{
+	// Minimum length of arrays to be processed in parallel.
+	constexpr size_t PARALLEL_THRESHOLD = 1 << 16;
+
+	// Calculates _y = _a * _x + _y.
+	void Axpy(size_t _len, double _a, const double* _x, double* _y);
+	// Calculates _x = _a * _x.
+	void Scale(size_t _len, double _a, double* _x);
+	// Calculates _res = _w1 * _x1 + _w2 * _x2.
+	void Mix(size_t _len, double _w1, const double* _x1, double _w2, const double* _x2, double* _res);
+	// Returns the sum of all values.
+	[[nodiscard]] double Sum(size_t _len, const double* _x);
+	// Returns the dot product of two arrays.
+	[[nodiscard]] double Dot(size_t _len, const double* _x, const double* _y);
+	// Returns the weighted dot product of two arrays: sum of _w * _x * _y.
+	[[nodiscard]] double Dot(size_t _len, const double* _x, const double* _y, const double* _w);
+	// Returns the maximum absolute difference between values of two arrays.
+	[[nodiscard]] double MaxAbsDiff(size_t _len, const double* _x1, const double* _x2);
+	// Checks whether |_x1 - _x2| < |_x1| * _relTol + _absTol holds for all values.
+	[[nodiscard]] bool AreEqual(size_t _len, const double* _x1, const double* _x2, double _absTol, double _relTol);
+
+	// Normalizes all values, so that their sum equals to 1. Does nothing if the sum is 0 or 1. Returns the sum before normalization.
+	double Normalize(size_t _len, double* _x);
+	// Normalizes data arranged as [_inner x _size x _outer] with the first index changing fastest along the middle dimension,
+	// so that the sum of each of _inner * _outer slices of length _size equals to 1. Slices with zero sum remain unchanged.
+	void Normalize(double* _data, size_t _inner, size_t _size, size_t _outer);
+
+	// Calculates Wegstein update _res = q * _x2 + (1 - q) * _f2, with s = (_f2 - _f1) / (_x2 - _x1) and q = s / (s - 1) limited to [_qMin, _qMax].
+	// Values, for which |_x2 - _x1| <= |_x2| * _relTol + _absTol, are taken from _f2.
+	void Wegstein(size_t _len, const double* _f2, const double* _f1, const double* _x2, const double* _x1, double _qMin, double _qMax, double _absTol, double _relTol, double* _res);
+	// Calculates Steffensen update _res = _f1 - (_f2 - _f1)^2 / (_f3 - 2 * _f2 + _f1).
+	// Values, for which the denominator is within tolerances, are taken from _f3.
+	void Steffensen(size_t _len, const double* _f3, const double* _f2, const double* _f1, double _absTol, double _relTol, double* _res);
+}
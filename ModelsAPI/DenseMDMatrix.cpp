@@ -1,6 +1,7 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "DenseMDMatrix.h"
+#include "DenseKernels.h"
 #include "DyssolUtilities.h"
 #include <functional>
 
@@ -286,7 +287,49 @@ bool CDenseMDMatrix::IsNormalized()
 
 void CDenseMDMatrix::Normalize()
 {
-	::Normalize(m_vData);
+	DenseKernels::Normalize(m_vData.size(), m_vData.data());
+}
+
+bool CDenseMDMatrix::Normalize(unsigned _nDim)
+{
+	const auto it = std::find(m_vDimensions.begin(), m_vDimensions.end(), _nDim);
+	if (it == m_vDimensions.end()) return false;
+	const size_t iDim = std::distance(m_vDimensions.begin(), it);
+	// the first dimension changes fastest
+	const size_t inner = std::accumulate(m_vClasses.begin(), m_vClasses.begin() + iDim, size_t{ 1 }, std::multiplies<>());
+	const size_t outer = std::accumulate(m_vClasses.begin() + iDim + 1, m_vClasses.end(), size_t{ 1 }, std::multiplies<>());
+	DenseKernels::Normalize(m_vData.data(), inner, m_vClasses[iDim], outer);
+	return true;
+}
+
+bool CDenseMDMatrix::HasSameDimensions(const CDenseMDMatrix& _matrix) const
+{
+	return m_vDimensions == _matrix.m_vDimensions && m_vClasses == _matrix.m_vClasses;
+}
+
+double CDenseMDMatrix::GetSum() const
+{
+	return DenseKernels::Sum(m_vData.size(), m_vData.data());
+}
+
+bool CDenseMDMatrix::Axpy(double _dFactor, const CDenseMDMatrix& _matrix)
+{
+	if (!HasSameDimensions(_matrix)) return false;
+	DenseKernels::Axpy(m_vData.size(), _dFactor, _matrix.m_vData.data(), m_vData.data());
+	return true;
+}
+
+CDenseMDMatrix CDenseMDMatrix::Mix(double _dWeight1, const CDenseMDMatrix& _matrix1, double _dWeight2, const CDenseMDMatrix& _matrix2)
+{
+	if (!_matrix1.HasSameDimensions(_matrix2)) return {};
+	CDenseMDMatrix res(_matrix1.m_vDimensions, _matrix1.m_vClasses);
+	DenseKernels::Mix(res.m_vData.size(), _dWeight1, _matrix1.m_vData.data(), _dWeight2, _matrix2.m_vData.data(), res.m_vData.data());
+	return res;
+}
+
+bool CDenseMDMatrix::IsEqual(const CDenseMDMatrix& _matrix, double _dAbsTol, double _dRelTol) const
+{
+	return HasSameDimensions(_matrix) && DenseKernels::AreEqual(m_vData.size(), m_vData.data(), _matrix.m_vData.data(), _dAbsTol, _dRelTol);
 }
 
 bool CDenseMDMatrix::CheckDuplicates(const std::vector<unsigned>& _vDims) const
@@ -496,38 +539,19 @@ bool CDenseMDMatrix::GetVectorValueRecursive(std::vector<unsigned> _vDims, std::
 	return false;
 }
 
-CDenseMDMatrix CDenseMDMatrix::operator+(const CDenseMDMatrix& _matrix)
+CDenseMDMatrix CDenseMDMatrix::operator+(const CDenseMDMatrix& _matrix) const
 {
-	if (m_vDimensions.size() != _matrix.m_vDimensions.size())
-		return CDenseMDMatrix();
-	for (size_t i = 0; i < m_vDimensions.size(); ++i)
-		if ((m_vDimensions[i] != _matrix.m_vDimensions[i]) || (m_vClasses[i] != _matrix.m_vClasses[i]))
-			return CDenseMDMatrix();
-
-	CDenseMDMatrix sum;
-	sum.SetDimensions(m_vDimensions, m_vClasses);
-	std::transform(m_vData.begin(), m_vData.end(), _matrix.m_vData.begin(), sum.m_vData.begin(), std::plus<>());
-	return sum;
+	return Mix(1.0, *this, 1.0, _matrix);
 }
 
-CDenseMDMatrix CDenseMDMatrix::operator-(const CDenseMDMatrix& _matrix)
+CDenseMDMatrix CDenseMDMatrix::operator-(const CDenseMDMatrix& _matrix) const
 {
-	if (m_vDimensions.size() != _matrix.m_vDimensions.size())
-		return CDenseMDMatrix();
-	for (unsigned i = 0; i < m_vDimensions.size(); ++i)
-		if ((m_vDimensions[i] != _matrix.m_vDimensions[i]) || (m_vClasses[i] != _matrix.m_vClasses[i]))
-			return CDenseMDMatrix();
-
-	CDenseMDMatrix diff;
-	diff.SetDimensions(m_vDimensions, m_vClasses);
-	std::transform(m_vData.begin(), m_vData.end(), _matrix.m_vData.begin(), diff.m_vData.begin(), std::minus<>());
-	return diff;
+	return Mix(1.0, *this, -1.0, _matrix);
 }
 
-CDenseMDMatrix CDenseMDMatrix::operator*(double _dFactor)
+CDenseMDMatrix CDenseMDMatrix::operator*(double _dFactor) const
 {
-	CDenseMDMatrix prod;
-	prod.SetDimensions(m_vDimensions, m_vClasses);
-	std::transform(m_vData.begin(), m_vData.end(), prod.m_vData.begin(), [_dFactor](const double v) { return v * _dFactor; });
+	CDenseMDMatrix prod{ *this };
+	DenseKernels::Scale(prod.m_vData.size(), _dFactor, prod.m_vData.data());
 	return prod;
 }
@@ -334,6 +334,55 @@ public:
 	 * \brief Normalizes the matrix so that the sum of all elements equals to 1.
 	 */
 	void Normalize();
+	/**
+	 * \brief Normalizes the matrix along the given dimension.
+	 * \details After normalization, the sum of values along the dimension equals to 1 for each combination of coordinates of other dimensions.
+	 * Slices with zero sum remain unchanged. Type is one of the #EDistrTypes.
+	 * \param _nDim Distribution type.
+	 * \return Error flag.
+	 */
+	bool Normalize(unsigned _nDim);
+
+	// ========== Arithmetic
+
+	/**
+	 * \brief Checks whether the matrix has the same dimensions and numbers of classes as the given one.
+	 * \param _matrix Other matrix.
+	 * \return Whether dimensions are the same.
+	 */
+	bool HasSameDimensions(const CDenseMDMatrix& _matrix) const;
+	/**
+	 * \brief Returns the sum of all elements.
+	 * \return Sum of all elements.
+	 */
+	double GetSum() const;
+	/**
+	 * \brief Adds another matrix multiplied by a coefficient to this matrix: this = this + _dFactor * _matrix.
+	 * \details If dimensions are not the same, the matrix is not changed.
+	 * \param _dFactor Coefficient.
+	 * \param _matrix Other matrix.
+	 * \return Error flag.
+	 */
+	bool Axpy(double _dFactor, const CDenseMDMatrix& _matrix);
+	/**
+	 * \brief Returns weighted sum of two matrices: _dWeight1 * _matrix1 + _dWeight2 * _matrix2.
+	 * \details If dimensions are not the same, the empty matrix will be returned.
+	 * \param _dWeight1 Weight of the first matrix.
+	 * \param _matrix1 First matrix.
+	 * \param _dWeight2 Weight of the second matrix.
+	 * \param _matrix2 Second matrix.
+	 * \return Weighted sum.
+	 */
+	static CDenseMDMatrix Mix(double _dWeight1, const CDenseMDMatrix& _matrix1, double _dWeight2, const CDenseMDMatrix& _matrix2);
+	/**
+	 * \brief Checks whether all elements of the matrix are equal to the elements of another matrix within the given tolerances.
+	 * \details Elements are equal, if |this - _matrix| < |this| * _dRelTol + _dAbsTol. Matrices with different dimensions are not equal.
+	 * \param _matrix Other matrix.
+	 * \param _dAbsTol Absolute tolerance.
+	 * \param _dRelTol Relative tolerance.
+	 * \return Whether matrices are equal.
+	 */
+	bool IsEqual(const CDenseMDMatrix& _matrix, double _dAbsTol, double _dRelTol) const;
 
 	// ========== Overloaded operators
 
@@ -342,20 +391,20 @@ public:
 	 * \details If dimensions are not the same, than the empty matrix will be returned.
 	 * \param _matrix Other matrix.
 	 */
-	CDenseMDMatrix operator+( const CDenseMDMatrix& _matrix );
+	CDenseMDMatrix operator+( const CDenseMDMatrix& _matrix ) const;
 	/**
 	 * \brief Subtracts matrix with the same dimensions.
 	 * \details If dimensions are not the same, than the empty matrix will be returned.
 	 * \param _matrix Other matrix.
 	 */
-	CDenseMDMatrix operator-( const CDenseMDMatrix& _matrix );
+	CDenseMDMatrix operator-( const CDenseMDMatrix& _matrix ) const;
 
 	/**
 	 * \brief Multiplication of the matrix by a coefficient.
 	 * \details
 	 * \param _dFactor Coefficient.
 	 */
-	CDenseMDMatrix operator*( double _dFactor );
+	CDenseMDMatrix operator*( double _dFactor ) const;
 
 
 private:
@@ -30,6 +30,25 @@ double CDependentValues::GetValue(double _param) const
 	return ::Interpolate(m_params, m_values, _param);	// return interpolation otherwise
 }
 
+double CDependentValues::GetValue(double _param, size_t& _hint) const
+{
+	if (m_values.empty()) return 0;						// return zero, if there are no data at all
+	if (m_values.size() == 1) return m_values.front();	// return const value, if there is only a single value defined
+	// check whether the parameter is still within the previously found interval [lower, upper)
+	if (_hint + 1 >= m_params.size() || _param < m_params[_hint] || _param >= m_params[_hint + 1])
+	{
+		const auto upper = std::upper_bound(m_params.begin(), m_params.end(), _param);
+		if (upper == m_params.end())   return m_values.back();	// nearest-neighbor extrapolation to the right
+		if (upper == m_params.begin()) return m_values.front();	// nearest-neighbor extrapolation to the left
+		_hint = static_cast<size_t>(std::distance(m_params.begin(), upper)) - 1;
+	}
+	const double lowerX = m_params[_hint];
+	const double upperX = m_params[_hint + 1];
+	if (std::abs(upperX - _param) <= m_eps) return m_values[_hint + 1];	// exact value found
+	if (std::abs(lowerX - _param) <= m_eps) return m_values[_hint];		// exact value found
+	return ::Interpolate(lowerX, upperX, m_values[_hint], m_values[_hint + 1], _param);
+}
+
 void CDependentValues::SetValue(double _param, double _value)
 {
 	const auto pos = std::lower_bound(m_params.begin(), m_params.end(), _param);
@@ -28,6 +28,8 @@ public:
 
 	// Returns linearly interpolated value, which corresponds to a specified parameter. Performs nearest-neighbor extrapolation of data: if specified parameter lays out of the limits, returns value at the nearest limit. Returns 0, if there are no data at all.
 	[[nodiscard]] double GetValue(double _param) const;
+	// Returns the same value as GetValue(double), starting the search from the interval with index _hint. Updates _hint with the index of the found interval. Allows to speed up consecutive requests for close parameters.
+	[[nodiscard]] double GetValue(double _param, size_t& _hint) const;
 	// Sets new point of [_param:_value] to the list. If the specified parameter has already been defined, overwrites its value.
 	void SetValue(double _param, double _value);
 	// Sets new points of [_params:_values] to the list. If the specified parameter has already been defined, overwrites its value. _params and _values must have the same size.
@@ -0,0 +1,291 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "GridTransfer.h"
+#include "ContainerFunctions.h"
+#include "DyssolUtilities.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <numeric>
+
+namespace
+{
+	// Maximum number of cached operators of each grid type.
+	constexpr size_t CACHE_SIZE = 64;
+
+	// Operators shared by all users with identical numeric grids.
+	std::map<std::pair<std::vector<double>, std::vector<double>>, std::shared_ptr<const CDimensionTransfer>> numericCache;
+	// Operators shared by all users with identical symbolic grids.
+	std::map<std::pair<std::vector<std::string>, std::vector<std::string>>, std::shared_ptr<const CDimensionTransfer>> symbolicCache;
+	std::mutex cacheMutex;
+
+	// Returns an operator from the cache or creates and caches a new one.
+	template<typename T>
+	std::shared_ptr<const CDimensionTransfer> GetCached(std::map<std::pair<std::vector<T>, std::vector<T>>, std::shared_ptr<const CDimensionTransfer>>& _cache, const std::vector<T>& _srcGrid, const std::vector<T>& _dstGrid)
+	{
+		auto key = std::make_pair(_srcGrid, _dstGrid);
+		{
+			std::lock_guard lock{ cacheMutex };
+			if (const auto it = _cache.find(key); it != _cache.end())
+				return it->second;
+		}
+		auto transfer = std::make_shared<const CDimensionTransfer>(_srcGrid, _dstGrid);
+		std::lock_guard lock{ cacheMutex };
+		if (_cache.size() >= CACHE_SIZE)
+			_cache.clear();
+		_cache[std::move(key)] = transfer;
+		return transfer;
+	}
+}
+
+CDimensionTransfer::CDimensionTransfer(const std::vector<double>& _srcGrid, const std::vector<double>& _dstGrid)
+	: m_srcSize{ _srcGrid.empty() ? 0 : _srcGrid.size() - 1 }
+	, m_dstSize{ _dstGrid.empty() ? 0 : _dstGrid.size() - 1 }
+{
+	m_offsets.push_back(0);
+	if (m_dstSize == 0)
+	{
+		m_offsets.resize(m_srcSize + 1, 0);
+		return;
+	}
+	const size_t n = m_dstSize;
+	for (size_t j = 0; j < m_srcSize; ++j)
+	{
+		const double a = _srcGrid[j];
+		const double b = _srcGrid[j + 1];
+		// index of the first target class which may overlap with the source class
+		const size_t iStart = std::min(static_cast<size_t>(std::max<ptrdiff_t>(std::upper_bound(_dstGrid.begin(), _dstGrid.end(), a) - _dstGrid.begin() - 1, 0)), n - 1);
+		const size_t first = m_targets.size();
+		if (b <= a) // degenerated class - transfer into the containing one
+		{
+			m_targets.push_back(iStart);
+			m_weights.push_back(1.0);
+			m_offsets.push_back(m_targets.size());
+			continue;
+		}
+		const auto add = [&](size_t _i, double _length)
+		{
+			if (_length <= 0) return;
+			if (m_targets.size() > first && m_targets.back() == _i)	m_weights.back() += _length;
+			else
+			{
+				m_targets.push_back(_i);
+				m_weights.push_back(_length);
+			}
+		};
+		// below the target grid
+		add(0, std::min(b, _dstGrid.front()) - a);
+		// overlapping classes
+		for (size_t i = iStart; i < n && _dstGrid[i] < b; ++i)
+			add(i, std::min(b, _dstGrid[i + 1]) - std::max(a, _dstGrid[i]));
+		// above the target grid
+		add(n - 1, b - std::max(a, _dstGrid.back()));
+		// normalize, so that the whole mass of the source class is transferred
+		const double sum = std::accumulate(m_weights.begin() + first, m_weights.end(), 0.0);
+		for (size_t k = first; k < m_weights.size(); ++k)
+			m_weights[k] /= sum;
+		m_offsets.push_back(m_targets.size());
+	}
+}
+
+CDimensionTransfer::CDimensionTransfer(const std::vector<std::string>& _srcGrid, const std::vector<std::string>& _dstGrid)
+	: m_srcSize{ _srcGrid.size() }
+	, m_dstSize{ _dstGrid.size() }
+{
+	m_offsets.push_back(0);
+	for (const auto& name : _srcGrid)
+	{
+		const size_t i = VectorFind(_dstGrid, name);
+		if (i < _dstGrid.size())
+		{
+			m_targets.push_back(i);
+			m_weights.push_back(1.0);
+		}
+		m_offsets.push_back(m_targets.size());
+	}
+}
+
+CDimensionTransfer CDimensionTransfer::Summation(size_t _srcSize)
+{
+	CDimensionTransfer res;
+	res.m_srcSize = _srcSize;
+	res.m_dstSize = 1;
+	res.m_offsets.resize(_srcSize + 1);
+	std::iota(res.m_offsets.begin(), res.m_offsets.end(), size_t{ 0 });
+	res.m_targets.resize(_srcSize, 0);
+	res.m_weights.resize(_srcSize, 1.0);
+	return res;
+}
+
+std::shared_ptr<const CDimensionTransfer> CDimensionTransfer::Get(const std::vector<double>& _srcGrid, const std::vector<double>& _dstGrid)
+{
+	return GetCached(numericCache, _srcGrid, _dstGrid);
+}
+
+std::shared_ptr<const CDimensionTransfer> CDimensionTransfer::Get(const std::vector<std::string>& _srcGrid, const std::vector<std::string>& _dstGrid)
+{
+	return GetCached(symbolicCache, _srcGrid, _dstGrid);
+}
+
+std::shared_ptr<const CDimensionTransfer> CDimensionTransfer::Get(const CGridDimension& _srcGrid, const CGridDimension& _dstGrid)
+{
+	if (_srcGrid.GridType() != _dstGrid.GridType()) return nullptr;
+	if (_srcGrid.GridType() == EGridEntry::GRID_NUMERIC)
+		return Get(dynamic_cast<const CGridDimensionNumeric&>(_srcGrid).Grid(), dynamic_cast<const CGridDimensionNumeric&>(_dstGrid).Grid());
+	return Get(dynamic_cast<const CGridDimensionSymbolic&>(_srcGrid).Grid(), dynamic_cast<const CGridDimensionSymbolic&>(_dstGrid).Grid());
+}
+
+size_t CDimensionTransfer::SourceSize() const
+{
+	return m_srcSize;
+}
+
+size_t CDimensionTransfer::TargetSize() const
+{
+	return m_dstSize;
+}
+
+std::vector<std::pair<size_t, double>> CDimensionTransfer::GetWeights(size_t _iSrc) const
+{
+	std::vector<std::pair<size_t, double>> res;
+	if (_iSrc >= m_srcSize) return res;
+	for (size_t k = m_offsets[_iSrc]; k < m_offsets[_iSrc + 1]; ++k)
+		res.emplace_back(m_targets[k], m_weights[k]);
+	return res;
+}
+
+std::vector<double> CDimensionTransfer::Apply(const std::vector<double>& _values) const
+{
+	std::vector<double> res(m_dstSize, 0.0);
+	if (_values.size() != m_srcSize) return res;
+	Apply(_values.data(), res.data());
+	return res;
+}
+
+CDenseMDMatrix CDimensionTransfer::Apply(const CDenseMDMatrix& _matrix, EDistrTypes _dim) const
+{
+	const auto types = _matrix.GetDimensions();
+	auto sizes = _matrix.GetClasses();
+	const size_t k = VectorFind(types, static_cast<unsigned>(_dim));
+	if (k >= types.size() || sizes[k] != m_srcSize) return {};
+	const size_t inner = std::accumulate(sizes.begin(), sizes.begin() + k, size_t{ 1 }, std::multiplies<>{});
+	const size_t outer = std::accumulate(sizes.begin() + k + 1, sizes.end(), size_t{ 1 }, std::multiplies<>{});
+	sizes[k] = static_cast<unsigned>(m_dstSize);
+	CDenseMDMatrix res{ types, sizes };
+	if (res.GetDataLength() == 0) return res;
+	Apply(_matrix.GetDataPtr(), res.GetDataPtr(), inner, outer);
+	return res;
+}
+
+void CDimensionTransfer::Apply(const double* _src, double* _dst, size_t _inner, size_t _outer) const
+{
+	std::fill(_dst, _dst + _inner * m_dstSize * _outer, 0.0);
+	for (size_t o = 0; o < _outer; ++o)
+		for (size_t j = 0; j < m_srcSize; ++j)
+		{
+			const double* src = _src + (o * m_srcSize + j) * _inner;
+			for (size_t k = m_offsets[j]; k < m_offsets[j + 1]; ++k)
+			{
+				// contiguous slice along all faster dimensions
+				const double w = m_weights[k];
+				double* dst = _dst + (o * m_dstSize + m_targets[k]) * _inner;
+				for (size_t i = 0; i < _inner; ++i)
+					dst[i] += w * src[i];
+			}
+		}
+}
+
+CGridTransfer::CGridTransfer(const CMultidimensionalGrid& _srcGrid, const CMultidimensionalGrid& _dstGrid)
+	: m_srcGrid{ _srcGrid }
+	, m_dstGrid{ _dstGrid }
+	, m_identity{ _srcGrid == _dstGrid }
+{
+	for (const auto* srcDim : m_srcGrid.GetGridDimensions())
+	{
+		SDimension dim;
+		dim.type = srcDim->DimensionType();
+		const auto* dstDim = m_dstGrid.GetGridDimension(dim.type);
+		if (dstDim)
+		{
+			dim.identity = *dstDim == *srcDim;
+			dim.transfer = CDimensionTransfer::Get(*srcDim, *dstDim);
+		}
+		if (!dim.transfer) // not in the target grid - sum up
+			dim.transfer = std::make_shared<const CDimensionTransfer>(CDimensionTransfer::Summation(srcDim->ClassesNumber()));
+		m_dims.push_back(std::move(dim));
+	}
+}
+
+bool CGridTransfer::IsFor(const CMultidimensionalGrid& _srcGrid, const CMultidimensionalGrid& _dstGrid) const
+{
+	return m_srcGrid == _srcGrid && m_dstGrid == _dstGrid;
+}
+
+CDenseMDMatrix CGridTransfer::Apply(const CDenseMDMatrix& _distr) const
+{
+	if (m_identity) return _distr;
+
+	const auto dstTypes = vector_cast<unsigned>(m_dstGrid.GetDimensionsTypes());
+	const auto dstSizes = vector_cast<unsigned>(m_dstGrid.GetClassesNumbers());
+	CDenseMDMatrix res{ dstTypes, dstSizes };
+	if (res.GetDataLength() == 0) return res;
+
+	// current data and its layout, the first dimension changes fastest
+	const auto srcTypes = _distr.GetDimensions();
+	std::vector<size_t> sizes = vector_cast<size_t>(_distr.GetClasses());
+	std::vector<double> data(_distr.GetDataPtr(), _distr.GetDataPtr() + _distr.GetDataLength());
+	if (data.empty()) return res;
+
+	// transfer along each dimension of the source distribution
+	std::vector<const SDimension*> dims(srcTypes.size());
+	for (size_t k = 0; k < srcTypes.size(); ++k)
+	{
+		const auto it = std::find_if(m_dims.begin(), m_dims.end(), [&](const SDimension& _d) { return _d.type == static_cast<EDistrTypes>(srcTypes[k]); });
+		if (it == m_dims.end() || it->transfer->SourceSize() != sizes[k]) return res; // distribution does not match the source grid
+		dims[k] = &*it;
+		if (it->identity) continue;
+		const size_t inner = std::accumulate(sizes.begin(), sizes.begin() + k, size_t{ 1 }, std::multiplies<>{});
+		const size_t outer = std::accumulate(sizes.begin() + k + 1, sizes.end(), size_t{ 1 }, std::multiplies<>{});
+		std::vector<double> next(inner * it->transfer->TargetSize() * outer);
+		it->transfer->Apply(data.data(), next.data(), inner, outer);
+		data = std::move(next);
+		sizes[k] = it->transfer->TargetSize();
+	}
+
+	// strides of the transferred data
+	std::vector<size_t> strides(sizes.size(), 1);
+	for (size_t k = 1; k < sizes.size(); ++k)
+		strides[k] = strides[k - 1] * sizes[k - 1];
+
+	// for each target dimension, stride in the transferred data, or 0 if the dimension is filled uniformly
+	std::vector<size_t> dstStrides(dstTypes.size(), 0);
+	double factor = 1.0;
+	for (size_t j = 0; j < dstTypes.size(); ++j)
+	{
+		const size_t k = VectorFind(srcTypes, dstTypes[j]);
+		if (k < srcTypes.size() && dims[k]->transfer->TargetSize() == dstSizes[j])
+			dstStrides[j] = strides[k];
+		else
+			factor /= dstSizes[j];
+	}
+
+	// rearrange into the order of the target grid
+	double* out = res.GetDataPtr();
+	std::vector<size_t> coords(dstTypes.size(), 0);
+	size_t offset = 0;
+	for (size_t i = 0; i < res.GetDataLength(); ++i)
+	{
+		out[i] = data[offset] * factor;
+		// increment coordinates, the first dimension changes fastest
+		for (size_t j = 0; j < coords.size(); ++j)
+		{
+			offset += dstStrides[j];
+			if (++coords[j] < dstSizes[j]) break;
+			offset -= dstStrides[j] * coords[j];
+			coords[j] = 0;
+		}
+	}
+
+	return res;
+}
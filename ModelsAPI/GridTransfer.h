@@ -0,0 +1,90 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "MultidimensionalGrid.h"
+#include "DenseMDMatrix.h"
+#include <memory>
+
+/*
+ * Conservative transfer of a distribution along one dimension from a source grid to a target grid.
+ * Weights are calculated once on construction and stored sparsely, grouped by source classes.
+ * For numeric grids, each source class distributes its mass to the overlapping target classes proportionally to the overlap length.
+ * Mass outside the target grid is added to the first or last target class, so the total mass is conserved.
+ * For symbolic grids, mass is transferred between classes with equal names. Mass of classes missing in the target grid is lost.
+ * Operators for the same pair of grids can be shared with Get().
+ */
+class CDimensionTransfer
+{
+	size_t m_srcSize{};				// Number of classes in the source grid.
+	size_t m_dstSize{};				// Number of classes in the target grid.
+	std::vector<size_t> m_offsets;	// Start of weights of each source class in m_targets and m_weights, size m_srcSize + 1.
+	std::vector<size_t> m_targets;	// Target class of each weight.
+	std::vector<double> m_weights;	// Fraction of the source class transferred to the target class.
+
+public:
+	CDimensionTransfer() = default;
+	// Creates a transfer operator between two numeric grids, given as class boundaries.
+	CDimensionTransfer(const std::vector<double>& _srcGrid, const std::vector<double>& _dstGrid);
+	// Creates a transfer operator between two symbolic grids.
+	CDimensionTransfer(const std::vector<std::string>& _srcGrid, const std::vector<std::string>& _dstGrid);
+
+	// Creates an operator that sums up all source classes into one target class.
+	[[nodiscard]] static CDimensionTransfer Summation(size_t _srcSize);
+
+	// Returns a shared operator between two numeric grids. Operators are cached, so all callers with the same grids reuse one instance.
+	[[nodiscard]] static std::shared_ptr<const CDimensionTransfer> Get(const std::vector<double>& _srcGrid, const std::vector<double>& _dstGrid);
+	// Returns a shared operator between two symbolic grids. Operators are cached, so all callers with the same grids reuse one instance.
+	[[nodiscard]] static std::shared_ptr<const CDimensionTransfer> Get(const std::vector<std::string>& _srcGrid, const std::vector<std::string>& _dstGrid);
+	// Returns a shared operator between two grid dimensions. Returns nullptr if the grids are of different types.
+	[[nodiscard]] static std::shared_ptr<const CDimensionTransfer> Get(const CGridDimension& _srcGrid, const CGridDimension& _dstGrid);
+
+	// Returns the number of classes in the source grid.
+	[[nodiscard]] size_t SourceSize() const;
+	// Returns the number of classes in the target grid.
+	[[nodiscard]] size_t TargetSize() const;
+	// Returns target classes and fractions of the source class, to which its mass is transferred.
+	[[nodiscard]] std::vector<std::pair<size_t, double>> GetWeights(size_t _iSrc) const;
+
+	// Transfers the vector of values defined on the source grid to the target grid.
+	[[nodiscard]] std::vector<double> Apply(const std::vector<double>& _values) const;
+	// Transfers the dense matrix along the given dimension. Other dimensions remain unchanged. Returns an empty matrix if the dimension is not found or has wrong size.
+	[[nodiscard]] CDenseMDMatrix Apply(const CDenseMDMatrix& _matrix, EDistrTypes _dim) const;
+	// Transfers data arranged as [_inner x SourceSize() x _outer] with the first index changing fastest into [_inner x TargetSize() x _outer].
+	// _dst must hold _inner * TargetSize() * _outer values. All slices along the transferred dimension are processed at once.
+	void Apply(const double* _src, double* _dst, size_t _inner = 1, size_t _outer = 1) const;
+};
+
+/*
+ * Conservative transfer of multidimensional distributions from one grid to another.
+ * Each dimension is transferred with a shared CDimensionTransfer, so the weights are calculated once for each pair of grids and dimension.
+ * Dimensions missing in the target grid are summed up, dimensions missing in the source grid are filled uniformly.
+ */
+class CGridTransfer
+{
+	// Transfer of a single dimension of the source grid.
+	struct SDimension
+	{
+		EDistrTypes type{ DISTR_UNDEFINED };				// Type of the dimension.
+		bool identity{ false };								// Whether the dimension is not changed.
+		std::shared_ptr<const CDimensionTransfer> transfer;	// Transfer operator.
+	};
+
+	CMultidimensionalGrid m_srcGrid;	// Source grid.
+	CMultidimensionalGrid m_dstGrid;	// Target grid.
+
+	std::vector<SDimension> m_dims;		// Transfers of all dimensions of the source grid in the order of the source grid.
+	bool m_identity{ false };			// Whether the grids are equal.
+
+public:
+	CGridTransfer() = default;
+	// Creates a transfer operator between the given grids.
+	CGridTransfer(const CMultidimensionalGrid& _srcGrid, const CMultidimensionalGrid& _dstGrid);
+
+	// Checks whether the operator was created for the given grids.
+	[[nodiscard]] bool IsFor(const CMultidimensionalGrid& _srcGrid, const CMultidimensionalGrid& _dstGrid) const;
+
+	// Transfers the distribution defined on the source grid to the target grid. The distribution must have all dimensions of the source grid.
+	[[nodiscard]] CDenseMDMatrix Apply(const CDenseMDMatrix& _distr) const;
+};
@@ -4,6 +4,7 @@
 #include "ContainerFunctions.h"
 #include "DyssolStringConstants.h"
 #include <cmath>
+#include <numeric>
 
 CMDMatrix::CMDMatrix(const CMDMatrix& _other) :
 	m_vDimensions{ _other.m_vDimensions },
@@ -29,6 +30,7 @@ CMDMatrix::~CMDMatrix()
 
 void CMDMatrix::Clear()
 {
+	m_version.MarkModified();
 	RemoveAllTimePoints();
 	m_vDimensions.clear();
 	m_vClasses.clear();
@@ -37,6 +39,7 @@ void CMDMatrix::Clear()
 
 void CMDMatrix::AddDimension(unsigned _nDim, unsigned _nClasses)
 {
+	m_version.MarkModified();
 	for( unsigned i=0; i<m_vDimensions.size(); ++i )
 		if( m_vDimensions[i] == _nDim ) // dimension already exists
 			return;
@@ -54,6 +57,7 @@ void CMDMatrix::AddDimension(unsigned _nDim, unsigned _nClasses)
 
 void CMDMatrix::DeleteDimension(unsigned _nDim)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims;
 	vDims.push_back( _nDim );
 	DeleteDimensions( vDims );
@@ -61,6 +65,7 @@ void CMDMatrix::DeleteDimension(unsigned _nDim)
 
 void CMDMatrix::DeleteDimensions(const std::vector<unsigned>& _vDims)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDimsToKeep;
 	std::vector<unsigned> vClassesToKeep;
 	m_pSortMatr = new CMDMatrix();
@@ -85,6 +90,7 @@ std::vector<unsigned> CMDMatrix::GetClasses() const
 
 void CMDMatrix::SetDimension(unsigned _nDim, unsigned _nClasses)
 {
+	m_version.MarkModified();
 	if( !m_vDimensions.empty() )
 		Clear();
 	m_vDimensions.push_back( _nDim );
@@ -93,6 +99,7 @@ void CMDMatrix::SetDimension(unsigned _nDim, unsigned _nClasses)
 
 void CMDMatrix::SetDimensions(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vClasses)
 {
+	m_version.MarkModified();
 	if( _vDims.size() != _vClasses.size() ) // wrong input data
 		return;
 
@@ -140,6 +147,7 @@ unsigned CMDMatrix::GetDimensionSizeByType(unsigned _nDim) const
 
 void CMDMatrix::UpdateDimensions(const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vClasses)
 {
+	m_version.MarkModified();
 	if( _vDims.size() != _vClasses.size() )
 		return;
 
@@ -276,6 +284,7 @@ void CMDMatrix::UpdateDimensions(const std::vector<unsigned>& _vDims, const std:
 
 void CMDMatrix::AddClass(unsigned _nDim)
 {
+	m_version.MarkModified();
 	for( unsigned i=0; i<m_vDimensions.size(); ++i )
 	{
 		if( m_vDimensions[i] == _nDim )
@@ -293,6 +302,7 @@ void CMDMatrix::AddClass(unsigned _nDim)
 
 void CMDMatrix::RemoveClass(unsigned _nDim, size_t _nClassIndex)
 {
+	m_version.MarkModified();
 	const size_t iDim = VectorFind(m_vDimensions, _nDim);
 	if (iDim == static_cast<size_t>(-1)) return;
 	if (_nClassIndex >= m_vClasses[iDim]) return;
@@ -325,6 +335,7 @@ bool CMDMatrix::CompareDims(const CMDMatrix& _matr) const
 
 void CMDMatrix::AddTimePoint(double _dTime, double _dSrcTimePoint /*= -1 */)
 {
+	m_version.MarkModified();
 	unsigned index = GetTimeIndex( _dTime, false ); // get new index to insert
 	if( (unsigned)index < m_vTimePoints.size() )
 		if( m_vTimePoints[index] == _dTime ) // time point already exists
@@ -353,8 +364,45 @@ void CMDMatrix::AddTimePoint(double _dTime, double _dSrcTimePoint /*= -1 */)
 	CheckCacheNeed();
 }
 
+void CMDMatrix::AddTimePoints(const std::vector<double>& _vTimes)
+{
+	m_version.MarkModified();
+	// keep the caching window consistent by adding time points one by one
+	if( m_bCacheEnabled )
+	{
+		for( double t : _vTimes )
+			AddTimePoint( t );
+		return;
+	}
+
+	// merge time points in one pass
+	std::vector<double> vNewTimes;
+	std::vector<double> vRes;
+	vRes.reserve( m_vTimePoints.size() + _vTimes.size() );
+	size_t i = 0;
+	for( double t : _vTimes )
+	{
+		while( ( i < m_vTimePoints.size() ) && ( m_vTimePoints[i] < t ) )
+			vRes.push_back( m_vTimePoints[i++] );
+		if( ( i < m_vTimePoints.size() ) && ( m_vTimePoints[i] == t ) ) // time point already exists
+			continue;
+		if( !vRes.empty() && ( vRes.back() == t ) ) // duplicate in the input
+			continue;
+		vRes.push_back( t );
+		vNewTimes.push_back( t );
+	}
+	if( vNewTimes.empty() )
+		return;
+	vRes.insert( vRes.end(), m_vTimePoints.begin() + i, m_vTimePoints.end() );
+	m_vTimePoints.swap( vRes );
+
+	AddTimePointsRecursive( m_data, vNewTimes );
+	m_nNonCachedTPNum += static_cast<unsigned>(vNewTimes.size());
+}
+
 void CMDMatrix::ChangeTimePoint(unsigned _nTimePointIndex, double _dNewTime)
 {
+	m_version.MarkModified();
 	if ( _nTimePointIndex >= m_vTimePoints.size() )
 		return;
 
@@ -385,6 +433,7 @@ void CMDMatrix::ChangeTimePoint(unsigned _nTimePointIndex, double _dNewTime)
 
 void CMDMatrix::RemoveTimePoint(double _dTime)
 {
+	m_version.MarkModified();
 	unsigned index = GetTimeIndex( _dTime );
 	if( index == -1 ) // no such time point
 		return;
@@ -405,6 +454,7 @@ void CMDMatrix::RemoveTimePoint(double _dTime)
 
 void CMDMatrix::RemoveTimePoints(double _dStart, double _dEnd, bool _inclusive/* = true*/)
 {
+	m_version.MarkModified();
 	if( _dStart > _dEnd ) // wrong interval
 		return;
 
@@ -448,6 +498,7 @@ void CMDMatrix::RemoveTimePoints(double _dStart, double _dEnd, bool _inclusive/*
 
 void CMDMatrix::RemoveTimePointsAfter(double _dTime, bool _bIncludeTime /*= false */)
 {
+	m_version.MarkModified();
 	if( m_vTimePoints.empty() ) // nothing to remove
 		return;
 
@@ -471,6 +522,7 @@ void CMDMatrix::RemoveTimePointsAfter(double _dTime, bool _bIncludeTime /*= fals
 
 void CMDMatrix::RemoveAllTimePoints()
 {
+	m_version.MarkModified();
 	if( !m_vTimePoints.empty() )
 	{
 		m_dTempT1 = m_vTimePoints.front();
@@ -527,6 +579,7 @@ double CMDMatrix::GetMinimalFraction() const
 
 void CMDMatrix::SetMinimalFraction(double _dValue)	// TODO: compress according to new min fraction
 {
+	m_version.MarkModified();
 	if( _dValue < 0 )
 		m_dMinFraction = 0;
 	else
@@ -605,6 +658,7 @@ double CMDMatrix::GetValue(double _dTime, const std::vector<unsigned>& _vDims, c
 
 bool CMDMatrix::SetValue(unsigned _nTimeIndex, unsigned _nDim, unsigned _nCoord, double _dValue, bool _bExternal /*= true*/)
 {
+	m_version.MarkModified();
 	if( _nTimeIndex >= m_vTimePoints.size() )
 		return false;
 
@@ -617,6 +671,7 @@ bool CMDMatrix::SetValue(unsigned _nTimeIndex, unsigned _nDim, unsigned _nCoord,
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim, unsigned _nCoord, double _dValue, bool _bExternal /*= true*/)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims(1);
 	vDims[0] = _nDim;
 	std::vector<unsigned> vCoords(1);
@@ -626,6 +681,7 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim, unsigned _nCoord, double
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, unsigned _nCoord2, double _dValue, bool _bExternal /*= true*/)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims(2);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -637,6 +693,7 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsi
 
 bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, unsigned _nCoord2, unsigned _nDim3, unsigned _nCoord3, double _dValue, bool _bExternal /*= true*/)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims(3);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -650,11 +707,13 @@ bool CMDMatrix::SetValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsi
 
 bool CMDMatrix::SetValue( double _dTime, const std::vector<unsigned>& _vCoords, double _dValue, bool _bExternal /*= true*/ )
 {
+	m_version.MarkModified();
 	return SetValue( _dTime, m_vDimensions, _vCoords, _dValue, _bExternal );
 }
 
 bool CMDMatrix::SetValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, double _dValue, bool _bExternal /*= true*/)
 {
+	m_version.MarkModified();
 	//int index;
 	if( /* ( index = */ GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -767,15 +826,9 @@ std::vector<double> CMDMatrix::GetVectorValue(double _dTime, const std::vector<u
 	}
 	else
 	{
-		res.resize(m_vClasses[iDims]);
-		m_vTempCoords.push_back(0);
-
-		// get data by values
-		for (size_t i = 0; i < m_vClasses[iDims]; ++i)
-		{
-			res[i] = GetValueRecursive(m_data);
-			m_vTempCoords.back()++;
-		}
+		// get all values in one pass
+		if (!Reduce({ _dTime }, { _vDims.back() }, std::vector<unsigned>(_vDims.begin(), _vDims.end() - 1), _vCoords, res))
+			return std::vector<double>(m_vClasses[iDims], 0);
 	}
 
 	int cnt = 0;
@@ -841,13 +894,11 @@ bool CMDMatrix::GetVectorValue(double _dTime, const std::vector<unsigned>& _vDim
 	}
 	else
 	{
-		m_vTempCoords.push_back(0);
-
-		// get data by values
-		for( unsigned i=0; i<m_vClasses[iDims]; ++i )
+		// get all values in one pass
+		if( !Reduce( { _dTime }, { _vDims.back() }, std::vector<unsigned>( _vDims.begin(), _vDims.end() - 1 ), _vCoords, _vResult ) )
 		{
-			_vResult.push_back( GetValueRecursive( m_data ) );
-			m_vTempCoords.back()++;
+			_vResult.assign( m_vClasses[iDims], 0 );
+			return false;
 		}
 	}
 
@@ -877,6 +928,7 @@ std::vector<double> CMDMatrix::GetValues(unsigned _nDim, unsigned _nCoord) const
 
 bool CMDMatrix::SetVectorValue(unsigned _nTimeIndex, unsigned _nDim, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	m_version.MarkModified();
 	if( _nTimeIndex >= m_vTimePoints.size() )
 		return false;
 
@@ -888,6 +940,7 @@ bool CMDMatrix::SetVectorValue(unsigned _nTimeIndex, unsigned _nDim, const std::
 
 bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims(1);
 	vDims[0] = _nDim;
 	std::vector<unsigned> vCoords;
@@ -896,6 +949,7 @@ bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim, const std::vector<
 
 bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim1, unsigned _nCoord1, unsigned _nDim2, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vDims(2);
 	vDims[0] = _nDim1;
 	vDims[1] = _nDim2;
@@ -906,6 +960,7 @@ bool CMDMatrix::SetVectorValue(double _dTime, unsigned _nDim1, unsigned _nCoord1
 
 bool CMDMatrix::SetVectorValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, const std::vector<double>& _vValue, bool _bExternal /*= false*/ )
 {
+	m_version.MarkModified();
 	if( m_vTimePoints.empty() )
 		return false;
 
@@ -1089,6 +1144,7 @@ std::vector<std::vector<double>> CMDMatrix::GetMatrixValue(double _dTime, const
 
 bool CMDMatrix::SetMatrixValue(double _dTime, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vCoords, const std::vector<std::vector<double>>& _vValue)
 {
+	m_version.MarkModified();
 	if( m_vTimePoints.empty() )
 		return false;
 
@@ -1169,174 +1225,56 @@ bool CMDMatrix::SetMatrixValue(double _dTime, const std::vector<unsigned>& _vDim
 
 CDenseMDMatrix CMDMatrix::GetDistribution(double _dTime) const
 {
-	if (m_vTimePoints.empty())
-		return {};
-
-	// initialize result matrix
-	CDenseMDMatrix res(m_vDimensions, m_vClasses);
-
-	// get local copy of coordinates
-	std::vector<unsigned> vCoords(m_vDimensions.size() - 1, 0);
-
-	// main loop
-	do
-	{
-		res.SetVectorValue(m_vDimensions, vCoords, GetVectorValue(_dTime, m_vDimensions, vCoords));
-	} while (IncrementCoords(vCoords, m_vClasses));
-
+	CDenseMDMatrix res;
+	GetDistribution(_dTime, res);
 	return res;
 }
 
 bool CMDMatrix::GetDistribution(double _dTime, CDenseMDMatrix& _Result) const
 {
-	if( m_vTimePoints.empty() )
-		return false;
-
-	// initialize result matrix
-	if( !_Result.SetDimensions( m_vDimensions, m_vClasses ) ) // cannot set dimensions
-		return false;
-
-	// get local copy of coordinates
-	std::vector<unsigned> vCoords( m_vDimensions.size()-1, 0 );
-
-	// main loop
-	bool bRes;
-	std::vector<double> vResult;
-	do
-	{
-		if( GetVectorValue( _dTime, m_vDimensions, vCoords, vResult ) )
-			_Result.SetVectorValue( m_vDimensions, vCoords, vResult );
-		bRes = IncrementCoords( vCoords, m_vClasses );
-	}
-	while( bRes );
-
-	return true;
+	return GetDistribution(_dTime, m_vDimensions, _Result);
 }
 
 bool CMDMatrix::GetDistribution(double _dTime, unsigned _nDim, std::vector<double>& _vResult) const
 {
-	if( m_vTimePoints.empty() )
-		return false;
-
-	// make a vector of dimensions
-	unsigned i;
-	for( i=0; i<m_vDimensions.size(); ++i )
-		if( _nDim == m_vDimensions[i] )
-			break;
-	if( i == m_vDimensions.size() )
-		return false;
-
-	// initialize result vector
-	_vResult.clear();
-
-	return GetVectorValue( _dTime, _nDim, _vResult );
+	_vResult = GetDistribution(_dTime, _nDim);
+	return !_vResult.empty();
 }
 
 std::vector<double> CMDMatrix::GetDistribution(double _dTime, unsigned _nDim) const
 {
-	if (m_vTimePoints.empty()) return {};
-
-	// make a vector of dimensions
-	unsigned i;
-	for (i = 0; i<m_vDimensions.size(); ++i)
-		if (_nDim == m_vDimensions[i])
-			break;
-	if (i == m_vDimensions.size()) return {};
-
-	return GetVectorValue(_dTime, _nDim);
+	std::vector<double> res;
+	if (!Reduce({ _dTime }, { _nDim }, {}, {}, res)) return {};
+	return res;
 }
 
 bool CMDMatrix::GetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2, CMatrix2D& _Result) const
 {
-	if( m_vTimePoints.empty() )
-		return false;
-
-	if( _nDim1 == _nDim2 )
-		return false;
-
-	// make a vector of dimensions
-	unsigned index1 = 0, index2 = 0;
-	std::vector<unsigned> vDims;
-	for( unsigned i=0; i<m_vDimensions.size(); ++i )
-		if ( _nDim1 == m_vDimensions[i] )
-		{
-			vDims.push_back( _nDim1 );
-			index1 = i;
-			break;
-		}
-	for( unsigned i=0; i<m_vDimensions.size(); ++i )
-		if ( _nDim2 == m_vDimensions[i] )
-		{
-			vDims.push_back( _nDim2 );
-			index2 = i;
-			break;
-		}
-	if( vDims.size() != 2 ) // wrong dimension type
+	std::vector<double> vRes;
+	if (_nDim1 == _nDim2 || !Reduce({ _dTime }, { _nDim1, _nDim2 }, {}, {}, vRes))
 		return false;
 
-	// initialize result matrix
-	_Result.Resize( m_vClasses[index1], m_vClasses[index2] );
-
-	// main loop
-	std::vector<unsigned> vCoords( 1, 0 );
-	std::vector<double> vResult;
-	for( unsigned i=0; i<m_vClasses[index1]; ++i )
-	{
-		if( GetVectorValue( _dTime, vDims, vCoords, vResult ) )
-			_Result.SetRow( i, vResult );
-		vCoords.front()++;
-	}
+	// the first dimension changes fastest
+	const unsigned nRows = GetDimensionSizeByType(_nDim1);
+	const unsigned nCols = GetDimensionSizeByType(_nDim2);
+	_Result.Resize(nRows, nCols);
+	for (size_t i = 0; i < nRows; ++i)
+		for (size_t j = 0; j < nCols; ++j)
+			_Result[i][j] = vRes[j * nRows + i];
 
 	return true;
 }
 
 CMatrix2D CMDMatrix::GetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2) const
 {
-	if (m_vTimePoints.empty()) return {};
-	if (_nDim1 == _nDim2) return {};
-
-	// make a vector of dimensions
-	size_t index1 = 0, index2 = 0;
-	std::vector<unsigned> vDims;
-	for (size_t i = 0; i < m_vDimensions.size(); ++i)
-		if (_nDim1 == m_vDimensions[i])
-		{
-			vDims.push_back(_nDim1);
-			index1 = i;
-			break;
-		}
-	for (size_t i = 0; i < m_vDimensions.size(); ++i)
-		if (_nDim2 == m_vDimensions[i])
-		{
-			vDims.push_back(_nDim2);
-			index2 = i;
-			break;
-		}
-	if (vDims.size() != 2) return {}; // wrong dimension type
-
-	// initialize result matrix
-	CMatrix2D res(m_vClasses[index1], m_vClasses[index2]);
-
-	// main loop
-	std::vector<unsigned> vCoords(1, 0);
-	std::vector<double> vResult;
-	for (size_t i = 0; i < m_vClasses[index1]; ++i)
-	{
-		if (GetVectorValue(_dTime, vDims, vCoords, vResult))
-			res.SetRow(i, vResult);
-		vCoords.front()++;
-	}
-
+	CMatrix2D res;
+	GetDistribution(_dTime, _nDim1, _nDim2, res);
 	return res;
 }
 
 bool CMDMatrix::GetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2, unsigned _nDim3, CDenseMDMatrix& _Result) const
 {
-	std::vector<unsigned> vDims;
-	vDims.push_back( _nDim1 );
-	vDims.push_back( _nDim2 );
-	vDims.push_back( _nDim3 );
-	return GetDistribution( _dTime, vDims, _Result );
+	return GetDistribution(_dTime, std::vector<unsigned>{ _nDim1, _nDim2, _nDim3 }, _Result);
 }
 
 CDenseMDMatrix CMDMatrix::GetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2, unsigned _nDim3) const
@@ -1346,85 +1284,56 @@ CDenseMDMatrix CMDMatrix::GetDistribution(double _dTime, unsigned _nDim1, unsign
 
 bool CMDMatrix::GetDistribution(double _dTime, const std::vector<unsigned>& _vDims, CDenseMDMatrix& _Result) const
 {
-	if( m_vTimePoints.empty() )
-		return false;
-
-	if( _vDims.size() > m_vDimensions.size() ) // wrong size of _vDims
-		return false;
-	if( _vDims.size() == 0 )
-		return false;
-
-	// get local copy of vector of dimensions and sizes according to their order in _vDims
-	std::vector<unsigned> vDims;
-	std::vector<unsigned> vSizes;
-	for( unsigned i=0; i<_vDims.size(); ++i )
-		for ( unsigned j=0; j<m_vDimensions.size(); ++j )
-			if ( _vDims[i] == m_vDimensions[j] )
-			{
-				vDims.push_back( m_vDimensions[j] );
-				vSizes.push_back( m_vClasses[j] );
-				break;
-			}
-	if( vDims.size() != _vDims.size() ) // wrong dimensions types
+	std::vector<double> vRes;
+	if (!Reduce({ _dTime }, _vDims, {}, {}, vRes))
 		return false;
 
 	// initialize result matrix
-	if( !_Result.SetDimensions( vDims, vSizes ) ) // cannot set dimensions
+	std::vector<unsigned> vSizes;
+	for (const unsigned dim : _vDims)
+		vSizes.push_back(GetDimensionSizeByType(dim));
+	if (!_Result.SetDimensions(_vDims, vSizes)) // cannot set dimensions
 		return false;
 
-	// get local copy of coordinates
-	std::vector<unsigned> vCoords( vDims.size()-1, 0 );
-
-	// main loop
-	bool bRes;
-	std::vector<double> vResult;
-	do
-	{
-		if( GetVectorValue( _dTime, vDims, vCoords, vResult ) )
-			_Result.SetVectorValue( vDims, vCoords, vResult );
-		bRes = IncrementCoords( vCoords, vSizes );
-	}
-	while( bRes );
-
+	std::copy(vRes.begin(), vRes.end(), _Result.GetDataPtr());
 	return true;
 }
 
 CDenseMDMatrix CMDMatrix::GetDistribution(double _dTime, const std::vector<unsigned>& _vDims) const
 {
-	if (m_vTimePoints.empty()) return {};
-	if (_vDims.size() > m_vDimensions.size()) return {};  // wrong size of _vDims
-	if (_vDims.empty()) return {};
-
-	// get local copy of vector of dimensions and sizes according to their order in _vDims
-	std::vector<unsigned> vDims;
-	std::vector<unsigned> vSizes;
-	for (unsigned dim : _vDims)
-		for (size_t j = 0; j < m_vDimensions.size(); ++j)
-			if (dim == m_vDimensions[j])
-			{
-				vDims.push_back(m_vDimensions[j]);
-				vSizes.push_back(m_vClasses[j]);
-				break;
-			}
-	if (vDims.size() != _vDims.size()) return {}; // wrong dimensions types
-
-	// initialize result matrix
-	CDenseMDMatrix res(vDims, vSizes);
+	CDenseMDMatrix res;
+	GetDistribution(_dTime, _vDims, res);
+	return res;
+}
 
-	// get local copy of coordinates
-	std::vector<unsigned> vCoords(vDims.size() - 1, 0);
+std::vector<double> CMDMatrix::GetDistributions(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims) const
+{
+	std::vector<double> res;
+	if (!Reduce(_vTimes, _vDims, {}, {}, res)) return {};
+	return res;
+}
 
-	// main loop
-	do
+std::vector<double> CMDMatrix::GetDistributions(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vFixedDims, const std::vector<unsigned>& _vFixedCoords, bool _bConditional /*= false*/) const
+{
+	std::vector<double> res;
+	if (!Reduce(_vTimes, _vDims, _vFixedDims, _vFixedCoords, res)) return {};
+	if (_bConditional)
 	{
-		res.SetVectorValue(vDims, vCoords, GetVectorValue(_dTime, vDims, vCoords));
-	} while (IncrementCoords(vCoords, vSizes));
-
+		const size_t size = res.size() / _vTimes.size();
+		for (size_t i = 0; i < _vTimes.size(); ++i)
+		{
+			const auto beg = res.begin() + i * size;
+			const double sum = std::accumulate(beg, beg + size, 0.0);
+			if (sum != 0)
+				std::transform(beg, beg + size, beg, [&](double _v) { return _v / sum; });
+		}
+	}
 	return res;
 }
 
 bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim, const std::vector<double>& _vDistr)
 {
+	m_version.MarkModified();
 	if(GetTimeIndex( _dTime ) == -1) // time point doesn't exist
 		return false;
 
@@ -1445,6 +1354,7 @@ bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim, const std::vector
 
 bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2, const CMatrix2D& _Distr)
 {
+	m_version.MarkModified();
 	//int index;
 	if( /* ( index =  */GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -1507,6 +1417,7 @@ bool CMDMatrix::SetDistribution(double _dTime, unsigned _nDim1, unsigned _nDim2,
 
 bool CMDMatrix::SetDistribution(double _dTime, const CDenseMDMatrix& _Distr)
 {
+	m_version.MarkModified();
 	//int index;
 	if( /* ( index = */ GetTimeIndex( _dTime ) /* ) */ == -1 ) // time point doesn't exist
 		return false;
@@ -1555,6 +1466,7 @@ bool CMDMatrix::SetDistribution(double _dTime, const CDenseMDMatrix& _Distr)
 
 bool CMDMatrix::Transform(double _dTime, const CTransformMatrix& _TMatrix)
 {
+	m_version.MarkModified();
 	std::vector<unsigned> vTDims = _TMatrix.GetDimensions();
 	std::vector<unsigned> vTClasses = _TMatrix.GetClasses();
 	std::vector<unsigned> vNewDims;
@@ -1713,6 +1625,7 @@ bool CMDMatrix::Transform(double _dTime, const CTransformMatrix& _TMatrix)
 
 void CMDMatrix::NormalizeMatrix(double _dTime)
 {
+	m_version.MarkModified();
 	unsigned index = GetTimeIndex( _dTime );
 	if( index != -1 )
 	{
@@ -1727,6 +1640,7 @@ void CMDMatrix::NormalizeMatrix(double _dTime)
 
 void CMDMatrix::NormalizeMatrix(double _dStart, double _dEnd)
 {
+	m_version.MarkModified();
 	if( m_vTimePoints.size() == 0 ) // nothing to normalize
 		return;
 
@@ -1751,6 +1665,7 @@ void CMDMatrix::NormalizeMatrix(double _dStart, double _dEnd)
 
 void CMDMatrix::NormalizeMatrix()
 {
+	m_version.MarkModified();
 	m_vTempValues = m_vTimePoints;
 	if( !m_vTimePoints.empty() )
 		UnCacheData(m_vTimePoints.front(),m_vTimePoints.back());
@@ -1790,11 +1705,13 @@ bool CMDMatrix::IsNormalized(double _dTime)
 
 bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dTime)
 {
+	m_version.MarkModified();
 	return CopyFrom( _Source, _dTime, _dTime );
 }
 
 bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dStart, double _dEnd)
 {
+	m_version.MarkModified();
 	if( !CompareDims( _Source ) )
 		return false;
 
@@ -1807,8 +1724,7 @@ bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dStart, double _dEnd)
 	if( ( vTimePoints.size() == 0 ) && ( _dStart == _dEnd ) )
 		vTimePoints.push_back( _dStart );
 	if (vTimePoints.empty()) return true;
-	for( unsigned i=0; i<vTimePoints.size(); ++i )
-		AddTimePoint( vTimePoints[i] );
+	AddTimePoints( vTimePoints );
 
 	m_dTempT1 = vTimePoints.front();
 	m_dTempT2 = vTimePoints.back();
@@ -1826,6 +1742,7 @@ bool CMDMatrix::CopyFrom(const CMDMatrix& _Source, double _dStart, double _dEnd)
 
 bool CMDMatrix::CopyFromTimePoint(const CMDMatrix& _Source, double _dTimeSrc, double _dTimeDest)
 {
+	m_version.MarkModified();
 	if( !CompareDims( _Source ) )
 		return false;
 
@@ -1840,6 +1757,11 @@ bool CMDMatrix::CopyFromTimePoint(const CMDMatrix& _Source, double _dTimeSrc, do
 	return true;
 }
 
+uint64_t CMDMatrix::GetDataVersion() const
+{
+	return m_version.Get();
+}
+
 //void CMDMatrix::AddMatrix(CMDMatrix& _srcMatr, double _dFactorDst, double _dFactorSrc, double _dTime)
 //{
 //	std::vector<double> vFactors1;
@@ -1919,6 +1841,7 @@ void CMDMatrix::SaveMDBlockToFile(CH5Handler& _h5File, const std::string& _sPath
 
 void CMDMatrix::LoadFromFile(const CH5Handler& _h5File, const std::string& _sPath)
 {
+	m_version.MarkModified();
 	Clear();
 
 	if (!_h5File.IsValid())
@@ -1952,6 +1875,7 @@ void CMDMatrix::LoadFromFile(const CH5Handler& _h5File, const std::string& _sPat
 
 void CMDMatrix::LoadMDBlockFromFile(const CH5Handler& _h5File, const std::string& _sPath, unsigned _iFirst, unsigned _iLast, std::vector<std::vector<double>>& vvBuf)
 {
+	m_version.MarkModified();
 	_h5File.ReadData(_sPath, StrConst::MDM_H5Data + std::to_string(static_cast<unsigned>(_iFirst / DATA_SAVE_BLOCK)), vvBuf);
 	m_vTempValues.assign(m_vTimePoints.begin() + _iFirst, m_vTimePoints.begin() + _iLast + 1);
 	m_nCounter = 0;
@@ -1980,6 +1904,7 @@ void CMDMatrix::SetCacheParams(bool _bEnabled, size_t _nWindow)
 
 void CMDMatrix::CompressData( double _dStartTime, double _dEndTime, double _dATol, double _dRTol )
 {
+	m_version.MarkModified();
 	if( _dStartTime < _dEndTime )
 	{
 		m_dTempT1 = _dStartTime;
@@ -1993,6 +1918,7 @@ void CMDMatrix::CompressData( double _dStartTime, double _dEndTime, double _dATo
 
 void CMDMatrix::ExtrapolateToPoint( double _dT1, double _dT2, double _dTExtra )
 {
+	m_version.MarkModified();
 	UnCacheData(_dT1,_dTExtra);
 
 	m_dTempT1 = _dT1;
@@ -2007,6 +1933,7 @@ void CMDMatrix::ExtrapolateToPoint( double _dT1, double _dT2, double _dTExtra )
 
 void CMDMatrix::ExtrapolateToPoint( double _dT0, double _dT1, double _dT2, double _dTExtra )
 {
+	m_version.MarkModified();
 	UnCacheData(_dT0,_dTExtra);
 
 	m_vTempValues.resize( 4 );
@@ -2021,6 +1948,63 @@ void CMDMatrix::ExtrapolateToPoint( double _dT0, double _dT1, double _dT2, doubl
 	CheckCacheNeed();
 }
 
+bool CMDMatrix::Reduce(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vFixedDims, const std::vector<unsigned>& _vFixedCoords, std::vector<double>& _vResult) const
+{
+	if (m_vTimePoints.empty() || _vTimes.empty() || _vDims.empty())
+		return false;
+	if (_vFixedDims.size() != _vFixedCoords.size()) // wrong size of _vFixedCoords
+		return false;
+
+	// all dimensions must be defined and unique
+	std::vector<unsigned> vAllDims = _vDims;
+	vAllDims.insert(vAllDims.end(), _vFixedDims.begin(), _vFixedDims.end());
+	if (vAllDims.size() > m_vDimensions.size() || !CheckDuplicates(vAllDims))
+		return false;
+	const auto Level = [&](unsigned _nDim) { return static_cast<size_t>(std::find(m_vDimensions.begin(), m_vDimensions.end(), _nDim) - m_vDimensions.begin()); };
+
+	// layout of the result
+	SReduction plan;
+	plan.times = _vTimes;
+	plan.strides.assign(m_vDimensions.size(), 0);
+	plan.coords = m_vClasses;
+	plan.size = 1;
+	for (const unsigned dim : _vDims)
+	{
+		const size_t level = Level(dim);
+		if (level == m_vDimensions.size()) return false; // wrong dimension type
+		plan.strides[level] = plan.size;
+		plan.size *= m_vClasses[level];
+		plan.lastLevel = std::max(plan.lastLevel, level);
+	}
+	_vResult.assign(_vTimes.size() * plan.size, 0);
+	for (size_t i = 0; i < _vFixedDims.size(); ++i)
+	{
+		const size_t level = Level(_vFixedDims[i]);
+		if (level == m_vDimensions.size()) return false; // wrong dimension type
+		if (_vFixedCoords[i] >= m_vClasses[level]) return true; // no such coordinates
+		plan.coords[level] = _vFixedCoords[i];
+		plan.lastLevel = std::max(plan.lastLevel, level);
+	}
+	plan.values.resize(plan.lastLevel + 1);
+	plan.factors.assign(plan.lastLevel + 1, std::vector<double>(_vTimes.size()));
+
+	const auto [minTime, maxTime] = std::minmax_element(_vTimes.begin(), _vTimes.end());
+	if (*minTime == *maxTime)
+		UnCacheData(*minTime);
+	else
+		UnCacheData(*minTime, *maxTime);
+
+	const std::vector<double> vOnes(_vTimes.size(), 1.0);
+	ReduceRecursive(m_data, plan, vOnes.data(), 0, _vResult.data());
+
+	// values below minimal fraction are interpreted as 0
+	for (double& val : _vResult)
+		if (val < m_dMinFraction)
+			val = 0;
+
+	return true;
+}
+
 bool CMDMatrix::CheckDuplicates(const std::vector<unsigned>& _vVec) const
 {
 	for( unsigned i=0; i<_vVec.size()-1; ++i )
@@ -2347,6 +2331,19 @@ void CMDMatrix::AddTimePointRecursive(sFraction *_pFraction, unsigned _nNesting
 	}
 }
 
+void CMDMatrix::AddTimePointsRecursive(sFraction *_pFraction, const std::vector<double>& _vTimes, unsigned _nNesting /*= 0 */)
+{
+	if( ( _nNesting >= m_vDimensions.size() ) || ( _pFraction == NULL ) )
+		return;
+
+	for( unsigned i=0; i<m_vClasses[_nNesting]; ++i )
+	{
+		_pFraction[i].tdArray.AddTimePoints( _vTimes ); // add time points
+		if( _pFraction[i].pNext != NULL ) // go to the next dimension
+			AddTimePointsRecursive( _pFraction[i].pNext, _vTimes, _nNesting+1 );
+	}
+}
+
 void CMDMatrix::ChangeTimePointRecursive(sFraction *_pFraction, unsigned _nNesting /*= 0 */)
 {
 	if( ( _nNesting >= m_vDimensions.size() ) || ( _pFraction == NULL ) )
@@ -2606,6 +2603,41 @@ bool CMDMatrix::SetValueRecursive(sFraction *_pFraction, bool _bExternal /*= tru
 	return true;
 }
 
+void CMDMatrix::ReduceRecursive(sFraction *_pFraction, const SReduction& _plan, const double* _pFactors, size_t _nOffset, double* _pOut, unsigned _nNesting /*= 0*/) const
+{
+	if( ( _nNesting > _plan.lastLevel ) || ( _pFraction == NULL ) )
+		return;
+
+	const size_t nTimes = _plan.times.size();
+	std::vector<double>& vValues = _plan.values[_nNesting];
+	double* pFactors = _plan.factors[_nNesting].data();
+
+	// either a fixed class or all classes
+	const bool bFixed = _plan.coords[_nNesting] < m_vClasses[_nNesting];
+	const unsigned iFirst = bFixed ? _plan.coords[_nNesting] : 0;
+	const unsigned iLast = bFixed ? iFirst + 1 : m_vClasses[_nNesting];
+
+	for( unsigned i=iFirst; i<iLast; ++i )
+	{
+		_pFraction[i].tdArray.GetVectorValue( _plan.times, vValues );
+		bool bNonZero = false;
+		for( size_t t=0; t<nTimes; ++t )
+		{
+			pFactors[t] = _pFactors[t] * vValues[t];
+			bNonZero |= pFactors[t] != 0;
+		}
+		if( !bNonZero ) // nothing to add from the whole branch
+			continue;
+
+		const size_t nOffset = _nOffset + i * _plan.strides[_nNesting];
+		if( _nNesting == _plan.lastLevel ) // the search is over
+			for( size_t t=0; t<nTimes; ++t )
+				_pOut[t * _plan.size + nOffset] += pFactors[t];
+		else // go to the next dimension
+			ReduceRecursive( _pFraction[i].pNext, _plan, pFactors, nOffset, _pOut, _nNesting+1 );
+	}
+}
+
 bool CMDMatrix::GetVectorValueRecursive(sFraction *_pFraction, std::vector<double>& _vRes, unsigned _nNesting /*= 0 */) const
 {
 	if( ( _nNesting >= m_vDimensions.size() ) || ( _pFraction == NULL ) )
@@ -8,6 +8,7 @@
 #include "TransformMatrix.h"
 #include "H5Handler.h"
 #include "MDMatrCacher.h"
+#include "DataVersion.h"
 
 #define DATA_SAVE_BLOCK	100
 
@@ -29,6 +30,7 @@ private:
 	std::vector<double> m_vTimePoints;		///< Vector of current time points
 	mutable sFraction *m_data{ nullptr };				///< Current data itself
 	double m_dMinFraction{ DEFAULT_MIN_FRACTION };					///< Minimal fraction. All smaller values are interpreted as 0
+	CDataVersion m_version;			///< Version of data, changes with each modification
 
 	// ===== Variables for temporary use in recursive functions
 	mutable double m_dTempT1{ 0.0 };
@@ -39,6 +41,18 @@ private:
 	double m_dTempValue{ 0.0 };
 	CMDMatrix* m_pSortMatr{ nullptr };
 
+	/** Precomputed layout of a dimension reduction: how each level of the data contributes to the result.*/
+	struct SReduction
+	{
+		std::vector<double> times;		///< Time points to calculate.
+		std::vector<size_t> strides;	///< Stride in the result for each level, 0 for summed up and fixed dimensions.
+		std::vector<unsigned> coords;	///< Fixed class for each level, or the number of classes if the dimension is not fixed.
+		size_t lastLevel{ 0 };			///< The deepest needed level, lower levels sum up to 1.
+		size_t size{ 0 };				///< Size of the result for one time point.
+		mutable std::vector<std::vector<double>> values;	///< Values of fractions for each level and time point.
+		mutable std::vector<std::vector<double>> factors;	///< Accumulated factors for each level and time point.
+	};
+
 	std::wstring m_sCachePath{ L"" };
 	bool m_bCacheEnabled{ false };
 	mutable CMDMatrCacher m_cacheHandler;
@@ -96,6 +110,8 @@ public:
 	/** Adds new time point. Data to a new time point will be copied from _dSourceTimePoint.
 	*	If _dSourceTimePoint == -1, than data will be copied from the previous time point. If such time point already exists, than nothing will be done.*/
 	void AddTimePoint( double _dTime, double _dSrcTimePoint = -1 );
+	/** Adds new sorted time points at once. Data to new time points will be copied from the previous time points. Existing time points remain unchanged.*/
+	void AddTimePoints( const std::vector<double>& _vTimes );
 	/** Changes specified time point. For UI purposes.*/
 	void ChangeTimePoint( unsigned _nTimePointIndex, double _dNewTime );
 	/** Removes specified time point.*/
@@ -255,6 +271,16 @@ public:
 	/** Return distribution by specified dimensions and time. Uses GetVectorValue() functions.*/
 	CDenseMDMatrix GetDistribution(double _dTime, const std::vector<unsigned>& _vDims) const;
 
+	/** Returns distributions by specified dimensions for all time points _vTimes at once as a contiguous block [_vTimes.size() x number of classes].
+	*	Each distribution is arranged as in CDenseMDMatrix with the first dimension changing fastest. All other dimensions are summed up.
+	*	Calculated in a single pass over the data without temporary matrices. Returns an empty vector on error.*/
+	std::vector<double> GetDistributions(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims) const;
+	/** Returns distributions by specified dimensions for all time points _vTimes at once as a contiguous block [_vTimes.size() x number of classes],
+	*	taking only classes _vFixedCoords of dimensions _vFixedDims. Each distribution is arranged as in CDenseMDMatrix with the first dimension changing fastest.
+	*	All other dimensions are summed up. If _bConditional is set, each distribution is normalized, resulting in a distribution conditional on the fixed classes.
+	*	Calculated in a single pass over the data without temporary matrices. Returns an empty vector on error.*/
+	std::vector<double> GetDistributions(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vFixedDims, const std::vector<unsigned>& _vFixedCoords, bool _bConditional = false) const;
+
 	/** Sets distribution by specified dimension and time. Uses SetVectorValue() functions.*/
 	bool SetDistribution( double _dTime, unsigned _nDim, const std::vector<double>& _vDistr );
 	/** Sets distribution by specified dimensions and time. Uses SetVectorValue() functions.*/
@@ -288,6 +314,9 @@ public:
 	*	If time point doesn't exist, it will be created.*/
 	bool CopyFromTimePoint( const CMDMatrix& _Source, double _dTimeSrc, double _dTimeDest );
 
+	/** Returns version of data, which changes with each modification of the matrix.*/
+	uint64_t GetDataVersion() const;
+
 	///** Adds _srcMatr to a matrix with specified factors for time point _dTime.*/
 	//void AddMatrix( CMDMatrix& _srcMatr, double _dFactorDst, double _dFactorSrc, double _dTime );
 	///** Adds _srcMatr to a matrix with specified factors for time intervals.*/
@@ -326,6 +355,9 @@ private:
 	bool SortMatrix( double _dSrcTime, double _dDstTime, CMDMatrix& _dstMatrix );
 	/** Sorts matrix according to order in _dstMatrix for all time points.*/
 	bool SortMatrix( CMDMatrix& _dstMatrix );
+	/** Calculates distributions by dimensions _vDims for time points _vTimes, where dimensions _vFixedDims are fixed at classes _vFixedCoords.
+	*	The result is written into a block [_vTimes.size() x number of classes]. Returns false on error.*/
+	bool Reduce(const std::vector<double>& _vTimes, const std::vector<unsigned>& _vDims, const std::vector<unsigned>& _vFixedDims, const std::vector<unsigned>& _vFixedCoords, std::vector<double>& _vResult) const;
 	/** Removes dimensions and puts new sorted matrix in _sortMatr. New dimensions and classes set will be in _vNewDims and _vNewClasses.*/
 	void DeleteDimsWithSort( const std::vector<unsigned>& _vDims, std::vector<unsigned>& _vNewDims, std::vector<unsigned>& _vNewClasses, CMDMatrix& _sortMatr );
 
@@ -339,6 +371,8 @@ private:
 	sFraction* RemoveFractionsRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
 	/** Adds specified time point m_dTempT1 to each fraction. Data to a new time point will be copied from m_dTempT2.*/
 	void AddTimePointRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
+	/** Adds sorted time points _vTimes to each fraction. Data to new time points will be copied from the previous time points.*/
+	void AddTimePointsRecursive( sFraction *_pFraction, const std::vector<double>& _vTimes, unsigned _nNesting = 0 );
 	/** Changes time point m_dTempT1 to a m_dTempT2.*/
 	void ChangeTimePointRecursive( sFraction *_pFraction, unsigned _nNesting = 0 );
 	/** Removes time points from interval [m_dTempT1..m_dTempT2] or single time point m_dTempT1 (if m_dTempT2 == -1)*/
@@ -348,6 +382,9 @@ private:
 	/** Sets value m_dTempValue for time m_dTempT1 according to specified dimensions m_vTempDims and coordinates m_vTempCoords.
 	*	Dimensions set can be reduced. If time point wasn't defined, nothing will be done. Returns false on error.*/
 	bool SetValueRecursive( sFraction *_pFraction, bool _bExternal = true, unsigned _nLevel = 1, unsigned _nNesting = 0 );
+	/** Adds products of fractions down to _plan.lastLevel for all time points to _pOut, multiplied by _pFactors.
+	*	_nOffset is the position in the result defined by the upper levels.*/
+	void ReduceRecursive(sFraction *_pFraction, const SReduction& _plan, const double* _pFactors, size_t _nOffset, double* _pOut, unsigned _nNesting = 0) const;
 	/** Returns vector value for time m_dTempT1 according to specified dimensions m_vTempDims and coordinates m_vTempCoords.
 	*	Dimensions set can be reduced. Returns false on error.*/
 	bool GetVectorValueRecursive(sFraction *_pFraction, std::vector<double>& _vRes, unsigned _nNesting = 0) const;
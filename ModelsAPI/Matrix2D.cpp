@@ -1,6 +1,7 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "Matrix2D.h"
+#include "DenseKernels.h"
 #include "ThreadPool.h"
 #include <numeric>
 #include <algorithm>
@@ -117,13 +118,64 @@ CMatrix2D::d_vect_t CMatrix2D::ToVector() const
 
 void CMatrix2D::Normalize()
 {
-	double sum = 0;
-	for (auto& row : m_data)
-		sum += std::accumulate(row.begin(), row.end(), 0.);
+	const double sum = GetSum();
 	if (sum != 0 && sum != 1)
-		for (auto& row : m_data)
-			for (auto& val : row)
-				val /= sum;
+		*this /= sum;
+}
+
+void CMatrix2D::NormalizeRows()
+{
+	for (auto& row : m_data)
+		DenseKernels::Normalize(row.size(), row.data());
+}
+
+void CMatrix2D::NormalizeCols()
+{
+	d_vect_t sums(m_cols, 0.);
+	for (const auto& row : m_data)
+		DenseKernels::Axpy(m_cols, 1., row.data(), sums.data());
+	for (auto& sum : sums)
+		sum = sum != 0. ? sum : 1.;
+	for (auto& row : m_data)
+		for (size_t j = 0; j < m_cols; ++j)
+			row[j] /= sums[j];
+}
+
+double CMatrix2D::GetSum() const
+{
+	double sum = 0;
+	for (const auto& row : m_data)
+		sum += DenseKernels::Sum(row.size(), row.data());
+	return sum;
+}
+
+bool CMatrix2D::IsEqual(const CMatrix2D& _matrix, double _absTol, double _relTol) const
+{
+	if (m_rows != _matrix.m_rows || m_cols != _matrix.m_cols)
+		return false;
+	for (size_t i = 0; i < m_rows; ++i)
+		if (!DenseKernels::AreEqual(m_cols, m_data[i].data(), _matrix.m_data[i].data(), _absTol, _relTol))
+			return false;
+	return true;
+}
+
+CMatrix2D& CMatrix2D::Axpy(double _val, const CMatrix2D& _matrix)
+{
+	if (m_rows != _matrix.m_rows || m_cols != _matrix.m_cols)
+		throw std::runtime_error("Matrix dimensions are not the same");
+	for (size_t i = 0; i < m_rows; ++i)
+		DenseKernels::Axpy(m_cols, _val, _matrix.m_data[i].data(), m_data[i].data());
+	return *this;
+}
+
+CMatrix2D CMatrix2D::Mix(double _weight1, const CMatrix2D& _matrix1, double _weight2, const CMatrix2D& _matrix2)
+{
+	if (_matrix1.m_rows != _matrix2.m_rows || _matrix1.m_cols != _matrix2.m_cols)
+		throw std::runtime_error("Matrix dimensions are not the same");
+	CMatrix2D res(_matrix1.m_rows, _matrix1.m_cols);
+	for (size_t i = 0; i < res.m_rows; ++i)
+		DenseKernels::Mix(res.m_cols, _weight1, _matrix1.m_data[i].data(), _weight2, _matrix2.m_data[i].data(), res.m_data[i].data());
+	return res;
 }
 
 CMatrix2D CMatrix2D::Identity(size_t _size)
@@ -175,9 +227,8 @@ CMatrix2D CMatrix2D::operator/(double _val) const
 
 CMatrix2D& CMatrix2D::operator*=(double _val)
 {
-	for (size_t i = 0; i < m_rows; ++i)
-		for (size_t j = 0; j < m_cols; ++j)
-			m_data[i][j] *= _val;
+	for (auto& row : m_data)
+		DenseKernels::Scale(row.size(), _val, row.data());
 	return *this;
 }
 
@@ -188,12 +239,7 @@ CMatrix2D CMatrix2D::operator*(double _val) const
 
 CMatrix2D& CMatrix2D::operator+=(const CMatrix2D& _matrix)
 {
-	if (m_rows != _matrix.m_rows || m_cols != _matrix.m_cols)
-		throw std::runtime_error("Matrix dimensions are not the same");
-	for (size_t i = 0; i < m_rows; ++i)
-		for (size_t j = 0; j < m_cols; ++j)
-			m_data[i][j] += _matrix[i][j];
-	return *this;
+	return Axpy(1., _matrix);
 }
 
 CMatrix2D CMatrix2D::operator+(const CMatrix2D& _matrix) const
@@ -203,12 +249,7 @@ CMatrix2D CMatrix2D::operator+(const CMatrix2D& _matrix) const
 
 CMatrix2D& CMatrix2D::operator-=(const CMatrix2D& _matrix)
 {
-	if (m_rows != _matrix.m_rows || m_cols != _matrix.m_cols)
-		throw std::runtime_error("Matrix dimensions are not the same");
-	for (size_t i = 0; i < m_rows; ++i)
-		for (size_t j = 0; j < m_cols; ++j)
-			m_data[i][j] -= _matrix[i][j];
-	return *this;
+	return Axpy(-1., _matrix);
 }
 
 CMatrix2D CMatrix2D::operator-(const CMatrix2D& _matrix) const
@@ -144,6 +144,48 @@ public:
 	 * \brief Normalizes values of the matrix.
 	 */
 	void Normalize();
+	/**
+	 * \brief Normalizes each row of the matrix, so that the sum of values in each row equals to 1.
+	 * \details Rows with zero sum remain unchanged.
+	 */
+	void NormalizeRows();
+	/**
+	 * \brief Normalizes each column of the matrix, so that the sum of values in each column equals to 1.
+	 * \details Columns with zero sum remain unchanged.
+	 */
+	void NormalizeCols();
+	/**
+	 * \brief Returns the sum of all elements of the matrix.
+	 * \return Sum of all elements.
+	 */
+	double GetSum() const;
+	/**
+	 * \brief Checks whether all elements of the matrix are equal to the elements of another matrix within the given tolerances.
+	 * \details Elements are equal, if |this - _matrix| < |this| * _relTol + _absTol. Matrices with different dimensions are not equal.
+	 * \param _matrix Other matrix.
+	 * \param _absTol Absolute tolerance.
+	 * \param _relTol Relative tolerance.
+	 * \return Whether matrices are equal.
+	 */
+	bool IsEqual(const CMatrix2D& _matrix, double _absTol, double _relTol) const;
+	/**
+	 * \brief Adds another matrix multiplied by a value to this matrix: this = this + _val * _matrix.
+	 * \details If dimensions of the matrices do not match, std::runtime_error exception is thrown.
+	 * \param _val Value.
+	 * \param _matrix Other matrix.
+	 * \return Reference to this matrix.
+	 */
+	CMatrix2D& Axpy(double _val, const CMatrix2D& _matrix);
+	/**
+	 * \brief Returns weighted sum of two matrices: _weight1 * _matrix1 + _weight2 * _matrix2.
+	 * \details If dimensions of the matrices do not match, std::runtime_error exception is thrown.
+	 * \param _weight1 Weight of the first matrix.
+	 * \param _matrix1 First matrix.
+	 * \param _weight2 Weight of the second matrix.
+	 * \param _matrix2 Second matrix.
+	 * \return Weighted sum.
+	 */
+	static CMatrix2D Mix(double _weight1, const CMatrix2D& _matrix1, double _weight2, const CMatrix2D& _matrix2);
 	/**
 	 * \brief Returns identity matrix with the specified dimensions.
 	 * \param _size Size of the square matrix.
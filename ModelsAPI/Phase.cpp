@@ -112,6 +112,11 @@ std::vector<double> CPhase::GetCompoundsDistribution(double _time) const
 	return m_distribution.GetDistribution(_time, DISTR_COMPOUNDS);
 }
 
+std::vector<double> CPhase::GetCompoundsDistributions(const std::vector<double>& _times) const
+{
+	return m_distribution.GetDistributions(_times, { DISTR_COMPOUNDS });
+}
+
 void CPhase::SetCompoundsDistribution(double _time, const std::vector<double>& _value)
 {
 	m_distribution.SetDistribution(_time, DISTR_COMPOUNDS, _value);
@@ -120,29 +125,31 @@ void CPhase::SetCompoundsDistribution(double _time, const std::vector<double>& _
 void CPhase::CopyFrom(double _time, const CPhase& _source)
 {
 	m_fractions.CopyFrom(_time, _source.m_fractions);
-	if (m_grid == _source.m_grid)
+	if (HasSameDistributionGrid(_source))
 		m_distribution.CopyFrom(_source.m_distribution, _time);
 	else
-		CopyDistributionsWithConvert(_time, _time, _source, *this);
+		CopyDistributionsWithConvert({ _time }, { _time }, _source);
 }
 
 void CPhase::CopyFrom(double _timeDst, const CPhase& _source, double _timeSrc)
 {
 	m_fractions.CopyFrom(_timeDst, _source.m_fractions, _timeSrc);
-	if (m_grid == _source.m_grid)
+	if (HasSameDistributionGrid(_source))
 		m_distribution.CopyFromTimePoint(_source.m_distribution, _timeSrc, _timeDst);
 	else
-		CopyDistributionsWithConvert(_timeSrc, _timeDst, _source, *this);
+		CopyDistributionsWithConvert({ _timeSrc }, { _timeDst }, _source);
 }
 
 void CPhase::CopyFrom(double _timeBeg, double _timeEnd, const CPhase& _source)
 {
 	m_fractions.CopyFrom(_timeBeg, _timeEnd, _source.m_fractions);
-	if (m_grid == _source.m_grid)
+	if (HasSameDistributionGrid(_source))
 		m_distribution.CopyFrom(_source.m_distribution, _timeBeg, _timeEnd);
 	else
-		for (double t : _source.m_distribution.GetTimePoints(_timeBeg, _timeEnd))
-			CopyDistributionsWithConvert(t, t, _source, *this);
+	{
+		const auto timePoints = _source.m_distribution.GetTimePoints(_timeBeg, _timeEnd);
+		CopyDistributionsWithConvert(timePoints, timePoints, _source);
+	}
 }
 
 void CPhase::Extrapolate(double _timeExtra, double _time)
@@ -183,6 +190,11 @@ const CTimeDependentValue* CPhase::Fractions() const
 	return &m_fractions;
 }
 
+uint64_t CPhase::GetDataVersion() const
+{
+	return std::max(m_fractions.GetDataVersion(), m_distribution.GetDataVersion());
+}
+
 void CPhase::SetCacheSettings(const SCacheSettings& _cache)
 {
 	m_fractions.SetCacheSettings(_cache);
@@ -223,30 +235,19 @@ void CPhase::LoadFromFile(const CH5Handler& _h5File, const std::string& _path)
 	m_distribution.LoadFromFile(_h5File, _path + "/" + StrConst::Phase_H5Distribution);
 }
 
-template <typename T>
-void SetConvertedDistribution(EDistrTypes _dim, double _srcTime, double _dstTime, const CMDMatrix& _srcDistr, CMDMatrix& _dstDistr, const CGridDimension* _srcGridDim, const CGridDimension* _dstGridDim)
+bool CPhase::HasSameDistributionGrid(const CPhase& _source) const
 {
-	const auto& srcGrid = dynamic_cast<const T*>(_srcGridDim)->Grid();
-	const auto& dstGrid = dynamic_cast<const T*>(_dstGridDim)->Grid();
-	const auto srcDistr = _srcDistr.GetDistribution(_srcTime, _dim);
-	_dstDistr.AddTimePoint(_dstTime);
-	_dstDistr.SetDistribution(_dstTime, _dim, Normalized(ConvertOnNewGrid(srcGrid, srcDistr, dstGrid)));
+	// non-solid phases only have distributions by compounds, which are equal in all phases
+	return m_state != EPhase::SOLID || m_grid == _source.m_grid;
 }
 
-void CPhase::CopyDistributionsWithConvert(double _srcTime, double _dstTime, const CPhase& _srcPhase, CPhase& _dstPhase)
+void CPhase::CopyDistributionsWithConvert(const std::vector<double>& _srcTimes, const std::vector<double>& _dstTimes, const CPhase& _source)
 {
-	for (const auto& dim : _dstPhase.m_grid.GetDimensionsTypes())
-	{
-		const auto* srcGridDim = _srcPhase.m_grid.GetGridDimension(dim);
-		const auto* dstGridDim = _dstPhase.m_grid.GetGridDimension(dim);
-		if (srcGridDim && srcGridDim->GridType() == dstGridDim->GridType())
-		{
-			if (srcGridDim->GridType() == EGridEntry::GRID_NUMERIC)
-				SetConvertedDistribution<CGridDimensionNumeric >(dim, _srcTime, _dstTime, _srcPhase.m_distribution, _dstPhase.m_distribution, srcGridDim, dstGridDim);
-			else
-				SetConvertedDistribution<CGridDimensionSymbolic>(dim, _srcTime, _dstTime, _srcPhase.m_distribution, _dstPhase.m_distribution, srcGridDim, dstGridDim);
-		}
-		else
-			_dstPhase.m_distribution.SetDistribution(_dstTime, dim, std::vector<double>(dstGridDim->ClassesNumber(), 1.0 / static_cast<double>(dstGridDim->ClassesNumber())));
-	}
-}
\ No newline at end of file
+	if (_dstTimes.empty()) return;
+	// the operator is created once for each pair of grids, so it is reused by all subsequent copies from the same source
+	if (!m_transfer.IsFor(_source.m_grid, m_grid))
+		m_transfer = CGridTransfer{ _source.m_grid, m_grid };
+	m_distribution.AddTimePoints(_dstTimes);
+	for (size_t i = 0; i < _dstTimes.size(); ++i)
+		m_distribution.SetDistribution(_dstTimes[i], m_transfer.Apply(_source.m_distribution.GetDistribution(_srcTimes[i])));
+}
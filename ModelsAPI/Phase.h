@@ -4,6 +4,7 @@
 
 #include "MDMatrix.h"
 #include "MultidimensionalGrid.h"
+#include "GridTransfer.h"
 #include "TimeDependentValue.h"
 
 class CMultidimensionalGrid;
@@ -19,6 +20,7 @@ class CPhase
 	EPhase m_state{ EPhase::UNDEFINED };	// Aggregation state.
 	CTimeDependentValue m_fractions;		// Mass fraction of this phase at each time point.
 	CMDMatrix m_distribution;				// Multidimensional distributed parameters.
+	CGridTransfer m_transfer;				// Transfer of distributions from the grid of the last source phase with a different grid.
 
 public:
 	CPhase(EPhase _state, std::string _name, CMultidimensionalGrid _grid, const SCacheSettings& _cache);
@@ -58,6 +60,8 @@ public:
 
 	// Returns mass fractions of all defined compounds in the phase at the given time point.
 	std::vector<double> GetCompoundsDistribution(double _time) const;
+	// Returns mass fractions of all defined compounds in the phase at all given time points as a contiguous block [_times.size() x number of compounds].
+	std::vector<double> GetCompoundsDistributions(const std::vector<double>& _times) const;
 	// Sets mass fractions of all defined compounds in the phase at the given time point.
 	void SetCompoundsDistribution(double _time, const std::vector<double>& _value);
 
@@ -85,6 +89,9 @@ public:
 	// Returns a const pointer to phase fractions.
 	const CTimeDependentValue* Fractions() const;
 
+	// Returns version of data, which changes with each modification of fractions or distributions.
+	uint64_t GetDataVersion() const;
+
 	// Sets new caching parameters.
 	void SetCacheSettings(const SCacheSettings& _cache);
 
@@ -97,6 +104,8 @@ public:
 	void LoadFromFile(const CH5Handler& _h5File, const std::string& _path);
 
 private:
-	// Copies data from source distribution to destination converting the data to destination grids.
-	static void CopyDistributionsWithConvert(double _srcTime, double _dstTime, const CPhase& _srcPhase, CPhase& _dstPhase);
+	// Checks whether distributions of the source phase can be copied without conversion.
+	bool HasSameDistributionGrid(const CPhase& _source) const;
+	// Copies distributions from the source phase at the given time points, converting them conservatively to the own grid.
+	void CopyDistributionsWithConvert(const std::vector<double>& _srcTimes, const std::vector<double>& _dstTimes, const CPhase& _source);
 };
@@ -124,12 +124,216 @@ void CStateVariable::AddToHistory(double _time, double _value)
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// CArrayStateVariable
+//
+
+CArrayStateVariable::CArrayStateVariable(std::string _name, std::vector<double> _initValues) :
+	m_name{ std::move(_name) },
+	m_values{ std::move(_initValues) },
+	m_valuesStored(m_values.size(), 0.0)
+{
+}
+
+void CArrayStateVariable::Clear()
+{
+	std::fill(m_values.begin(), m_values.end(), 0.0);
+	std::fill(m_valuesStored.begin(), m_valuesStored.end(), 0.0);
+	m_times.clear();
+	m_history.clear();
+}
+
+std::string CArrayStateVariable::GetName() const
+{
+	return m_name;
+}
+
+void CArrayStateVariable::SetName(const std::string& _name)
+{
+	m_name = _name;
+}
+
+size_t CArrayStateVariable::GetSize() const
+{
+	return m_values.size();
+}
+
+double CArrayStateVariable::GetValue(size_t _index) const
+{
+	if (_index >= m_values.size()) return {};
+	return m_values[_index];
+}
+
+const std::vector<double>& CArrayStateVariable::GetValues() const
+{
+	return m_values;
+}
+
+void CArrayStateVariable::SetValue(size_t _index, double _value)
+{
+	if (_index >= m_values.size()) return;
+	m_values[_index] = _value;
+}
+
+void CArrayStateVariable::SetValues(const double* _values)
+{
+	if (_values == m_values.data()) return;
+	std::copy_n(_values, m_values.size(), m_values.begin());
+}
+
+void CArrayStateVariable::SetValues(double _time, const double* _values)
+{
+	SetValues(_values);
+	AddToHistory(_time, _values);
+}
+
+void CArrayStateVariable::SaveState()
+{
+	m_valuesStored = m_values;
+}
+
+void CArrayStateVariable::LoadState()
+{
+	m_values = m_valuesStored;
+}
+
+bool CArrayStateVariable::HasHistory() const
+{
+	return m_times.size() > 1;
+}
+
+const std::vector<double>& CArrayStateVariable::GetHistoryTimes() const
+{
+	return m_times;
+}
+
+const double* CArrayStateVariable::GetHistoryValues(size_t _iTime) const
+{
+	if (_iTime >= m_times.size()) return nullptr;
+	return m_history.data() + _iTime * m_values.size();
+}
+
+std::vector<STDValue> CArrayStateVariable::GetHistory(size_t _index) const
+{
+	if (_index >= m_values.size()) return {};
+	const size_t size = m_values.size();
+	std::vector<STDValue> res(m_times.size());
+	for (size_t i = 0; i < m_times.size(); ++i)
+		res[i] = { m_times[i], m_history[i * size + _index] };
+	return res;
+}
+
+double CArrayStateVariable::GetHistoryValue(size_t _index, double _time) const
+{
+	if (!HasHistory() || _index >= m_values.size()) return {};
+	const size_t size = m_values.size();
+
+	const auto upper = std::upper_bound(m_times.begin(), m_times.end(), _time);
+	if (upper == m_times.end())   return m_history[(m_times.size() - 1) * size + _index]; // nearest-neighbor extrapolation to the right
+	if (upper == m_times.begin()) return m_history[_index];                                // nearest-neighbor extrapolation to the left
+
+	const size_t iUpper = std::distance(m_times.begin(), upper);
+	const size_t iLower = iUpper - 1;
+	const double upperValue = m_history[iUpper * size + _index];
+	const double lowerValue = m_history[iLower * size + _index];
+
+	if (std::abs(m_times[iUpper] - _time) <= m_eps) return upperValue; // exact value found
+	if (std::abs(m_times[iLower] - _time) <= m_eps) return lowerValue; // exact value found
+
+	return Interpolate(m_times[iLower], m_times[iUpper], lowerValue, upperValue, _time); // linearly interpolated value
+}
+
+std::vector<double> CArrayStateVariable::GetHistoryValues(double _time) const
+{
+	if (!HasHistory()) return {};
+	const size_t size = m_values.size();
+
+	const auto upper = std::upper_bound(m_times.begin(), m_times.end(), _time);
+	if (upper == m_times.end())   return { m_history.end() - size, m_history.end() };       // nearest-neighbor extrapolation to the right
+	if (upper == m_times.begin()) return { m_history.begin(), m_history.begin() + size };   // nearest-neighbor extrapolation to the left
+
+	const size_t iUpper = std::distance(m_times.begin(), upper);
+	const size_t iLower = iUpper - 1;
+	const double* upperValues = m_history.data() + iUpper * size;
+	const double* lowerValues = m_history.data() + iLower * size;
+
+	if (std::abs(m_times[iUpper] - _time) <= m_eps) return { upperValues, upperValues + size }; // exact values found
+	if (std::abs(m_times[iLower] - _time) <= m_eps) return { lowerValues, lowerValues + size }; // exact values found
+
+	// linearly interpolated values
+	std::vector<double> res(size);
+	for (size_t i = 0; i < size; ++i)
+		res[i] = Interpolate(m_times[iLower], m_times[iUpper], lowerValues[i], upperValues[i], _time);
+	return res;
+}
+
+void CArrayStateVariable::SaveToFile(CH5Handler& _h5File, const std::string& _path) const
+{
+	if (!_h5File.IsValid()) return;
+
+	// current version of save procedure
+	_h5File.WriteAttribute(_path, StrConst::H5AttrSaveVersion, m_saveVersion);
+
+	_h5File.WriteData(_path, StrConst::ASVar_H5Name,          m_name);
+	_h5File.WriteData(_path, StrConst::ASVar_H5Values,        m_values);
+	_h5File.WriteData(_path, StrConst::ASVar_H5HistoryTimes,  m_times);
+	_h5File.WriteData(_path, StrConst::ASVar_H5HistoryValues, m_history);
+}
+
+void CArrayStateVariable::LoadFromFile(CH5Handler& _h5File, const std::string& _path)
+{
+	if (!_h5File.IsValid()) return;
+
+	// current version of save procedure
+	//const int version = _h5File.ReadAttribute(_path, StrConst::H5AttrSaveVersion);
+
+	_h5File.ReadData(_path, StrConst::ASVar_H5Name,          m_name);
+	_h5File.ReadData(_path, StrConst::ASVar_H5Values,        m_values);
+	_h5File.ReadData(_path, StrConst::ASVar_H5HistoryTimes,  m_times);
+	_h5File.ReadData(_path, StrConst::ASVar_H5HistoryValues, m_history);
+	m_valuesStored.assign(m_values.size(), 0.0);
+	// ignore inconsistent history
+	if (m_history.size() != m_times.size() * m_values.size())
+	{
+		m_times.clear();
+		m_history.clear();
+	}
+}
+
+void CArrayStateVariable::AddToHistory(double _time, const double* _values)
+{
+	if (_time < 0) return;
+	const size_t size = m_values.size();
+	if (m_times.empty() || m_times.back() < _time)				// time is larger as all already stored
+	{
+		// add it to the end
+		m_times.push_back(_time);
+		m_history.insert(m_history.end(), _values, _values + size);
+	}
+	else if (std::abs(m_times.back() - _time) <= m_eps)			// this time is the last stored
+	{
+		// replace it
+		m_times.back() = _time;
+		std::copy_n(_values, size, m_history.end() - size);
+	}
+	else														// there are larger time points
+	{
+		// clear larger time points
+		m_times.erase(std::lower_bound(m_times.begin(), m_times.end(), _time), m_times.end());
+		m_history.resize(m_times.size() * size);
+		// add values
+		m_times.push_back(_time);
+		m_history.insert(m_history.end(), _values, _values + size);
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // CStateVariablesManager
 //
 
 CStateVariablesManager::CStateVariablesManager(const CStateVariablesManager& _other)
 	: m_stateVariables{ DeepCopy(_other.m_stateVariables) }
+	, m_arrayStateVariables{ DeepCopy(_other.m_arrayStateVariables) }
 {
 }
 
@@ -155,6 +359,7 @@ void swap(CStateVariablesManager& _first, CStateVariablesManager& _second) noexc
 {
 	using std::swap;
 	swap(_first.m_stateVariables, _second.m_stateVariables);
+	swap(_first.m_arrayStateVariables, _second.m_arrayStateVariables);
 }
 
 CStateVariable* CStateVariablesManager::AddStateVariable(const std::string& _name, double _initValue)
@@ -227,27 +432,95 @@ size_t CStateVariablesManager::GetStateVariablesNumber() const
 	return m_stateVariables.size();
 }
 
+CArrayStateVariable* CStateVariablesManager::AddArrayStateVariable(const std::string& _name, const std::vector<double>& _initValues)
+{
+	if (GetArrayStateVariable(_name)) return nullptr;
+	m_arrayStateVariables.emplace_back(new CArrayStateVariable{ _name, _initValues });
+	return m_arrayStateVariables.back().get();
+}
+
+const CArrayStateVariable* CStateVariablesManager::GetArrayStateVariable(size_t _index) const
+{
+	if (_index >= m_arrayStateVariables.size()) return {};
+	return m_arrayStateVariables[_index].get();
+}
+
+CArrayStateVariable* CStateVariablesManager::GetArrayStateVariable(size_t _index)
+{
+	return const_cast<CArrayStateVariable*>(const_cast<const CStateVariablesManager&>(*this).GetArrayStateVariable(_index));
+}
+
+const CArrayStateVariable* CStateVariablesManager::GetArrayStateVariable(const std::string& _name) const
+{
+	for (const auto& v : m_arrayStateVariables)
+		if (v->GetName() == _name)
+			return v.get();
+	return nullptr;
+}
+
+CArrayStateVariable* CStateVariablesManager::GetArrayStateVariable(const std::string& _name)
+{
+	return const_cast<CArrayStateVariable*>(const_cast<const CStateVariablesManager&>(*this).GetArrayStateVariable(_name));
+}
+
+std::vector<const CArrayStateVariable*> CStateVariablesManager::GetAllArrayStateVariables() const
+{
+	std::vector<const CArrayStateVariable*> res;
+	for (const auto& v : m_arrayStateVariables)
+		res.push_back(v.get());
+	return res;
+}
+
+std::vector<CArrayStateVariable*> CStateVariablesManager::GetAllArrayStateVariables()
+{
+	std::vector<CArrayStateVariable*> res;
+	for (auto& v : m_arrayStateVariables)
+		res.push_back(v.get());
+	return res;
+}
+
+std::vector<const CArrayStateVariable*> CStateVariablesManager::GetAllArrayStateVariablesWithHistory() const
+{
+	std::vector<const CArrayStateVariable*> res;
+	for (const auto& v : m_arrayStateVariables)
+		if (v->HasHistory())
+			res.push_back(v.get());
+	return res;
+}
+
+size_t CStateVariablesManager::GetArrayStateVariablesNumber() const
+{
+	return m_arrayStateVariables.size();
+}
+
 void CStateVariablesManager::ClearData()
 {
 	for (auto& v : m_stateVariables)
 		v->Clear();
+	for (auto& v : m_arrayStateVariables)
+		v->Clear();
 }
 
 void CStateVariablesManager::Clear()
 {
 	m_stateVariables.clear();
+	m_arrayStateVariables.clear();
 }
 
 void CStateVariablesManager::SaveState()
 {
 	for (auto& var : m_stateVariables)
 		var->SaveState();
+	for (auto& var : m_arrayStateVariables)
+		var->SaveState();
 }
 
 void CStateVariablesManager::LoadState()
 {
 	for (auto& var : m_stateVariables)
 		var->LoadState();
+	for (auto& var : m_arrayStateVariables)
+		var->LoadState();
 }
 
 void CStateVariablesManager::SaveToFile(CH5Handler& _h5File, const std::string& _path) const
@@ -263,6 +536,13 @@ void CStateVariablesManager::SaveToFile(CH5Handler& _h5File, const std::string&
 		const std::string variablePath = _h5File.CreateGroup(_path, StrConst::SVMngr_H5GroupStateVarName + std::to_string(i));
 		m_stateVariables[i]->SaveToFile(_h5File, variablePath);
 	}
+
+	_h5File.WriteAttribute(_path, StrConst::SVMngr_H5AttrArrayStateVarsNum, static_cast<int>(m_arrayStateVariables.size()));
+	for (size_t i = 0; i < m_arrayStateVariables.size(); ++i)
+	{
+		const std::string variablePath = _h5File.CreateGroup(_path, StrConst::SVMngr_H5GroupArrayStateVarName + std::to_string(i));
+		m_arrayStateVariables[i]->SaveToFile(_h5File, variablePath);
+	}
 }
 
 void CStateVariablesManager::LoadFromFile(CH5Handler& _h5File, const std::string& _path)
@@ -272,7 +552,7 @@ void CStateVariablesManager::LoadFromFile(CH5Handler& _h5File, const std::string
 	if (!_h5File.IsValid()) return;
 
 	// current version of save procedure
-	//const int version = _h5File.ReadAttribute(_path, StrConst::H5AttrSaveVersion);
+	const int version = _h5File.ReadAttribute(_path, StrConst::H5AttrSaveVersion);
 
 	const size_t nVariables = _h5File.ReadAttribute(_path, StrConst::SVMngr_H5AttrStateVarsNum);
 	for (size_t i = 0; i < nVariables; ++i)
@@ -280,6 +560,16 @@ void CStateVariablesManager::LoadFromFile(CH5Handler& _h5File, const std::string
 		const std::string variablePath = _path + "/" + StrConst::SVMngr_H5GroupStateVarName + std::to_string(i);
 		AddStateVariable("", {})->LoadFromFile(_h5File, variablePath);
 	}
+
+	if (version < 2) return;
+
+	const size_t nArrayVariables = _h5File.ReadAttribute(_path, StrConst::SVMngr_H5AttrArrayStateVarsNum);
+	for (size_t i = 0; i < nArrayVariables; ++i)
+	{
+		const std::string variablePath = _path + "/" + StrConst::SVMngr_H5GroupArrayStateVarName + std::to_string(i);
+		m_arrayStateVariables.emplace_back(new CArrayStateVariable{ "", {} });
+		m_arrayStateVariables.back()->LoadFromFile(_h5File, variablePath);
+	}
 }
 
 void CStateVariablesManager::LoadFromFile_v0(const CH5Handler& _h5File, const std::string& _path)
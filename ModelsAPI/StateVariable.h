@@ -130,6 +130,161 @@ private:
 	void AddToHistory(double _time, double _value);	// Adds the given value to the history and removes all data after the given time.
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// CArrayStateVariable
+//
+
+/**
+ * \brief Description of a time-dependent state variable of the unit consisting of several values.
+ * \details Used instead of multiple scalar state variables to track arrays of values, which change simultaneously, e.g. a particle size distribution.
+ * All values share a single time axis. The history is stored contiguously as a [time x size] matrix.
+ */
+class CArrayStateVariable
+{
+	static constexpr unsigned m_saveVersion{ 1 };	// Current version of the saving procedure.
+
+	inline static const double m_eps{ 16 * std::numeric_limits<double>::epsilon() };
+
+	std::string m_name;					// Name of the state variable.
+	std::vector<double> m_values;		// Current values of the state variable.
+	std::vector<double> m_valuesStored;	// Memory for temporary storage of the state variable for cyclic recalculations.
+
+	std::vector<double> m_times;		// Time points of the stored history.
+	std::vector<double> m_history;		// Stored history of time-dependent changes, [time x size], row-major.
+
+public:
+	/**
+	 * \private
+	 * \param _name Name of the state variable.
+	 * \param _initValues Initial values of the state variable. Define the size of the variable.
+	 */
+	CArrayStateVariable(std::string _name, std::vector<double> _initValues);
+
+	/**
+	 * \private
+	 * \brief Clears state variable.
+	 * \details Keeps the size of the state variable.
+	 */
+	void Clear();
+
+	/**
+	 * \brief Returns name of the state variable.
+	 * \return Name of the state variable.
+	 */
+	std::string GetName() const;
+	/**
+	 * \private
+	 * \brief Sets name of the state variable.
+	 * \param _name Name of the state variable.
+	 */
+	void SetName(const std::string& _name);
+
+	/**
+	 * \brief Returns the number of values in the state variable.
+	 * \return Number of values.
+	 */
+	size_t GetSize() const;
+
+	/**
+	 * \brief Returns current value of the state variable with the given index.
+	 * \param _index Index of the value.
+	 * \return Current value.
+	 */
+	double GetValue(size_t _index) const;
+	/**
+	 * \brief Returns all current values of the state variable.
+	 * \return Current values.
+	 */
+	const std::vector<double>& GetValues() const;
+	/**
+	 * \private
+	 * \brief Sets new value of the state variable with the given index.
+	 * \details Does not affect the history of changes.
+	 * \param _index Index of the value.
+	 * \param _value New value.
+	 */
+	void SetValue(size_t _index, double _value);
+	/**
+	 * \private
+	 * \brief Sets new values of the state variable.
+	 * \param _values Pointer to the new values. Must point to at least GetSize() values.
+	 */
+	void SetValues(const double* _values);
+	/**
+	 * \private
+	 * \brief Sets new values of the state variable and saves them in the history of changes.
+	 * \param _time Time point.
+	 * \param _values Pointer to the new values. Must point to at least GetSize() values.
+	 */
+	void SetValues(double _time, const double* _values);
+
+	/**
+	 * \private
+	 * \brief Stores current values of the state variable.
+	 */
+	void SaveState();
+	/**
+	 * \private
+	 * \brief Restores previously stored values of the state variable.
+	 */
+	void LoadState();
+
+	/**
+	 * \brief Checks whether the state variable contains a stored history of time-dependent changes.
+	 * \return Whether the state variable stores history.
+	 */
+	bool HasHistory() const;
+	/**
+	 * \brief Returns time points of the stored history.
+	 * \return Time points of the history.
+	 */
+	const std::vector<double>& GetHistoryTimes() const;
+	/**
+	 * \brief Returns pointer to all values stored in the history for the time point with the given index.
+	 * \param _iTime Index of the time point in the history.
+	 * \return Pointer to GetSize() values or nullptr if the index is out of range.
+	 */
+	const double* GetHistoryValues(size_t _iTime) const;
+	/**
+	 * \brief Returns the stored history of time-dependent changes of the value with the given index.
+	 * \param _index Index of the value.
+	 * \return History of time-dependent changes.
+	 */
+	std::vector<STDValue> GetHistory(size_t _index) const;
+	/**
+	 * \brief Returns a value with the given index for a given time point from the stored history.
+	 * \details Interpolates the value if it is required.
+	 * \param _index Index of the value.
+	 * \param _time Time point.
+	 * \return Value at the given time point.
+	 */
+	double GetHistoryValue(size_t _index, double _time) const;
+	/**
+	 * \brief Returns all values for a given time point from the stored history.
+	 * \details Interpolates the values if it is required.
+	 * \param _time Time point.
+	 * \return Values at the given time point.
+	 */
+	std::vector<double> GetHistoryValues(double _time) const;
+
+	/**
+	 * \private
+	 * \brief Saves data to file.
+	 * \param _h5File Reference to the file handler.
+	 * \param _path Path to data in the file.
+	 */
+	void SaveToFile(CH5Handler& _h5File, const std::string& _path) const;
+	/**
+	 * \private
+	 * \brief Loads data from file.
+	 * \param _h5File Reference to the file handler.
+	 * \param _path Path to data in the file.
+	 */
+	void LoadFromFile(CH5Handler& _h5File, const std::string& _path);
+private:
+	void AddToHistory(double _time, const double* _values);	// Adds the given values to the history and removes all data after the given time.
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // CStateVariablesManager
 //
@@ -139,9 +294,10 @@ private:
 */
 class CStateVariablesManager
 {
-	static constexpr unsigned m_saveVersion{ 1 };	// Current version of the saving procedure.
+	static constexpr unsigned m_saveVersion{ 2 };	// Current version of the saving procedure.
 
-	std::vector<std::unique_ptr<CStateVariable>> m_stateVariables;	// Defined state variables.
+	std::vector<std::unique_ptr<CStateVariable>> m_stateVariables;				// Defined state variables.
+	std::vector<std::unique_ptr<CArrayStateVariable>> m_arrayStateVariables;	// Defined array state variables.
 
 public:
 	/**
@@ -246,6 +402,61 @@ public:
 	 */
 	size_t GetStateVariablesNumber() const;
 
+	/**
+	 * \private
+	 * \brief Adds a new time-dependent array state variable and returns a pointer to it.
+	 * \details If an array state variable with this name already exists, does nothing and returns nullptr.
+	 * \param _name Name of the state variable.
+	 * \param _initValues Initial values of the state variable.
+	 * \return Pointer to added state variable.
+	 */
+	CArrayStateVariable* AddArrayStateVariable(const std::string& _name, const std::vector<double>& _initValues);
+	/**
+	 * \brief Returns an array state variable with the specified index.
+	 * \param _index Index of the state variable.
+	 * \return Const pointer to state variable.
+	 */
+	const CArrayStateVariable* GetArrayStateVariable(size_t _index) const;
+	/**
+	 * \brief Returns an array state variable with the specified index.
+	 * \param _index Index of the state variable.
+	 * \return Pointer to state variable.
+	 */
+	CArrayStateVariable* GetArrayStateVariable(size_t _index);
+	/**
+	 * \brief Returns an array state variable with the specified name.
+	 * \param _name Name of the state variable.
+	 * \return Const pointer to state variable.
+	 */
+	const CArrayStateVariable* GetArrayStateVariable(const std::string& _name) const;
+	/**
+	 * \brief Returns an array state variable with the specified name.
+	 * \param _name Name of the state variable.
+	 * \return Pointer to state variable.
+	 */
+	CArrayStateVariable* GetArrayStateVariable(const std::string& _name);
+	/**
+	 * \brief Returns const pointers to all defined array state variables.
+	 * \return Const pointers to all array state variables.
+	 */
+	std::vector<const CArrayStateVariable*> GetAllArrayStateVariables() const;
+	/**
+	 * \brief Returns pointers to all defined array state variables.
+	 * \return Pointers to all array state variables.
+	 */
+	std::vector<CArrayStateVariable*> GetAllArrayStateVariables();
+	/**
+	 * \private
+	 * \brief Returns const pointers to all defined array state variables that track history of changes.
+	 * \return Const pointers to all array state variables with history.
+	 */
+	std::vector<const CArrayStateVariable*> GetAllArrayStateVariablesWithHistory() const;
+	/**
+	 * \brief Returns number of defined array state variables.
+	 * \return Number of array state variables.
+	 */
+	size_t GetArrayStateVariablesNumber() const;
+
 	/**
 	 * \private
 	 * \brief Clears all data in all state variables.
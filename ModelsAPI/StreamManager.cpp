@@ -551,6 +551,26 @@ void CStreamManager::ReduceTimePoints(double _timeBeg, double _timeEnd, double _
 	for (auto& s : m_streamsStored)	s->ReduceTimePoints(_timeBeg, _timeEnd, _step);
 }
 
+void CStreamManager::CopyUserData(const CStreamManager& _other)
+{
+	// copy init and working streams
+	CopyObjects(m_feedsInit,   _other.m_feedsInit,   &CStreamManager::AddFeed);
+	CopyObjects(m_feedsWork,   _other.m_feedsWork,   &CStreamManager::AddFeed);
+	CopyObjects(m_holdupsInit, _other.m_holdupsInit, &CStreamManager::AddHoldup);
+	CopyObjects(m_holdupsWork, _other.m_holdupsWork, &CStreamManager::AddHoldup);
+	CopyObjects(m_streamsWork, _other.m_streamsWork, &CStreamManager::AddStream);
+
+	// properly configure store streams
+	for (size_t i = 0; i < m_holdupsStored.size(); ++i)
+		m_holdupsStored[i]->SetupStructure(m_holdupsWork[i].get());
+	for (size_t i = 0; i < m_streamsStored.size(); ++i)
+		m_streamsStored[i]->SetupStructure(m_streamsWork[i].get());
+
+	// store number of variable objects
+	m_nVarHoldups = m_holdupsWork.size() - m_nFixHoldups;
+	m_nVarStreams = m_streamsWork.size() - m_nFixStreams;
+}
+
 void CStreamManager::SaveToFile(CH5Handler& _h5File, const std::string& _path) const
 {
 	if (!_h5File.IsValid()) return;
@@ -826,6 +846,35 @@ void CStreamManager::LoadObjects(const CH5Handler& _h5File, const std::string& _
 	}
 }
 
+template <typename T>
+void CStreamManager::CopyObjects(const std::vector<std::unique_ptr<T>>& _streams, const std::vector<std::unique_ptr<T>>& _source, AddObjectFun<T> _addObjectFun)
+{
+	const auto Copy = [](T& _dst, const T& _src)
+	{
+		_dst.SetupStructure(&_src);
+		if (!_src.GetAllTimePoints().empty())
+			_dst.Copy(0.0, _src.GetLastTimePoint(), _src);
+	};
+
+	std::vector<bool> streamCopied(_source.size(), false); // whether a source stream is already used to copy an existing stream
+	// copy fixed by names
+	for (const auto& stream : _streams)
+		for (size_t i = 0; i < _source.size(); ++i)
+			if (!streamCopied[i] && stream->GetName() == _source[i]->GetName())
+			{
+				Copy(*stream, *_source[i]);
+				streamCopied[i] = true;
+				break;
+			}
+	// copy the rest, if any, as variable objects
+	for (size_t i = 0; i < _source.size(); ++i)
+		if (!streamCopied[i])
+		{
+			(this->*_addObjectFun)(_source[i]->GetName()); // add a corresponding object as variable
+			Copy(*_streams.back(), *_source[i]);
+		}
+}
+
 template <typename T>
 std::vector<std::string> CStreamManager::GetAllKeys(const std::vector<std::unique_ptr<T>>& _streams) const
 {
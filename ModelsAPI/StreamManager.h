@@ -211,6 +211,9 @@ public:
 	// Removes time points within the specified interval [timeBeg; timeEnd) that are closer together than step.
 	void ReduceTimePoints(double _timeBeg, double _timeEnd, double _step);
 
+	// Copies data of all feeds, holdups and streams from another manager, keeping own objects of the same name. Missing objects are added as variable ones.
+	void CopyUserData(const CStreamManager& _other);
+
 	// Saves data to file.
 	void SaveToFile(CH5Handler& _h5File, const std::string& _path) const;
 	// Loads data from file.
@@ -252,6 +255,9 @@ private:
 	using AddObjectFun = T* (CStreamManager::*)(const std::string&);
 	template<typename T>
 	void LoadObjects(const CH5Handler& _h5File, const std::string& _path, const std::vector<std::unique_ptr<T>>& _streams, const std::string& _attribute, const std::string& _group, const std::string& _subgroup, const std::string& _namespath, AddObjectFun<T> _addObjectFun);
+	// Copies all streams from the given list of another manager. Adds new variable objects if necessary during copying.
+	template<typename T>
+	void CopyObjects(const std::vector<std::unique_ptr<T>>& _streams, const std::vector<std::unique_ptr<T>>& _source, AddObjectFun<T> _addObjectFun);
 
 	// Returns keys of all the streams from the list.
 	template<typename T>
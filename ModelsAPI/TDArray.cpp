@@ -2,6 +2,7 @@
 
 #include "TDArray.h"
 #include "DyssolUtilities.h"
+#include <algorithm>
 
 CTDArray::CTDArray(void):
 	m_nLastTimePos(0)
@@ -41,6 +42,28 @@ void CTDArray::AddTimePoint(double _dTime, double _dSourceTimePoint /*= -1 */)
 		SetData( index, _dTime, GetValue( _dSourceTimePoint ) );
 }
 
+void CTDArray::AddTimePoints(const std::vector<double>& _vTimes)
+{
+	if( m_data.empty() ) // nothing to do if its empty
+		return;
+
+	std::vector<STDValue> vRes;
+	vRes.reserve( m_data.size() + _vTimes.size() );
+	size_t i = 0;
+	for( double t : _vTimes )
+	{
+		if( t < 0 ) // wrong time
+			continue;
+		while( ( i < m_data.size() ) && ( m_data[i].time < t ) )
+			vRes.push_back( m_data[i++] );
+		if( ( i < m_data.size() ) && ( m_data[i].time == t ) ) // time point already exists
+			continue;
+		vRes.emplace_back( t, vRes.empty() ? 0 : vRes.back().value );
+	}
+	vRes.insert( vRes.end(), m_data.begin() + i, m_data.end() );
+	m_data.swap( vRes );
+}
+
 void CTDArray::RemoveTimePoint(double _dTime)
 {
 	size_t index = GetIndexByTime( _dTime );
@@ -111,8 +134,26 @@ double CTDArray::GetValue(double _dTime)
 void CTDArray::GetVectorValue(const std::vector<double>& _dTimes, std::vector<double>& _vRes)
 {
 	_vRes.resize( _dTimes.size() );
-	for(size_t i=0; i<_dTimes.size(); ++i )
-		_vRes[i] = GetValue( _dTimes[i] );
+	if( m_data.size() < 2 || !std::is_sorted( _dTimes.begin(), _dTimes.end() ) )
+	{
+		for( size_t i=0; i<_dTimes.size(); ++i )
+			_vRes[i] = GetValue( _dTimes[i] );
+		return;
+	}
+
+	// sorted times - one merged pass over both arrays, starting from the first requested time
+	size_t j = std::lower_bound( m_data.begin(), m_data.end(), _dTimes.front(), []( const STDValue& _v, double _t ) { return _v.time < _t; } ) - m_data.begin(); // index of the first time point not before the current time
+	for( size_t i=0; i<_dTimes.size(); ++i )
+	{
+		while( j < m_data.size() && m_data[j].time < _dTimes[i] )
+			++j;
+		if( j == m_data.size() ) // point after the last - extrapolation
+			_vRes[i] = m_data.back().value;
+		else if( m_data[j].time == _dTimes[i] || j == 0 ) // time point is found or point at the beginning - extrapolation
+			_vRes[i] = m_data[j].value;
+		else // point inside - interpolation
+			_vRes[i] = Interpolate( m_data[j].time, m_data[j-1].time, m_data[j].value, m_data[j-1].value, _dTimes[i] );
+	}
 }
 
 void CTDArray::SetValue(double _dTime, double _dValue)
@@ -146,16 +187,19 @@ void CTDArray::CopyFrom(CTDArray& _source, double _dStartTime, double _dEndTime)
 		SetValue( _dStartTime, _source.GetValue( _dStartTime ) );
 	else // for time interval
 	{
+		// gather all values of the interval and set them at once
+		std::vector<STDValue> vValues;
 		size_t index = _source.GetIndexByTime( _dStartTime, false );
 		if( ( index != -1 ) && ( index <_source.m_data.size() ) && ( _source.m_data[index].time != _dStartTime ) ) // left boundary of the interval
-			SetValue( _dStartTime, _source.GetValue( _dStartTime ) );
+			vValues.emplace_back( _dStartTime, _source.GetValue( _dStartTime ) );
 		while( ( index < _source.m_data.size() ) && ( _source.m_data[index].time <= _dEndTime ) ) // interval
 		{
-			SetValue( _source.m_data[index].time, _source.m_data[index].value );
+			vValues.push_back( _source.m_data[index] );
 			index++;
 		}
-		if( ( index <_source.m_data.size() ) && ( _source.m_data[index].time != _dEndTime ) ) // right boundary of the interval
-			SetValue( _dEndTime, _source.GetValue( _dEndTime ) );
+		if( ( index <_source.m_data.size() ) && ( vValues.empty() || ( vValues.back().time != _dEndTime ) ) ) // right boundary of the interval
+			vValues.emplace_back( _dEndTime, _source.GetValue( _dEndTime ) );
+		MergeValues( vValues );
 	}
 }
 
@@ -372,6 +416,37 @@ size_t CTDArray::GetIndexByTime(double _dTime, bool _bIsStrict /*= true */)
 		return -1;
 }
 
+void CTDArray::MergeValues(const std::vector<STDValue>& _vValues)
+{
+	if( _vValues.empty() )
+		return;
+
+	// fast path: all new values are after the existing ones
+	if( m_data.empty() || ( m_data.back().time < _vValues.front().time ) )
+	{
+		for( const auto& v : _vValues )
+			if( v.time >= 0 )
+				m_data.emplace_back( v.time, v.value < 0 ? 0 : v.value );
+		return;
+	}
+
+	std::vector<STDValue> vRes;
+	vRes.reserve( m_data.size() + _vValues.size() );
+	size_t i = 0;
+	for( const auto& v : _vValues )
+	{
+		if( v.time < 0 ) // wrong time
+			continue;
+		while( ( i < m_data.size() ) && ( m_data[i].time < v.time ) )
+			vRes.push_back( m_data[i++] );
+		if( ( i < m_data.size() ) && ( m_data[i].time == v.time ) ) // time point already exists
+			++i;
+		vRes.emplace_back( v.time, v.value < 0 ? 0 : v.value );
+	}
+	vRes.insert( vRes.end(), m_data.begin() + i, m_data.end() );
+	m_data.swap( vRes );
+}
+
 void CTDArray::SetData(size_t _nIndex, double _dTime, double _dValue)
 {
 	if( _dTime == -1 ) // value changing, no inserting
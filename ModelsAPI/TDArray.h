@@ -22,6 +22,8 @@ public:
 	/** Adds new time point. If time point already exists, than nothing will be done.
 	*	Data to a new time point will be copied from _dSourceTimePoint. If _dSourceTimePoint == -1, than data will be copied from the previous time point.*/
 	void AddTimePoint( double _dTime, double _dSourceTimePoint = -1 );
+	/** Adds new sorted time points in one pass. Existing time points remain unchanged. Data to new time points will be copied from the previous time points.*/
+	void AddTimePoints( const std::vector<double>& _vTimes );
 	/** Removes time point.*/
 	void RemoveTimePoint( double _dTime );
 	/** Removes all time points from interval (incl).*/
@@ -33,7 +35,7 @@ public:
 
 	/** Returns value according to a specified time. If there is no such point, returns interpolated value. If data can not be obtained, 0 will be returned.*/
 	double GetValue( double _dTime );
-	/** Returns vector of values according to vector of times with interpolation.*/
+	/** Returns vector of values according to vector of times with interpolation. Sorted times are processed in one pass.*/
 	void GetVectorValue( const std::vector<double>& _dTimes, std::vector<double>& _vRes );
 	/** Sets new value to a specified time point. If time point doesn't exist, than it will be created. All negative values will be set to 0.*/
 	void SetValue( double _dTime, double _dValue );
@@ -77,6 +79,9 @@ private:
 	/** Returns index of the time point with value _dTime. Strict search returns -1 if there is no such time, not strict search returns index to paste.*/
 	size_t GetIndexByTime( double _dTime, bool _bIsStrict = true );
 
+	/** Sets new sorted values in one pass, replacing values at existing time points and creating new time points if needed. All negative values will be set to 0.*/
+	void MergeValues( const std::vector<STDValue>& _vValues );
+
 	/** Sets new data using the data approximation. Not using parameters must be set to -1.*/
 	void SetData(size_t _nIndex, double _dTime, double _dValue);
 
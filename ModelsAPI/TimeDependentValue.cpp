@@ -3,6 +3,7 @@
 #include "TimeDependentValue.h"
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
+#include <algorithm>
 #include <utility>
 
 CTimeDependentValue::CTimeDependentValue(std::string _name, std::string _units) :
@@ -50,6 +51,7 @@ void CTimeDependentValue::RemoveTimePoint(double _time)
 
 void CTimeDependentValue::RemoveTimePoints(double _timeBeg, double _timeEnd, bool _inclusive/* = true*/)
 {
+	m_version.MarkModified();
 	if (m_data.empty()) return;
 	if (_timeBeg > _timeEnd) return;
 	const auto [beg, end] = Interval(_timeBeg, _timeEnd, _inclusive);
@@ -59,6 +61,7 @@ void CTimeDependentValue::RemoveTimePoints(double _timeBeg, double _timeEnd, boo
 
 void CTimeDependentValue::RemoveAllTimePoints()
 {
+	m_version.MarkModified();
 	m_data.clear();
 }
 
@@ -79,6 +82,7 @@ std::vector<double> CTimeDependentValue::GetAllTimePoints() const
 void CTimeDependentValue::SetValue(double _time, double _value)
 {
 	if (_time < 0) return;
+	m_version.MarkModified();
 	const auto pos = std::lower_bound(m_data.begin(), m_data.end(), STDValue{ _time, 0.0 });
 	if (pos == m_data.end())							// all existing times are smaller
 		m_data.emplace_back(_time, _value);
@@ -88,6 +92,28 @@ void CTimeDependentValue::SetValue(double _time, double _value)
 		m_data.insert(pos, { _time, _value });
 }
 
+void CTimeDependentValue::SetValues(const std::vector<double>& _times, const std::vector<double>& _values)
+{
+	if (_times.size() != _values.size()) return;
+	m_version.MarkModified();
+	std::vector<STDValue> data;
+	data.reserve(_times.size());
+	for (size_t i = 0; i < _times.size(); ++i)
+		if (_times[i] >= 0)
+			data.emplace_back(_times[i], _values[i]);
+	// merging needs sorted unique time points; for repeated ones, the last value is kept, as with consecutive calls to SetValue()
+	if (!std::is_sorted(data.begin(), data.end()))
+		std::stable_sort(data.begin(), data.end());
+	size_t n = 0;
+	for (size_t i = 0; i < data.size(); ++i)
+		if (n != 0 && data[i].time - data[n - 1].time <= m_eps)
+			data[n - 1] = data[i];
+		else
+			data[n++] = data[i];
+	data.resize(n);
+	Merge(data.begin(), data.end());
+}
+
 double CTimeDependentValue::GetValue(double _time) const
 {
 	if (m_data.empty()) return {};							// return zero, if there are no data at all
@@ -95,8 +121,17 @@ double CTimeDependentValue::GetValue(double _time) const
 	return ::Interpolate(m_data, _time);					// return interpolation otherwise
 }
 
+std::vector<double> CTimeDependentValue::GetValues(const std::vector<double>& _times) const
+{
+	std::vector<double> res(_times.size());
+	for (size_t i = 0; i < _times.size(); ++i)
+		res[i] = GetValue(_times[i]);
+	return res;
+}
+
 void CTimeDependentValue::SetRawData(const std::vector<std::vector<double>>& _data)
 {
+	m_version.MarkModified();
 	m_data.clear();
 	m_data.resize(_data.front().size());
 	for (size_t i = 0; i < _data.front().size(); ++i)
@@ -126,20 +161,22 @@ void CTimeDependentValue::CopyFrom(double _timeDst, const CTimeDependentValue& _
 
 void CTimeDependentValue::CopyFrom(double _timeBeg, double _timeEnd, const CTimeDependentValue& _source)
 {
+	m_version.MarkModified();
 	RemoveTimePoints(_timeBeg, _timeEnd);
 	const auto [beg, end] = _source.Interval(_timeBeg, _timeEnd);
 	if (beg == _source.m_data.end()) return;
-	for (auto it = beg; it != end; ++it)
-		SetValue(it->time, it->value);
+	Merge(beg, end);
 }
 
 void CTimeDependentValue::Extrapolate(double _timeExtra, double _time)
 {
+	m_version.MarkModified();
 	CopyTimePoint(_timeExtra, _time);
 }
 
 void CTimeDependentValue::Extrapolate(double _timeExtra, double _time1, double _time2)
 {
+	m_version.MarkModified();
 	const double v1 = GetValue(_time1);
 	const double v2 = GetValue(_time2);
 	const double res = ::Interpolate(_time1, _time2, v1, v2, _timeExtra);
@@ -148,6 +185,7 @@ void CTimeDependentValue::Extrapolate(double _timeExtra, double _time1, double _
 
 void CTimeDependentValue::Extrapolate(double _timeExtra, double _time1, double _time2, double _time3)
 {
+	m_version.MarkModified();
 	const double v1 = GetValue(_time1);
 	const double v2 = GetValue(_time2);
 	const double v3 = GetValue(_time3);
@@ -155,6 +193,11 @@ void CTimeDependentValue::Extrapolate(double _timeExtra, double _time1, double _
 	SetValue(_timeExtra, res);
 }
 
+uint64_t CTimeDependentValue::GetDataVersion() const
+{
+	return m_version.Get();
+}
+
 void CTimeDependentValue::SetCacheSettings(const SCacheSettings& _cache)
 {
 	// TODO: implement caching
@@ -175,6 +218,7 @@ void CTimeDependentValue::SaveToFile(CH5Handler& _h5File, const std::string& _pa
 
 void CTimeDependentValue::LoadFromFile(const CH5Handler& _h5File, const std::string& _path)
 {
+	m_version.MarkModified();
 	if (!_h5File.IsValid())	return;
 
 	//const int version = _h5File.ReadAttribute(_path, StrConst::H5AttrSaveVersion);
@@ -202,6 +246,30 @@ double CTimeDependentValue::PreviousTime(double _time) const
 	return (--pos)->time;
 }
 
+void CTimeDependentValue::Merge(std::vector<STDValue>::const_iterator _beg, std::vector<STDValue>::const_iterator _end)
+{
+	if (_beg == _end) return;
+	// all new values are after the existing ones
+	if (m_data.empty() || m_data.back().time < _beg->time)
+	{
+		m_data.insert(m_data.end(), _beg, _end);
+		return;
+	}
+	std::vector<STDValue> res;
+	res.reserve(m_data.size() + static_cast<size_t>(std::distance(_beg, _end)));
+	auto pos = m_data.cbegin();
+	for (auto it = _beg; it != _end; ++it)
+	{
+		while (pos != m_data.cend() && pos->time < it->time)
+			res.push_back(*pos++);
+		if (pos != m_data.cend() && pos->time - it->time <= m_eps)	// this time already exists
+			++pos;
+		res.push_back(*it);
+	}
+	res.insert(res.end(), pos, m_data.cend());
+	m_data.swap(res);
+}
+
 std::pair<std::vector<STDValue>::iterator, std::vector<STDValue>::iterator> CTimeDependentValue::Interval(double _timeBeg, double _timeEnd, bool _inclusive/* = true*/)
 {
 	auto end = _inclusive ? std::upper_bound(m_data.begin(), m_data.end(), STDValue{ _timeEnd, 0.0 })
@@ -4,6 +4,7 @@
 
 #include "DyssolTypes.h"
 #include "H5Handler.h"
+#include "DataVersion.h"
 
 /**
 * \brief Class for time-dependent value.
@@ -16,6 +17,7 @@ class CTimeDependentValue
 
 	// TODO: use CDependentValues instead
 	std::vector<STDValue> m_data; // Time-dependent data.
+	CDataVersion m_version;       // Version of data, changes with each modification.
 
 	std::string m_name;
 	std::string m_units;
@@ -46,7 +48,11 @@ public:
 	std::vector<double> GetAllTimePoints() const;	// Returns all defined time points.
 
 	void SetValue(double _time, double _value);	// Sets new value at the given time point. Creates a new time point if needed.
+	// Sets new values at the given time points in one pass. Creates new time points if needed. Time points may be unsorted; for repeated ones, the last value is used.
+	void SetValues(const std::vector<double>& _times, const std::vector<double>& _values);
 	double GetValue(double _time) const;		// Returns the value at the given time point.
+	// Returns the values at the given time points.
+	std::vector<double> GetValues(const std::vector<double>& _times) const;
 
 	// TODO: work with two vectors
 	// Sets new values in form of two vectors: times and values, removing all previously defined data.
@@ -68,6 +74,9 @@ public:
 	// Sets new caching parameters.
 	void SetCacheSettings(const SCacheSettings& _cache);
 
+	// Returns version of data, which changes with each modification.
+	uint64_t GetDataVersion() const;
+
 	//void CrearData();
 
 	// Saves data to file.
@@ -80,6 +89,8 @@ private:
 	bool HasTime(double _time) const;
 	// Returns the nearest time point before _time.
 	double PreviousTime(double _time) const;
+	// Merges sorted values into data in one pass, replacing values at existing time points.
+	void Merge(std::vector<STDValue>::const_iterator _beg, std::vector<STDValue>::const_iterator _end);
 	// Returns iterators pointing on values between the specified interval, including or excluding boundaries. If the values cannot be found, return two iterators to the end.
 	std::pair<std::vector<STDValue>::iterator, std::vector<STDValue>::iterator> Interval(double _timeBeg, double _timeEnd, bool _inclusive = true);
 	// Returns const iterators pointing on values between the specified interval, including or excluding boundaries. If the values cannot be found, return two iterators to the end.
@@ -0,0 +1,179 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "UnitParameters.h"
+#include "StateVariable.h"
+
+/**
+ * \brief Pre-resolved handle to a unit parameter of the given type.
+ * \details Allows to access a unit parameter without searching for it by name on each call.
+ * Should be obtained once with CBaseUnit::GetParameterHandle(), e.g. in CBaseUnit::Initialize(), and used during the simulation.
+ * Remains valid as long as the unit parameter exists.
+ * \tparam T Type of the unit parameter.
+ */
+template<typename T>
+class CUnitParameterHandle
+{
+	const T* m_param{}; ///< Pointer to the unit parameter.
+
+public:
+	/**
+	 * \brief Creates an empty handle.
+	 */
+	CUnitParameterHandle() = default;
+	/**
+	 * \private
+	 * \brief Creates a handle to the given unit parameter.
+	 * \param _param Pointer to the unit parameter.
+	 */
+	explicit CUnitParameterHandle(const T* _param) : m_param{ _param } {}
+
+	/**
+	 * \brief Returns a pointer to the unit parameter.
+	 * \return Pointer to the unit parameter.
+	 */
+	const T* Get() const { return m_param; }
+	/**
+	 * \brief Returns a pointer to the unit parameter.
+	 * \return Pointer to the unit parameter.
+	 */
+	const T* operator->() const { return m_param; }
+	/**
+	 * \brief Checks whether the handle refers to a unit parameter.
+	 * \return Whether the handle is not empty.
+	 */
+	explicit operator bool() const { return m_param != nullptr; }
+};
+
+/**
+ * \brief Pre-resolved handle to a time-dependent unit parameter.
+ * \details Returns the same values as CBaseUnit::GetTDParameterValue(), but without searching for the parameter by name.
+ * Remembers the last used time interval, so that consecutive requests for close time points do not need to search for it again.
+ * Should be obtained once with CBaseUnit::GetTDParameterHandle(), e.g. in CBaseUnit::Initialize(), and used during the simulation.
+ * A handle must not be used from several threads at the same time.
+ */
+class CTDParameterHandle : public CUnitParameterHandle<CTDUnitParameter>
+{
+	mutable size_t m_hint{}; ///< Index of the last used time interval.
+
+public:
+	using CUnitParameterHandle::CUnitParameterHandle;
+
+	/**
+	 * \brief Returns value of the unit parameter at the given time point.
+	 * \details If the selected time point has not been defined, linear interpolation or nearest-neighbor extrapolation will be performed.
+	 * \param _time Target time point.
+	 * \return Value of the unit parameter at the given time point.
+	 */
+	double GetValue(double _time) const { return Get()->GetValue(_time, m_hint); }
+	/**
+	 * \brief Returns value of the unit parameter at the given time point.
+	 * \details Same as GetValue(double).
+	 * \param _time Target time point.
+	 * \return Value of the unit parameter at the given time point.
+	 */
+	double operator()(double _time) const { return GetValue(_time); }
+};
+
+/**
+ * \brief Pre-resolved handle to a state variable of the unit.
+ * \details Allows to read and set a state variable without searching for it by name on each call.
+ * Should be obtained once with CBaseUnit::GetStateVariableHandle(), e.g. in CBaseUnit::Initialize(), and used during the simulation.
+ * Remains valid as long as the state variable exists.
+ */
+class CStateVariableHandle
+{
+	CStateVariable* m_variable{}; ///< Pointer to the state variable.
+
+public:
+	/**
+	 * \brief Creates an empty handle.
+	 */
+	CStateVariableHandle() = default;
+	/**
+	 * \private
+	 * \brief Creates a handle to the given state variable.
+	 * \param _variable Pointer to the state variable.
+	 */
+	explicit CStateVariableHandle(CStateVariable* _variable) : m_variable{ _variable } {}
+
+	/**
+	 * \brief Returns current value of the state variable.
+	 * \return Current value of the state variable.
+	 */
+	double GetValue() const { return m_variable->GetValue(); }
+	/**
+	 * \brief Sets a new value of the state variable.
+	 * \param _value New value of the variable.
+	 */
+	void SetValue(double _value) { m_variable->SetValue(_value); }
+	/**
+	 * \brief Sets a new value of the state variable and adds its value to the history.
+	 * \param _value New value of the variable.
+	 * \param _time Time point for which new value is added to the history.
+	 */
+	void SetValue(double _value, double _time) { m_variable->SetValue(_time, _value); }
+	/**
+	 * \brief Checks whether the handle refers to a state variable.
+	 * \return Whether the handle is not empty.
+	 */
+	explicit operator bool() const { return m_variable != nullptr; }
+};
+
+/**
+ * \brief Pre-resolved handle to an array state variable of the unit.
+ * \details Allows to read and set all values of an array state variable at once without searching for it by name on each call.
+ * Should be obtained once with CBaseUnit::GetArrayStateVariableHandle(), e.g. in CBaseUnit::Initialize(), and used during the simulation.
+ * Remains valid as long as the state variable exists.
+ */
+class CArrayStateVariableHandle
+{
+	CArrayStateVariable* m_variable{}; ///< Pointer to the state variable.
+
+public:
+	/**
+	 * \brief Creates an empty handle.
+	 */
+	CArrayStateVariableHandle() = default;
+	/**
+	 * \private
+	 * \brief Creates a handle to the given state variable.
+	 * \param _variable Pointer to the state variable.
+	 */
+	explicit CArrayStateVariableHandle(CArrayStateVariable* _variable) : m_variable{ _variable } {}
+
+	/**
+	 * \brief Returns the number of values in the state variable.
+	 * \return Number of values.
+	 */
+	size_t GetSize() const { return m_variable->GetSize(); }
+	/**
+	 * \brief Returns current value of the state variable with the given index.
+	 * \param _index Index of the value.
+	 * \return Current value.
+	 */
+	double GetValue(size_t _index) const { return m_variable->GetValue(_index); }
+	/**
+	 * \brief Returns all current values of the state variable.
+	 * \return Current values.
+	 */
+	const std::vector<double>& GetValues() const { return m_variable->GetValues(); }
+	/**
+	 * \brief Sets new values of the state variable.
+	 * \param _values Pointer to the new values. Must point to at least GetSize() values.
+	 */
+	void SetValues(const double* _values) { m_variable->SetValues(_values); }
+	/**
+	 * \brief Sets new values of the state variable and adds them to the history.
+	 * \param _values Pointer to the new values. Must point to at least GetSize() values.
+	 * \param _time Time point for which new values are added to the history.
+	 */
+	void SetValues(const double* _values, double _time) { m_variable->SetValues(_time, _values); }
+	/**
+	 * \brief Checks whether the handle refers to a state variable.
+	 * \return Whether the handle is not empty.
+	 */
+	explicit operator bool() const { return m_variable != nullptr; }
+};
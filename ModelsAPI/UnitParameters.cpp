@@ -179,6 +179,11 @@ double CDependentUnitParameter::GetValue(double _param) const
 	return m_data.GetValue(_param);
 }
 
+double CDependentUnitParameter::GetValue(double _param, size_t& _hint) const
+{
+	return m_data.GetValue(_param, _hint);
+}
+
 void CDependentUnitParameter::SetValue(double _param, double _value)
 {
 	m_data.SetValue(_param, _value);
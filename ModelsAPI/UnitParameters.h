@@ -673,6 +673,15 @@ public:
 	 * \return Value at current dependent parameter.
 	 */
 	double GetValue(double _param) const;
+	/**
+	 * \private
+	 * \brief Returns unit parameter value at given dependent parameter, starting the search from the interval with index _hint.
+	 * \details Applies data interpolation if necessary. Updates _hint with the index of the found interval to speed up consecutive requests.
+	 * \param _param Dependent parameter.
+	 * \param _hint Index of the interval to start the search from.
+	 * \return Value at current dependent parameter.
+	 */
+	double GetValue(double _param, size_t& _hint) const;
 	/**
 	 * \private
 	 * \brief Sets new unit parameter value at given dependent parameter.
@@ -802,6 +802,50 @@ void CUnitParametersManager::ClearGroups()
 	m_groups.clear();
 }
 
+void CUnitParametersManager::CopyUserData(const CUnitParametersManager& _other)
+{
+	// copies the value keeping the own object, since models may store pointers to their parameters
+	const auto Copy = [](CBaseUnitParameter* _dst, const CBaseUnitParameter* _src)
+	{
+		switch (_dst->GetType())
+		{
+		case EUnitParameter::CONSTANT:			*dynamic_cast<CConstUnitParameter<double>*>  (_dst) = *dynamic_cast<const CConstUnitParameter<double>*>  (_src); break;
+		case EUnitParameter::CONSTANT_DOUBLE:	*dynamic_cast<CConstUnitParameter<double>*>  (_dst) = *dynamic_cast<const CConstUnitParameter<double>*>  (_src); break;
+		case EUnitParameter::CONSTANT_INT64: 	*dynamic_cast<CConstUnitParameter<int64_t>*> (_dst) = *dynamic_cast<const CConstUnitParameter<int64_t>*> (_src); break;
+		case EUnitParameter::CONSTANT_UINT64:	*dynamic_cast<CConstUnitParameter<uint64_t>*>(_dst) = *dynamic_cast<const CConstUnitParameter<uint64_t>*>(_src); break;
+		case EUnitParameter::PARAM_DEPENDENT:	*dynamic_cast<CDependentUnitParameter*>      (_dst) = *dynamic_cast<const CDependentUnitParameter*>      (_src); break;
+		case EUnitParameter::TIME_DEPENDENT:	*dynamic_cast<CTDUnitParameter*>             (_dst) = *dynamic_cast<const CTDUnitParameter*>             (_src); break;
+		case EUnitParameter::STRING:			*dynamic_cast<CStringUnitParameter*>         (_dst) = *dynamic_cast<const CStringUnitParameter*>         (_src); break;
+		case EUnitParameter::CHECKBOX:			*dynamic_cast<CCheckBoxUnitParameter*>       (_dst) = *dynamic_cast<const CCheckBoxUnitParameter*>       (_src); break;
+		case EUnitParameter::SOLVER:
+		{
+			auto* solver = dynamic_cast<CSolverUnitParameter*>(_dst);
+			*solver = *dynamic_cast<const CSolverUnitParameter*>(_src);
+			solver->SetSolver(nullptr); // instances of external solvers are created separately for each flowsheet
+			break;
+		}
+		case EUnitParameter::COMBO:				*dynamic_cast<CComboUnitParameter*>          (_dst) = *dynamic_cast<const CComboUnitParameter*>          (_src); break;
+		case EUnitParameter::GROUP:				*dynamic_cast<CComboUnitParameter*>          (_dst) = *dynamic_cast<const CComboUnitParameter*>          (_src); break;
+		case EUnitParameter::COMPOUND:			*dynamic_cast<CCompoundUnitParameter*>       (_dst) = *dynamic_cast<const CCompoundUnitParameter*>       (_src); break;
+		case EUnitParameter::MDB_COMPOUND:		*dynamic_cast<CMDBCompoundUnitParameter*>    (_dst) = *dynamic_cast<const CMDBCompoundUnitParameter*>    (_src); break;
+		case EUnitParameter::REACTION:			*dynamic_cast<CReactionUnitParameter*>       (_dst) = *dynamic_cast<const CReactionUnitParameter*>       (_src); break;
+		case EUnitParameter::LIST_DOUBLE:		*dynamic_cast<CListUnitParameter<double>*>   (_dst) = *dynamic_cast<const CListUnitParameter<double>*>   (_src); break;
+		case EUnitParameter::LIST_INT64: 		*dynamic_cast<CListUnitParameter<int64_t>*>  (_dst) = *dynamic_cast<const CListUnitParameter<int64_t>*>  (_src); break;
+		case EUnitParameter::LIST_UINT64:		*dynamic_cast<CListUnitParameter<uint64_t>*> (_dst) = *dynamic_cast<const CListUnitParameter<uint64_t>*> (_src); break;
+		case EUnitParameter::UNKNOWN: break;
+		}
+	};
+
+	for (size_t i = 0; i < m_parameters.size(); ++i)
+	{
+		size_t iSrc = _other.Name2Index(m_parameters[i]->GetName());	// try to find by name
+		if (iSrc >= _other.m_parameters.size() && i < _other.m_parameters.size()) // get by index if not found by name
+			iSrc = i;
+		if (iSrc < _other.m_parameters.size() && _other.m_parameters[iSrc]->GetType() == m_parameters[i]->GetType())
+			Copy(m_parameters[i].get(), _other.m_parameters[iSrc].get());
+	}
+}
+
 void CUnitParametersManager::SaveToFile(CH5Handler& _h5Saver, const std::string& _path)
 {
 	if (!_h5Saver.IsValid()) return;
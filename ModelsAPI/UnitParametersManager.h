@@ -973,6 +973,15 @@ public:
 	 */
 	void ClearGroups();
 
+	/**
+	 * \private
+	 * \brief Copies values of all parameters from another manager with the same structure.
+	 * \details Parameters are matched by names or, if not found, by indices. Own parameter objects are kept, so pointers to them remain valid.
+	 * Instances of external solvers are not copied.
+	 * \param _other Source manager.
+	 */
+	void CopyUserData(const CUnitParametersManager& _other);
+
 	/**
 	 * \private
 	 * \brief Saves data to file.
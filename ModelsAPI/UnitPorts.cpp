@@ -225,6 +225,13 @@ void CPortsManager::Clear()
 	m_ports.clear();
 }
 
+void CPortsManager::CopyUserData(const CPortsManager& _other)
+{
+	for (const auto& port : m_ports)
+		if (const auto* other = _other.GetPort(port->GetName()))
+			port->SetStreamKey(other->GetStreamKey());
+}
+
 void CPortsManager::SaveToFile(CH5Handler& _h5File, const std::string& _path) const
 {
 	if (!_h5File.IsValid()) return;
@@ -265,6 +265,14 @@ public:
 	 */
 	void Clear();
 
+	/**
+	 * \private
+	 * \brief Copies connections of ports from another manager with the same structure.
+	 * \details Ports are matched by names, pointers to streams are not copied.
+	 * \param _other Source manager.
+	 */
+	void CopyUserData(const CPortsManager& _other);
+
 	/**
 	 * \private
 	 * \brief Saves data to file.
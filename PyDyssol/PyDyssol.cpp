@@ -12,13 +12,14 @@
 #include <pybind11/stl.h>      // For std::vector and std::pair bindings
 #include <pybind11/stl_bind.h>      // For STL bindings with containers
 #include <SaveLoadManager.h>
+#include <Profiler.h>
 #include <algorithm> // For std::find_if
 #include "MultidimensionalGrid.h"
 
 namespace fs = std::filesystem;
 namespace py = pybind11; // Add namespace alias
 
-PyDyssol::PyDyssol(const std::string& materialsPath, const std::string& modelsPath, bool debug)
+PyDyssol::PyDyssol(const std::string& materialsPath, const std::string& modelsPath, bool debug, const std::string& modelsCache)
     : m_flowsheet(&m_modelsManager, &m_materialsDatabase),
     m_defaultMaterialsPath(materialsPath),
     m_defaultModelsPath(modelsPath),
@@ -27,18 +28,30 @@ PyDyssol::PyDyssol(const std::string& materialsPath, const std::string& modelsPa
     m_debug(debug)
 {
     m_simulator.SetFlowsheet(&m_flowsheet);
+    m_simulator.SetConsoleFunction([](const std::string& _message) { std::cout << _message << std::endl; });
     if (m_debug)
         std::cout << "[PyDyssol] Dyssol opened in Debug mode\n";
     if (!LoadMaterialsDatabase(m_defaultMaterialsPath)) {
         throw std::runtime_error("Failed to load default materials database: " + materialsPath);
     }
+    // must be set before models are searched, so that unchanged libraries are not loaded
+    m_modelsManager.SetCacheFile(modelsCache);
     if (!AddModelPath(m_defaultModelsPath)) {
         throw std::runtime_error("Failed to add default model path: " + modelsPath);
     }
 }
 
+PyDyssol::~PyDyssol()
+{
+    // the asynchronous simulation works with members of this object
+    m_simulator.Stop();
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+}
+
 bool PyDyssol::OpenFlowsheet(const std::string& filePath)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Opening flowsheet: " << filePath << std::endl;
     if (!fs::exists(filePath)) {
         std::cerr << "[PyDyssol] Flowsheet file does not exist: " << filePath << std::endl;
@@ -80,6 +93,7 @@ bool PyDyssol::OpenFlowsheet(const std::string& filePath)
 
 void PyDyssol::CloseFlowsheet()
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Closing current flowsheet..." << std::endl;
 
     m_flowsheet.Clear();                      // Clears all flowsheet data
@@ -93,6 +107,7 @@ void PyDyssol::CloseFlowsheet()
 
 bool PyDyssol::SaveFlowsheet(const std::string& filePath)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Saving flowsheet to: " << filePath << std::endl;
 
     // Ensure the directory exists
@@ -168,6 +183,7 @@ void PyDyssol::DebugFlowsheet()
 
 std::string PyDyssol::Initialize()
 {
+    ThrowIfSimulationRunning();
     std::string error = m_flowsheet.Initialize();
     if (!error.empty()) {
         std::cerr << "[PyDyssol] Initialization failed: " << error << std::endl;
@@ -180,6 +196,31 @@ std::string PyDyssol::Initialize()
 }
 
 void PyDyssol::Simulate(double endTime)
+{
+    ThrowIfSimulationRunning();
+    PrepareSimulation(endTime);
+    m_simulator.ClearLogEvents();
+    m_simulationStart = std::chrono::steady_clock::now();
+    m_simulationRunning = true;
+    // clears the running flag also if the simulation throws, so that the flowsheet is not locked forever
+    struct SRunningGuard
+    {
+        PyDyssol& self;
+        ~SRunningGuard()
+        {
+            {
+                std::lock_guard<std::mutex> lock(self.m_simulationMutex);
+                self.m_simulationRunning = false;
+            }
+            self.m_simulationFinished.notify_all();
+        }
+    } running{ *this };
+    // Python is not used during simulation, so other Python threads may run meanwhile
+    py::gil_scoped_release release;
+    RunSimulation();
+}
+
+void PyDyssol::PrepareSimulation(double endTime)
 {
     std::string error = Initialize();
     if (!error.empty())
@@ -209,7 +250,10 @@ void PyDyssol::Simulate(double endTime)
         std::string model = GetModelNameForUnit(unit->GetKey());
         std::cout << "Simulation of " << name << " (" << model << "): [" << simStartTime << ", " << simEndTime << "]..." << std::endl;
     }
+}
 
+void PyDyssol::RunSimulation()
+{
     std::cout << "[PyDyssol] Starting simulation..." << std::endl;
     auto start = std::chrono::high_resolution_clock::now();
     m_simulator.Simulate();
@@ -226,9 +270,161 @@ void PyDyssol::Simulate(double endTime)
     std::cout << "Saving new initial values of tear streams..." << std::endl;
 
     double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1'000'000.0;
+    if (m_simulator.HasError())
+        std::cout << "[PyDyssol] Simulation finished with error: " << m_simulator.GetLastError() << std::endl;
     std::cout << "[PyDyssol] Simulation finished in " << std::fixed << std::setprecision(3) << seconds << " [s]" << std::endl;
 }
 
+void PyDyssol::StartSimulation(double endTime)
+{
+    ThrowIfSimulationRunning();
+    PrepareSimulation(endTime);
+    m_simulator.ClearLogEvents();
+    m_simulationStart = std::chrono::steady_clock::now();
+    m_simulationException = nullptr;
+    m_simulationRunning = true;
+    // so that cancel_simulation() is not lost, if it is called before the thread starts the simulation
+    m_simulator.SetCurrentStatus(ESimulatorState::RUNNING);
+    m_simulationThread = std::thread([this] {
+        try {
+            RunSimulation();
+        }
+        catch (...) {
+            m_simulationException = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_simulationMutex);
+            m_simulationRunning = false;
+        }
+        m_simulationFinished.notify_all();
+    });
+}
+
+pybind11::dict PyDyssol::PollSimulation() const
+{
+    const bool running = m_simulationRunning || m_simulator.GetCurrentStatus() != ESimulatorState::IDLE;
+    const CSimulator::SProgress progress = m_simulator.GetProgress();
+    const CParametersHolder* parameters = m_flowsheet.GetParameters();
+    const double duration = parameters->endSimulationTime - parameters->startSimulationTime;
+
+    // each partition is simulated over the whole time interval one after another
+    double fraction = 0.0;
+    if (!running && !m_simulator.HasError() && progress.partitionsNumber != 0)
+        fraction = 1.0;
+    else if (progress.partitionsNumber != 0) {
+        const double local = duration > 0.0 ? (progress.dTWStart - parameters->startSimulationTime) / duration : 0.0;
+        fraction = std::clamp((static_cast<double>(progress.iPartition) + local) / static_cast<double>(progress.partitionsNumber), 0.0, 1.0);
+    }
+
+    std::string status;
+    switch (m_simulator.GetCurrentStatus()) {
+    case ESimulatorState::IDLE:          status = "idle";     break;
+    case ESimulatorState::RUNNING:       status = "running";  break;
+    case ESimulatorState::TO_BE_STOPPED: status = "stopping"; break;
+    }
+
+    pybind11::dict result;
+    result["running"] = running;
+    result["status"] = status;
+    result["unit"] = progress.unitName;
+    result["partition"] = progress.iPartition;
+    result["partitions"] = progress.partitionsNumber;
+    result["time_window"] = std::make_pair(progress.dTWStart, progress.dTWEnd);
+    result["window"] = progress.iWindowNumber;
+    result["iteration"] = progress.iIteration;
+    result["time"] = progress.time;
+    result["progress"] = fraction;
+    result["elapsed"] = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_simulationStart).count();
+    result["dropped_events"] = m_simulator.DroppedLogEventsNumber();
+    result["error"] = running ? std::string{} : m_simulator.GetLastError();
+    return result;
+}
+
+pybind11::list PyDyssol::PopSimulationEvents()
+{
+    pybind11::list events;
+    CSimulatorLog::SEvent e;
+    while (m_simulator.ReadLogEvent(e)) {
+        pybind11::dict event;
+        if (e.type == CSimulatorLog::EEventType::MESSAGE) {
+            std::string level;
+            switch (e.color) {
+            case CSimulatorLog::ELogColor::DEFAULT: level = "info";    break;
+            case CSimulatorLog::ELogColor::ORANGE:  level = "warning"; break;
+            case CSimulatorLog::ELogColor::RED:     level = "error";   break;
+            }
+            event["type"] = std::string{ "message" };
+            event["level"] = level;
+            event["text"] = e.text;
+        }
+        else {
+            event["type"] = std::string{ "progress" };
+            event["unit"] = e.progress.unitName;
+            event["partition"] = e.progress.iPartition;
+            event["partitions"] = e.progress.partitionsNumber;
+            event["window"] = e.progress.iWindowNumber;
+            event["iteration"] = e.progress.iIteration;
+            event["time_window"] = std::make_pair(e.progress.dTWStart, e.progress.dTWEnd);
+            event["time"] = e.progress.time;
+        }
+        events.append(event);
+    }
+    return events;
+}
+
+void PyDyssol::CancelSimulation()
+{
+    m_simulator.Stop();
+}
+
+bool PyDyssol::WaitSimulation(double timeout)
+{
+    {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(m_simulationMutex);
+        const auto finished = [&] { return !m_simulationRunning; };
+        if (timeout < 0.0)
+            m_simulationFinished.wait(lock, finished);
+        else if (!m_simulationFinished.wait_for(lock, std::chrono::duration<double>(timeout), finished))
+            return false;
+    }
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+    if (m_simulationException) {
+        std::exception_ptr exception = m_simulationException;
+        m_simulationException = nullptr;
+        std::rethrow_exception(exception);
+    }
+    return true;
+}
+
+void PyDyssol::EnableProfiling(bool enable)
+{
+    // each profiling session starts from scratch
+    if (enable)
+        Profiler::Reset();
+    Profiler::Enable(enable);
+}
+
+std::string PyDyssol::GetProfile() const
+{
+    return Profiler::Report();
+}
+
+bool PyDyssol::ExportProfileTrace(const std::string& filePath) const
+{
+    return Profiler::ExportTrace(filePath);
+}
+
+void PyDyssol::ThrowIfSimulationRunning()
+{
+    if (m_simulationRunning)
+        throw std::runtime_error("Simulation is running. Call wait_simulation() or cancel_simulation() first.");
+    // release the thread of the finished asynchronous simulation
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+}
+
 // Flowsheet
 pybind11::list PyDyssol::GetTopology() const
 {
@@ -261,6 +457,7 @@ pybind11::list PyDyssol::GetTopology() const
 
 bool PyDyssol::SetTopology(const py::dict& config, bool initialize)
 {
+    ThrowIfSimulationRunning();
     std::vector<std::string> compoundBackup;
     std::vector<SPhaseDescriptor> phaseBackup;
 
@@ -530,6 +727,7 @@ py::dict PyDyssol::GetUnitConfig(const std::string& unitName) const
 
 void PyDyssol::SetUnitConfig(const std::string& unitName, const py::dict& config)
 {
+    ThrowIfSimulationRunning();
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
     if (!unit) {
         unit = m_flowsheet.AddUnit(unitName);
@@ -710,6 +908,7 @@ std::vector<py::dict> PyDyssol::GetGrids() const {
 
 void PyDyssol::SetGrids(const std::vector<std::map<std::string, py::object>>& grids)
 {
+    ThrowIfSimulationRunning();
     auto& gridMgr = const_cast<CMultidimensionalGrid&>(m_flowsheet.GetGrid());
     std::vector<std::string> errors;
 
@@ -746,6 +945,7 @@ void PyDyssol::SetGrids(const std::vector<std::map<std::string, py::object>>& gr
 }
 
 void PyDyssol::AddGrid(const std::map<std::string, py::object>& gridData) {
+    ThrowIfSimulationRunning();
     if (!IsGridValid(gridData))
         return;
 
@@ -5,6 +5,12 @@
 #include <vector>
 #include <map>
 #include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <pybind11/pybind11.h> // Include pybind11 headers
 #include <pybind11/stl.h>      // For std::vector and std::pair bindings
 #include <pybind11/stl_bind.h>      // For STL bindings with containers
@@ -22,6 +28,12 @@ private:
     CModelsManager m_modelsManager;         // Units and solvers manager
     CFlowsheet m_flowsheet;                 // Flowsheet, now dependent on materials and models
     CSimulator m_simulator;                 // Simulator
+    std::thread m_simulationThread;         // Thread of the asynchronous simulation
+    std::atomic<bool> m_simulationRunning{ false }; // Flag to track whether the asynchronous simulation is running
+    std::mutex m_simulationMutex;           // Guards waiting for the end of the asynchronous simulation
+    std::condition_variable m_simulationFinished; // Notifies about the end of the asynchronous simulation
+    std::exception_ptr m_simulationException; // Exception thrown during the asynchronous simulation
+    std::chrono::steady_clock::time_point m_simulationStart; // Start time of the last simulation
     std::string m_defaultMaterialsPath;     // Default path for materials database
     std::string m_defaultModelsPath;        // Default path for model units
     bool m_isDatabaseLoaded;                // Flag to track database load state
@@ -29,12 +41,17 @@ private:
 	bool m_debug{ false };                  // Flag for debug mode
 	bool PyDyssol::ValidateFlowsheetState() const; // Validate the current state of the flowsheet
     bool PyDyssol::SetCompoundsFallback(const std::vector<std::string>& _compoundKeys);
+    void PrepareSimulation(double endTime); // Initialize flowsheet and set simulation time
+    void RunSimulation();                   // Run prepared simulation, does not use Python
+    void ThrowIfSimulationRunning();        // Throw if the asynchronous simulation is running
     
 
 public:
     PyDyssol(const std::string& materialsPath = "D:/Dyssol/Materials.dmdb",
         const std::string& modelsPath = "C:/Program Files/Dyssol/Units",
-        bool debug = false);
+        bool debug = false,
+        const std::string& modelsCache = "");
+    ~PyDyssol();
 
     bool LoadMaterialsDatabase(const std::string& path);
     bool AddModelPath(const std::string& path);
@@ -42,6 +59,16 @@ public:
     void PyDyssol::CloseFlowsheet();
     bool SaveFlowsheet(const std::string& filePath);
     void Simulate(double endTime = -1.0); // Default: -1 means no override
+    //Asynchronous simulation in a background thread
+    void StartSimulation(double endTime = -1.0);
+    pybind11::dict PollSimulation() const;
+    pybind11::list PopSimulationEvents();
+    void CancelSimulation();
+    bool WaitSimulation(double timeout = -1.0); // Default: -1 means wait until finished
+    //Profiling of the simulation
+    void EnableProfiling(bool enable = true);
+    std::string GetProfile() const;
+    bool ExportProfileTrace(const std::string& filePath) const;
     std::string Initialize();
     void DebugFlowsheet();
     //Flowsheet
@@ -193,6 +220,15 @@ public:
     //No arguments
     pybind11::list GetStream() const;
 
+    //Arrays: all timepoints as contiguous NumPy arrays [time x ...]
+    pybind11::dict GetStreamArrays(const std::string& streamName) const;
+    pybind11::dict GetUnitStreamArrays(const std::string& unitName, const std::string& streamName) const;
+    pybind11::dict GetUnitHoldupArrays(const std::string& unitName, const std::string& holdupName) const;
+
+    //Ensemble: in-memory variants of the flowsheet simulated in parallel
+    pybind11::dict RunEnsemble(const std::vector<std::pair<std::string, std::string>>& parameters,
+        const std::vector<std::vector<pybind11::object>>& values, const std::vector<std::vector<std::string>>& kpis, size_t threads = 0);
+
     //Options
     pybind11::dict GetOptions() const;
     void SetOptions(const pybind11::dict& options);
@@ -10,15 +10,17 @@ PYBIND11_MODULE(PyDyssol, m) {
 
     // Bind PyDyssol class
     py::class_<PyDyssol>(m, "PyDyssol", "A class to manage Dyssol flowsheet simulations in Python")
-        .def(py::init<std::string, std::string, bool>(),
+        .def(py::init<std::string, std::string, bool, std::string>(),
             py::arg("materials_path") = "D:/Dyssol/Materials.dmdb",
             py::arg("models_path") = "C:/Program Files/Dyssol/Units",
             py::arg("debug") = false,
+            py::arg("models_cache") = "",
             "Initialize PyDyssol with optional materials/models paths and a debug flag.\n"
             "Args:\n"
             "    materials_path (str): Path to the .dmdb file\n"
             "    models_path (str): Path to model units directory\n"
-            "    debug (bool): Enable debug output.")
+            "    debug (bool): Enable debug output.\n"
+            "    models_cache (str): File to cache information about models between runs, so that unchanged libraries are loaded only when used. Default: no cache.")
         .def("load_materials_database", &PyDyssol::LoadMaterialsDatabase,
             py::arg("path"),
             "Load a materials database from a .dmdb file.\n"
@@ -55,6 +57,51 @@ PYBIND11_MODULE(PyDyssol, m) {
             "Run the simulation. Optionally override end time.\n"
             "Args:\n"
             "    end_time (float, optional): End time for simulation (seconds). Default: use flowsheet settings.")
+        .def("start_simulation", &PyDyssol::StartSimulation,
+            py::arg("end_time") = -1.0,
+            "Start the simulation in a background thread and return immediately. Flowsheet data must not be accessed until wait_simulation() returns True.\n"
+            "Args:\n"
+            "    end_time (float, optional): End time for simulation (seconds). Default: use flowsheet settings.")
+        .def("poll_simulation", &PyDyssol::PollSimulation,
+            "Return the state of the current simulation: running, status, unit, partition, partitions, time_window, window, iteration, time, progress [0..1], elapsed [s], error and dropped_events (number of log messages lost because pop_simulation_events() was not called in time).")
+        .def("pop_simulation_events", &PyDyssol::PopSimulationEvents,
+            "Return and remove all events of the simulation log written since the last call, in the order of their appearance.\n"
+            "Messages have keys type ('message'), level (info, warning, error) and text; progress events have keys type ('progress'),\n"
+            "unit, partition, partitions, window, iteration, time_window and time. Only the latest progress event is kept and returned after all messages.\n"
+            "Can be called while the simulation is running.")
+        .def("cancel_simulation", &PyDyssol::CancelSimulation,
+            "Request to stop the current simulation. Use wait_simulation() to wait until it is stopped.")
+        .def("wait_simulation", &PyDyssol::WaitSimulation,
+            py::arg("timeout") = -1.0,
+            "Wait for the background simulation to finish. Rethrows exceptions raised during simulation.\n"
+            "Args:\n"
+            "    timeout (float, optional): Maximum waiting time (seconds). Default: wait until finished.\n"
+            "Returns:\n"
+            "    bool: True if the simulation has finished, False on timeout.")
+        .def("enable_profiling", &PyDyssol::EnableProfiling,
+            py::arg("enable") = true,
+            "Start or stop profiling of the simulation. Starting removes previously recorded data.\n"
+            "Args:\n"
+            "    enable (bool, optional): Whether to record. Default: True.")
+        .def("get_profile", &PyDyssol::GetProfile,
+            "Return a text report of the recorded profile: a tree of scopes per thread with total and self times, numbers of calls and counters.")
+        .def("export_profile_trace", &PyDyssol::ExportProfileTrace,
+            py::arg("file_path"),
+            "Write the recorded profile in Chrome trace event format, viewable in chrome://tracing or Perfetto.\n"
+            "Args:\n"
+            "    file_path (str): Path to the output JSON file.\n"
+            "Returns:\n"
+            "    bool: True if the file has been written successfully.")
+        .def("run_ensemble", &PyDyssol::RunEnsemble,
+            py::arg("parameters"), py::arg("values"), py::arg("kpis"), py::arg("threads") = 0,
+            "Simulate in-memory copies of the flowsheet with overridden unit parameters in parallel and return selected KPIs.\n"
+            "Args:\n"
+            "    parameters (list[tuple[str, str]]): Varied unit parameters as (unit, parameter).\n"
+            "    values (list[list]): One row per variant with a value for each parameter.\n"
+            "    kpis (list[tuple[str, ...]]): KPIs as (name, mass/temperature/pressure, stream), (name, mass/temperature/pressure, unit, holdup) or (name, state_variable, unit, variable).\n"
+            "    threads (int, optional): Maximum number of simultaneously simulated variants. Default: number of hardware threads.\n"
+            "Returns:\n"
+            "    dict: NumPy array per KPI with one value per variant (NaN if failed), duration [s] per variant and error list.")
         .def("debug_flowsheet", &PyDyssol::DebugFlowsheet,
             "Print debug information about the current flowsheet, including units, streams, compounds, and phases.")
         //Flowsheet
@@ -526,6 +573,17 @@ PYBIND11_MODULE(PyDyssol, m) {
                     &PyDyssol::GetStream),
                 "Get data for every flowsheet-level stream: returns a list of {overall, composition, distributions} dicts.")
 
+            //Arrays
+            .def("get_stream_arrays", &PyDyssol::GetStreamArrays,
+                py::arg("stream_name"),
+                "Get all data of a flowsheet-level stream for all timepoints as NumPy arrays: overall [time x 3], composition [time x phase x compound], distributions {name: [time x class]}, with names and sizes of all axes.")
+            .def("get_unit_stream_arrays", &PyDyssol::GetUnitStreamArrays,
+                py::arg("unit_name"), py::arg("stream_name"),
+                "Get all data of a unit's internal stream for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().")
+            .def("get_unit_holdup_arrays", &PyDyssol::GetUnitHoldupArrays,
+                py::arg("unit_name"), py::arg("holdup_name"),
+                "Get all data of a unit's holdup for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().")
+
             //Options
             .def("get_options", &PyDyssol::GetOptions, "Get flowsheet simulation options.")
             .def("set_options", &PyDyssol::SetOptions, py::arg("options"), "Set flowsheet simulation options.")
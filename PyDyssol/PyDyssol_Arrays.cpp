@@ -0,0 +1,136 @@
+#include "PyDyssol.h"
+#include <stdexcept>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+//Arrays
+
+namespace
+{
+    // Collects all time-dependent data of a stream or holdup into contiguous arrays with time as the first axis.
+    py::dict StreamToArrays(const CBaseStream* stream, const std::vector<double>& timepoints, const std::string& massName,
+        const CFlowsheet& flowsheet, const CMaterialsDatabase& materialsDatabase)
+    {
+        const std::vector<std::string> compoundKeys = flowsheet.GetCompounds();
+        const std::vector<SPhaseDescriptor> phases = flowsheet.GetPhases();
+        std::vector<const CGridDimension*> dims;
+        // the stream may have its own grid
+        for (const CGridDimension* dim : stream->GetGrid().GetGridDimensions())
+            if (dim->DimensionType() != EDistrTypes::DISTR_COMPOUNDS && GetDistributionTypeIndex(dim->DimensionType()) >= 0)
+                dims.push_back(dim);
+
+        const size_t nTimes = timepoints.size();
+        const size_t nPhases = phases.size();
+        const size_t nCompounds = compoundKeys.size();
+
+        py::array_t<double> times(nTimes);
+        py::array_t<double> overall({ nTimes, size_t{ 3 } });
+        py::array_t<double> composition({ nTimes, nPhases, nCompounds });
+        std::vector<py::array_t<double>> distributions;
+        for (const CGridDimension* dim : dims)
+            distributions.emplace_back(std::vector<size_t>{ nTimes, dim->ClassesNumber() });
+
+        // fill all arrays in one pass over time points
+        std::copy(timepoints.begin(), timepoints.end(), times.mutable_data());
+        double* pOverall = overall.mutable_data();
+        double* pComposition = composition.mutable_data();
+        for (size_t i = 0; i < nTimes; ++i)
+        {
+            const double t = timepoints[i];
+            *pOverall++ = stream->GetMass(t);
+            *pOverall++ = stream->GetTemperature(t);
+            *pOverall++ = stream->GetPressure(t);
+            for (const auto& phase : phases)
+                for (const auto& compoundKey : compoundKeys)
+                    *pComposition++ = stream->GetCompoundMass(t, compoundKey, phase.state);
+        }
+        // distributions for all time points at once
+        for (size_t d = 0; d < dims.size(); ++d)
+        {
+            const std::vector<double> distr = stream->GetDistributions(timepoints, dims[d]->DimensionType());
+            double* pDistribution = distributions[d].mutable_data();
+            if (distr.empty()) // no solid phase
+                std::fill_n(pDistribution, nTimes * dims[d]->ClassesNumber(), 0.0);
+            else
+                std::copy(distr.begin(), distr.end(), pDistribution);
+        }
+
+        // shape metadata
+        std::vector<std::string> compoundNames;
+        for (const auto& compoundKey : compoundKeys) {
+            const CCompound* compound = materialsDatabase.GetCompound(compoundKey);
+            compoundNames.push_back(compound ? compound->GetName() : compoundKey);
+        }
+        std::vector<std::string> phaseNames;
+        for (const auto& phase : phases)
+            phaseNames.push_back(PhaseToString(phase.state));
+        std::vector<std::string> dimNames;
+        std::vector<size_t> classes;
+        py::dict distrDict;
+        for (size_t d = 0; d < dims.size(); ++d) {
+            dimNames.emplace_back(DISTR_NAMES[GetDistributionTypeIndex(dims[d]->DimensionType())]);
+            classes.push_back(dims[d]->ClassesNumber());
+            distrDict[py::str(dimNames.back())] = distributions[d];
+        }
+
+        py::dict result;
+        result["timepoints"] = times;
+        result["overall"] = overall;
+        result["overall_names"] = std::vector<std::string>{ massName, "temperature", "pressure" };
+        result["composition"] = composition;
+        result["phases"] = phaseNames;
+        result["compounds"] = compoundNames;
+        result["distributions"] = distrDict;
+        result["dimensions"] = dimNames;
+        result["classes"] = classes;
+        return result;
+    }
+}
+
+pybind11::dict PyDyssol::GetStreamArrays(const std::string& streamName) const {
+    const CStream* stream = m_flowsheet.GetStreamByName(streamName);
+    if (!stream) throw std::runtime_error("Stream not found: " + streamName);
+
+    std::vector<double> timepoints = stream->GetAllTimePoints();
+    double t_end = m_flowsheet.GetParameters()->endSimulationTime;
+    if (timepoints.empty() || std::abs(timepoints.back() - t_end) > 1e-6)
+        timepoints.push_back(t_end);
+
+    pybind11::dict result = StreamToArrays(stream, timepoints, "massflow", m_flowsheet, m_materialsDatabase);
+    result["stream"] = streamName;
+    return result;
+}
+
+pybind11::dict PyDyssol::GetUnitStreamArrays(const std::string& unitName, const std::string& streamName) const {
+    const auto* unit = m_flowsheet.GetUnitByName(unitName);
+    if (!unit) throw std::runtime_error("Unit not found: " + unitName);
+    const auto* stream = unit->GetModel()->GetStreamsManager().GetStream(streamName);
+    if (!stream) throw std::runtime_error("Stream not found: " + streamName);
+
+    std::vector<double> timepoints = stream->GetAllTimePoints();
+    double t_end = m_flowsheet.GetParameters()->endSimulationTime;
+    if (timepoints.empty() || std::abs(timepoints.back() - t_end) > 1e-6)
+        timepoints.push_back(t_end);
+
+    pybind11::dict result = StreamToArrays(stream, timepoints, "massflow", m_flowsheet, m_materialsDatabase);
+    result["unit"] = unitName;
+    result["stream"] = streamName;
+    return result;
+}
+
+pybind11::dict PyDyssol::GetUnitHoldupArrays(const std::string& unitName, const std::string& holdupName) const {
+    const auto* unit = m_flowsheet.GetUnitByName(unitName);
+    if (!unit) throw std::runtime_error("Unit not found: " + unitName);
+    const auto* model = unit->GetModel();
+    if (!model) throw std::runtime_error("Model not found for unit: " + unitName);
+    const auto* holdup = dynamic_cast<const CHoldup*>(model->GetStreamsManager().GetObjectWork(holdupName));
+    if (!holdup) throw std::runtime_error("Holdup not found: " + holdupName);
+
+    pybind11::dict result = StreamToArrays(holdup, holdup->GetAllTimePoints(), "mass", m_flowsheet, m_materialsDatabase);
+    result["unit"] = unitName;
+    result["holdup"] = holdupName;
+    return result;
+}
@@ -0,0 +1,84 @@
+#include "PyDyssol.h"
+#include "../SimulatorCore/EnsembleRunner.h"
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+//Ensemble
+
+namespace
+{
+    // Converts a Python value of a unit parameter to a string in the same format as in scripts.
+    std::string ToParameterString(const py::handle& value)
+    {
+        if (py::isinstance<py::str>(value))
+            return value.cast<std::string>();
+        if (py::isinstance<py::bool_>(value))
+            return value.cast<bool>() ? "1" : "0";
+        if (py::isinstance<py::sequence>(value)) {
+            std::string res;
+            for (const auto& item : value.cast<py::sequence>())
+                res += (res.empty() ? "" : " ") + ToParameterString(item);
+            return res;
+        }
+        return py::str(value).cast<std::string>();
+    }
+}
+
+pybind11::dict PyDyssol::RunEnsemble(const std::vector<std::pair<std::string, std::string>>& parameters,
+    const std::vector<std::vector<pybind11::object>>& values, const std::vector<std::vector<std::string>>& kpis, size_t threads)
+{
+    ThrowIfSimulationRunning();
+
+    CEnsembleRunner ensemble{ &m_flowsheet };
+    std::vector<CEnsembleRunner::SParameter> params;
+    for (const auto& [unit, parameter] : parameters)
+        params.push_back({ unit, parameter });
+    ensemble.SetParameters(params);
+
+    std::vector<CEnsembleRunner::SKPI> kpiList;
+    for (const auto& kpi : kpis) {
+        if (kpi.size() != 3 && kpi.size() != 4)
+            throw std::invalid_argument("KPI must be given as (name, type, stream) or (name, type, unit, holdup/state_variable).");
+        kpiList.push_back({ kpi[0], CEnsembleRunner::KPIType(kpi[1]), kpi[2], kpi.size() == 4 ? kpi[3] : "" });
+    }
+    ensemble.SetKPIs(kpiList);
+    ensemble.SetThreadsNumber(threads);
+    std::mutex consoleMutex;
+    ensemble.SetConsoleFunction([&](const std::string& _message) {
+        std::lock_guard lock{ consoleMutex };
+        std::cout << _message << std::endl;
+    });
+
+    // convert all values while holding the GIL
+    std::vector<std::vector<std::string>> strValues;
+    for (const auto& variant : values) {
+        std::vector<std::string> row;
+        for (const auto& value : variant)
+            row.push_back(ToParameterString(value));
+        strValues.push_back(std::move(row));
+    }
+    const std::string error = ensemble.Check(strValues);
+    if (!error.empty())
+        throw std::invalid_argument("Ensemble setup failed: " + error);
+
+    std::cout << "[PyDyssol] Starting simulation of " << strValues.size() << " flowsheet variants..." << std::endl;
+    CEnsembleRunner::SResults res;
+    {
+        // Python is not used during simulation, so other Python threads may run meanwhile
+        py::gil_scoped_release release;
+        res = ensemble.Run(strValues);
+    }
+
+    pybind11::dict result;
+    for (size_t i = 0; i < res.names.size(); ++i)
+        result[py::str(res.names[i])] = py::array_t<double>(res.columns[i].size(), res.columns[i].data());
+    result["duration"] = py::array_t<double>(res.durations.size(), res.durations.data());
+    result["error"] = res.errors;
+    return result;
+}
@@ -454,6 +454,7 @@ static void ClearAllStreamTimePointsExcept(CStream* stream, const std::vector<do
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedName, double time, const pybind11::dict& data)
 {
+    ThrowIfSimulationRunning();
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
     if (!unit) throw std::runtime_error("Unit not found: " + unitName);
 
@@ -544,6 +545,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedN
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedName, const py::dict& data)
 {
+    ThrowIfSimulationRunning();
     std::vector<double> timepoints;
 
     auto extractTimepoints = [&](const std::string& key) {
@@ -605,6 +607,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedN
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, double time, const py::dict& data)
 {
+    ThrowIfSimulationRunning();
     auto feeds = GetUnitFeeds(unitName);
     if (feeds.empty()) throw std::runtime_error("No feeds in unit: " + unitName);
     SetUnitFeed(unitName, feeds.front(), time, data);
@@ -612,6 +615,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, double time, const py::d
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, const py::dict& data)
 {
+    ThrowIfSimulationRunning();
     auto feeds = GetUnitFeeds(unitName);
     if (feeds.empty()) throw std::runtime_error("No feeds in unit: " + unitName);
     SetUnitFeed(unitName, feeds.front(), data);
@@ -619,6 +623,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, const py::dict& data)
 
 void PyDyssol::SetUnitFeed(const py::dict& d)
 {
+    ThrowIfSimulationRunning();
     std::string unit = d["unit"].cast<std::string>();
     std::string feed = d.contains("feed") ? d["feed"].cast<std::string>() : GetUnitFeeds(unit).front();
     SetUnitFeed(unit, feed, d);
@@ -632,6 +632,7 @@ static void ClearAllHoldupTimePointsExcept(CHoldup* holdup, const std::vector<do
 
 void PyDyssol::SetUnitHoldup(const std::string& unitName, const pybind11::dict& data)
 {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
 
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
@@ -654,6 +655,7 @@ void PyDyssol::SetUnitHoldup(const std::string& unitName, const pybind11::dict&
 
 void PyDyssol::SetUnitHoldup(const std::string& unitName, const std::string& holdupName, const pybind11::dict& data)
 {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
 
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
@@ -676,6 +678,7 @@ void PyDyssol::SetUnitHoldup(const std::string& unitName, const std::string& hol
 
 void PyDyssol::SetUnitHoldup(const py::dict& d)
 {
+    ThrowIfSimulationRunning();
     // 1) Unit
     const std::string unit = d["unit"].cast<std::string>();
 
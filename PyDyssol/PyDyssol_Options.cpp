@@ -12,6 +12,7 @@ inline std::string ToString(EConvergenceMethod method) {
     case EConvergenceMethod::DIRECT_SUBSTITUTION: return "DIRECT_SUBSTITUTION";
     case EConvergenceMethod::WEGSTEIN: return "WEGSTEIN";
     case EConvergenceMethod::STEFFENSEN: return "STEFFENSEN";
+    case EConvergenceMethod::ANDERSON: return "ANDERSON";
     default: return "UNKNOWN";
     }
 }
@@ -20,6 +21,7 @@ inline EConvergenceMethod ToConvergenceMethod(const std::string& name) {
     if (name == "DIRECT_SUBSTITUTION") return EConvergenceMethod::DIRECT_SUBSTITUTION;
     if (name == "WEGSTEIN") return EConvergenceMethod::WEGSTEIN;
     if (name == "STEFFENSEN") return EConvergenceMethod::STEFFENSEN;
+    if (name == "ANDERSON") return EConvergenceMethod::ANDERSON;
     throw std::invalid_argument("Unknown ConvergenceMethod: " + name);
 }
 
@@ -70,6 +72,7 @@ py::dict PyDyssol::GetOptions() const
     out["convergenceMethod"] = ToString(static_cast<EConvergenceMethod>(p->convergenceMethod));
     out["wegsteinAccelParam"] = static_cast<double>(p->wegsteinAccelParam);
     out["relaxationParam"] = static_cast<double>(p->relaxationParam);
+    out["andersonDepth"] = static_cast<uint32_t>(p->andersonDepth);
 
     // Extrapolation
     out["extrapolationMethod"] = ToString(static_cast<EExtrapolationMethod>(p->extrapolationMethod));
@@ -88,6 +91,7 @@ py::dict PyDyssol::GetOptions() const
 
 void PyDyssol::SetOptions(const py::dict& options)
 {
+    ThrowIfSimulationRunning();
     CParametersHolder* p = m_flowsheet.GetParameters();
 
     auto get_double = [&](const char* key, auto setter) {
@@ -146,6 +150,7 @@ void PyDyssol::SetOptions(const py::dict& options)
     get_enum_conv("convergenceMethod");
     get_double("wegsteinAccelParam", &CParametersHolder::WegsteinAccelParam);
     get_double("relaxationParam", &CParametersHolder::RelaxationParam);
+    get_uint("andersonDepth", &CParametersHolder::AndersonDepth);
 
     // Extrapolation method
     get_enum_extr("extrapolationMethod");
@@ -165,7 +170,7 @@ py::dict PyDyssol::GetOptionsMethods() const
     py::dict result;
 
     py::list conv;
-    for (int i = 0; i <= static_cast<int>(EConvergenceMethod::STEFFENSEN); ++i)
+    for (int i = 0; i <= static_cast<int>(EConvergenceMethod::ANDERSON); ++i)
         conv.append(ToString(static_cast<EConvergenceMethod>(i)));
     result["convergenceMethod"] = conv;
 
@@ -277,6 +277,7 @@ void PyDyssol::SetUnitParameter(const std::string& unitName, const std::string&
     std::vector<pybind11::dict>
     > value)
 {
+    ThrowIfSimulationRunning();
     auto* unit = m_flowsheet.GetUnitByName(unitName);
     if (!unit)
         throw std::runtime_error("Unit not found: " + unitName);
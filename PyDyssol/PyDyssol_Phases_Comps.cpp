@@ -98,6 +98,7 @@ bool PyDyssol::SetCompoundsFallback(const std::vector<std::string>& _compoundKey
 }
 
 bool PyDyssol::SetCompounds(const std::vector<std::string>& compoundNames) {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Setting compounds from names: ";
     for (const auto& name : compoundNames) std::cout << name << " ";
     std::cout << std::endl;
@@ -172,6 +173,7 @@ bool PyDyssol::SetCompounds(const std::vector<std::string>& compoundNames) {
 
 bool PyDyssol::AddCompound(const std::string& compoundKeyOrName)
 {
+    ThrowIfSimulationRunning();
     const CCompound* comp = m_materialsDatabase.GetCompound(compoundKeyOrName);
     if (!comp)
         comp = m_materialsDatabase.GetCompoundByName(compoundKeyOrName);
@@ -197,6 +199,7 @@ py::list PyDyssol::GetPhases() const
 
 bool PyDyssol::SetPhases(const py::list& phaseStates)
 {
+    ThrowIfSimulationRunning();
     std::vector<SPhaseDescriptor> descriptors;
     for (const auto& stateObj : phaseStates)
     {
@@ -210,6 +213,7 @@ bool PyDyssol::SetPhases(const py::list& phaseStates)
 
 bool PyDyssol::AddPhase(const py::object& stateObj)
 {
+    ThrowIfSimulationRunning();
     EPhase state = ConvertPhaseState(py::reinterpret_borrow<py::object>(stateObj));
     std::string name = PhaseToString(state);
     m_flowsheet.AddPhase(state, name);
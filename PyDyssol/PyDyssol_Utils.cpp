@@ -81,6 +81,7 @@ std::string FormatDouble(double value)
 
 bool PyDyssol::LoadMaterialsDatabase(const std::string& path)
 {
+    ThrowIfSimulationRunning();
     fs::path absPath = fs::absolute(path);
     if (!m_materialsDatabase.LoadFromFile(absPath)) {
         std::cerr << "[PyDyssol] Failed to load materials database." << std::endl;
@@ -102,6 +103,7 @@ bool PyDyssol::LoadMaterialsDatabase(const std::string& path)
 
 bool PyDyssol::AddModelPath(const std::string& path)
 {
+    ThrowIfSimulationRunning();
     fs::path absPath = fs::absolute(path);
     m_modelsManager.AddDir(absPath);
     auto models = m_modelsManager.GetAvailableUnits();
@@ -7,8 +7,13 @@ class EPhase(Enum):
     VAPOR = 2
 
 class PyDyssol:
-    def __init__(self, materials_path: str = "D:/Dyssol/Materials.dmdb", models_path: str = "C:/Program Files/Dyssol/Units") -> None:
-        """Initialize a new PyDyssol instance with optional paths for materials database and model units."""
+    def __init__(self, materials_path: str = "D:/Dyssol/Materials.dmdb", models_path: str = "C:/Program Files/Dyssol/Units",
+                 debug: bool = False, models_cache: str = "") -> None:
+        """Initialize a new PyDyssol instance with optional paths for materials database and model units.
+        Args:
+        models_cache (str, optional): File to cache information about models between runs,
+        so that unchanged libraries are loaded only when their models are used. Default: no cache.
+        """
         ...
 
     def load_materials_database(self, path: str) -> bool:
@@ -54,6 +59,84 @@ class PyDyssol:
         """
         ...
 
+    def start_simulation(self, end_time: float = -1.0) -> None:
+        """Start the simulation in a background thread and return immediately.
+        Flowsheet data must not be accessed until wait_simulation() returns True.
+        Args:
+        end_time (float, optional): End time for simulation (seconds). Default: use flowsheet settings.
+        """
+        ...
+
+    def poll_simulation(self) -> Dict[str, Any]:
+        """Get the state of the current simulation.
+        Returns:
+        dict[str, Any]: Dictionary with keys running (bool), status (str: idle, running, stopping), unit (str),
+        partition (int), partitions (int), time_window (tuple[float, float]), window (int), iteration (int),
+        time (float, last simulated time point), progress (float in [0, 1]), elapsed (float, seconds), error (str) and
+        dropped_events (int, number of log messages lost because pop_simulation_events() was not called in time).
+        """
+        ...
+
+    def pop_simulation_events(self) -> List[Dict[str, Any]]:
+        """Return and remove all events of the simulation log written since the last call, in the order of their appearance.
+        Can be called while the simulation is running. Messages are buffered up to a limit, so call it regularly.
+        Only the latest progress event is kept, it is returned after all messages.
+        Returns:
+        list[dict[str, Any]]: Messages with keys type ('message'), level (str: info, warning, error) and text (str);
+        progress events with keys type ('progress'), unit (str), partition (int), partitions (int), window (int),
+        iteration (int), time_window (tuple[float, float]) and time (float).
+        """
+        ...
+
+    def cancel_simulation(self) -> None:
+        """Request to stop the current simulation. Use wait_simulation() to wait until it is stopped."""
+        ...
+
+    def wait_simulation(self, timeout: float = -1.0) -> bool:
+        """Wait for the background simulation to finish. Rethrows exceptions raised during simulation.
+        Args:
+        timeout (float, optional): Maximum waiting time (seconds). Default: wait until finished.
+        Returns:
+        bool: True if the simulation has finished, False on timeout.
+        """
+        ...
+
+    def enable_profiling(self, enable: bool = True) -> None:
+        """Start or stop profiling of the simulation. Starting removes previously recorded data.
+        Args:
+        enable (bool, optional): Whether to record. Default: True.
+        """
+        ...
+
+    def get_profile(self) -> str:
+        """Return a text report of the recorded profile: a tree of scopes per thread with total and self times, numbers of calls and counters."""
+        ...
+
+    def export_profile_trace(self, file_path: str) -> bool:
+        """Write the recorded profile in Chrome trace event format, viewable in chrome://tracing or Perfetto.
+        Args:
+        file_path (str): Path to the output JSON file.
+        Returns:
+        bool: True if the file has been written successfully.
+        """
+        ...
+
+    def run_ensemble(self, parameters: List[Tuple[str, str]], values: List[List[Any]],
+                     kpis: List[Tuple[str, ...]], threads: int = 0) -> Dict[str, Any]:
+        """Simulate in-memory copies of the flowsheet with overridden unit parameters in parallel and return selected KPIs.
+        Parameters that change the structure of a unit cannot be varied.
+        Args:
+        parameters (List[Tuple[str, str]]): Varied unit parameters as (unit, parameter).
+        values (List[List[Any]]): One row per variant with a value for each parameter.
+        kpis (List[Tuple[str, ...]]): KPIs evaluated at the end of simulation as (name, 'mass'/'temperature'/'pressure', stream),
+        (name, 'mass'/'temperature'/'pressure', unit, holdup) or (name, 'state_variable', unit, variable).
+        threads (int, optional): Maximum number of simultaneously simulated variants. Default: number of hardware threads.
+        Returns:
+        Dict[str, Any]: numpy.ndarray per KPI with one value per variant (NaN for failed variants),
+        'duration' (numpy.ndarray, seconds) and 'error' (List[str], empty for successful variants).
+        """
+        ...
+
     def initialize(self) -> str:
         """Initialize the flowsheet for simulation.
         Returns:
@@ -435,6 +518,37 @@ class PyDyssol:
         """
         ...
 
+    def get_stream_arrays(self, stream_name: str) -> Dict[str, Any]:
+        """Get all data of a flowsheet-level stream for all timepoints as NumPy arrays.
+        Args:
+        stream_name (str): Name of the stream.
+        Returns:
+        dict[str, Any]: Dictionary with keys 'timepoints' [time], 'overall' [time x 3] with column names in 'overall_names',
+        'composition' [time x phase x compound] with axes in 'phases' and 'compounds',
+        'distributions' {name: [time x class]} with names in 'dimensions' and sizes in 'classes'.
+        """
+        ...
+
+    def get_unit_stream_arrays(self, unit_name: str, stream_name: str) -> Dict[str, Any]:
+        """Get all data of a unit's internal stream for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().
+        Args:
+        unit_name (str): Name of the unit.
+        stream_name (str): Name of the internal stream.
+        Returns:
+        dict[str, Any]: Dictionary with NumPy arrays and axes metadata.
+        """
+        ...
+
+    def get_unit_holdup_arrays(self, unit_name: str, holdup_name: str) -> Dict[str, Any]:
+        """Get all data of a unit's holdup for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().
+        Args:
+        unit_name (str): Name of the unit.
+        holdup_name (str): Name of the holdup.
+        Returns:
+        dict[str, Any]: Dictionary with NumPy arrays and axes metadata.
+        """
+        ...
+
     def get_streams(self) -> List[str]:
         """Return list of all flowsheet-level stream names."""
         ...
@@ -14,13 +14,15 @@ NB_MODULE(PyDyssol_nanobind, m) {
 
     // Bind PyDyssol class
     nb::class_<PyDyssol>(m, "PyDyssol", "A class to manage Dyssol flowsheet simulations in Python")
-        .def(nb::init<std::string, std::string>(),
+        .def(nb::init<std::string, std::string, std::string>(),
             nb::arg("materials_path") = "D:/Dyssol/Materials.dmdb",
             nb::arg("models_path") = "C:/Program Files/Dyssol/Units",
+            nb::arg("models_cache") = "",
             "Initialize a new PyDyssol instance with optional paths for materials database and model units.\n"
             "Args:\n"
             "    materials_path (str): Path to the materials database (.dmdb file). Default: 'D:/Dyssol/Materials.dmdb'.\n"
-            "    models_path (str): Path to the directory containing model units. Default: 'C:/Program Files/Dyssol/Units'.")
+            "    models_path (str): Path to the directory containing model units. Default: 'C:/Program Files/Dyssol/Units'.\n"
+            "    models_cache (str): File to cache information about models between runs, so that unchanged libraries are loaded only when used. Default: no cache.")
         .def("load_materials_database", &PyDyssol::LoadMaterialsDatabase,
             nb::arg("path"),
             "Load a materials database from a .dmdb file.\n"
@@ -57,6 +59,51 @@ NB_MODULE(PyDyssol_nanobind, m) {
         .def("initialize", &PyDyssol::Initialize,
             "Initialize the flowsheet for simulation.\n"
             "Returns:\n"            "    str: Empty string if successful, error message if failed.")
+        .def("start_simulation", &PyDyssol::StartSimulation,
+            nb::arg("end_time") = -1.0,
+            "Start the simulation in a background thread and return immediately. Flowsheet data must not be accessed until wait_simulation() returns True.\n"
+            "Args:\n"
+            "    end_time (float, optional): End time for simulation (seconds). Default: use flowsheet settings.")
+        .def("poll_simulation", &PyDyssol::PollSimulation,
+            "Return the state of the current simulation: running, status, unit, partition, partitions, time_window, window, iteration, time, progress [0..1], elapsed [s], error and dropped_events (number of log messages lost because pop_simulation_events() was not called in time).")
+        .def("pop_simulation_events", &PyDyssol::PopSimulationEvents,
+            "Return and remove all events of the simulation log written since the last call, in the order of their appearance.\n"
+            "Messages have keys type ('message'), level (info, warning, error) and text; progress events have keys type ('progress'),\n"
+            "unit, partition, partitions, window, iteration, time_window and time. Only the latest progress event is kept and returned after all messages.\n"
+            "Can be called while the simulation is running.")
+        .def("cancel_simulation", &PyDyssol::CancelSimulation,
+            "Request to stop the current simulation. Use wait_simulation() to wait until it is stopped.")
+        .def("wait_simulation", &PyDyssol::WaitSimulation,
+            nb::arg("timeout") = -1.0,
+            "Wait for the background simulation to finish. Rethrows exceptions raised during simulation.\n"
+            "Args:\n"
+            "    timeout (float, optional): Maximum waiting time (seconds). Default: wait until finished.\n"
+            "Returns:\n"
+            "    bool: True if the simulation has finished, False on timeout.")
+        .def("enable_profiling", &PyDyssol::EnableProfiling,
+            nb::arg("enable") = true,
+            "Start or stop profiling of the simulation. Starting removes previously recorded data.\n"
+            "Args:\n"
+            "    enable (bool, optional): Whether to record. Default: True.")
+        .def("get_profile", &PyDyssol::GetProfile,
+            "Return a text report of the recorded profile: a tree of scopes per thread with total and self times, numbers of calls and counters.")
+        .def("export_profile_trace", &PyDyssol::ExportProfileTrace,
+            nb::arg("file_path"),
+            "Write the recorded profile in Chrome trace event format, viewable in chrome://tracing or Perfetto.\n"
+            "Args:\n"
+            "    file_path (str): Path to the output JSON file.\n"
+            "Returns:\n"
+            "    bool: True if the file has been written successfully.")
+        .def("run_ensemble", &PyDyssol::RunEnsemble,
+            nb::arg("parameters"), nb::arg("values"), nb::arg("kpis"), nb::arg("threads") = 0,
+            "Simulate in-memory copies of the flowsheet with overridden unit parameters in parallel and return selected KPIs.\n"
+            "Args:\n"
+            "    parameters (list[tuple[str, str]]): Varied unit parameters as (unit, parameter).\n"
+            "    values (list[list]): One row per variant with a value for each parameter.\n"
+            "    kpis (list[tuple[str, ...]]): KPIs as (name, mass/temperature/pressure, stream), (name, mass/temperature/pressure, unit, holdup) or (name, state_variable, unit, variable).\n"
+            "    threads (int, optional): Maximum number of simultaneously simulated variants. Default: number of hardware threads.\n"
+            "Returns:\n"
+            "    dict: NumPy array per KPI with one value per variant (NaN if failed), duration [s] per variant and error list.")
         .def("debug_flowsheet", &PyDyssol::DebugFlowsheet,
             "Print debug information about the current flowsheet, including units, streams, compounds, and phases.")
 
@@ -455,6 +502,15 @@ NB_MODULE(PyDyssol_nanobind, m) {
             nb::overload_cast<const std::string&>(&PyDyssol::GetStream),
             nb::arg("stream_name"),
             "Get all stream data (overall, composition, distributions) for all timepoints.")
+        .def("get_stream_arrays", &PyDyssol::GetStreamArrays,
+            nb::arg("stream_name"),
+            "Get all data of a flowsheet-level stream for all timepoints as NumPy arrays: overall [time x 3], composition [time x phase x compound], distributions {name: [time x class]}, with names and sizes of all axes.")
+        .def("get_unit_stream_arrays", &PyDyssol::GetUnitStreamArrays,
+            nb::arg("unit_name"), nb::arg("stream_name"),
+            "Get all data of a unit's internal stream for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().")
+        .def("get_unit_holdup_arrays", &PyDyssol::GetUnitHoldupArrays,
+            nb::arg("unit_name"), nb::arg("holdup_name"),
+            "Get all data of a unit's holdup for all timepoints as NumPy arrays, in the same layout as get_stream_arrays().")
 
         //Options
         .def("get_options", &PyDyssol::GetOptions, "Get flowsheet simulation options.")
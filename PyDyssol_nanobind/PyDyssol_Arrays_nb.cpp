@@ -0,0 +1,163 @@
+#include "PyDyssol_nb.h"
+#include <memory>
+#include <stdexcept>
+#include <nanobind/nanobind.h> // Include nanobind headers
+#include <nanobind/ndarray.h>  // For NumPy arrays
+#include <nanobind/stl/string.h> // For std::string bindings
+#include <nanobind/stl/vector.h> // For std::vector bindings
+
+namespace nb = nanobind;
+
+//Arrays
+
+namespace
+{
+    // Contiguous array of doubles, which is handed over to NumPy without copying.
+    class CArrayBuffer
+    {
+        double* m_data;
+        std::vector<size_t> m_shape;
+
+    public:
+        explicit CArrayBuffer(std::vector<size_t> shape) : m_shape{ std::move(shape) }
+        {
+            size_t size = 1;
+            for (const size_t s : m_shape) size *= s;
+            m_data = new double[size > 0 ? size : 1]{};
+        }
+        ~CArrayBuffer() { delete[] m_data; }
+        CArrayBuffer(const CArrayBuffer&) = delete;
+        CArrayBuffer& operator=(const CArrayBuffer&) = delete;
+
+        double* data() const { return m_data; }
+
+        // Transfers ownership of the buffer to a NumPy array.
+        nb::object release()
+        {
+            double* data = m_data;
+            m_data = nullptr;
+            nb::capsule owner(data, [](void* p) noexcept { delete[] static_cast<double*>(p); });
+            return nb::cast(nb::ndarray<nb::numpy, double>(data, m_shape.size(), m_shape.data(), owner));
+        }
+    };
+
+    // Collects all time-dependent data of a stream or holdup into contiguous arrays with time as the first axis.
+    nb::dict StreamToArrays(const CBaseStream* stream, const std::vector<double>& timepoints, const std::string& massName,
+        const CFlowsheet& flowsheet, const CMaterialsDatabase& materialsDatabase)
+    {
+        const std::vector<std::string> compoundKeys = flowsheet.GetCompounds();
+        const std::vector<SPhaseDescriptor> phases = flowsheet.GetPhases();
+        std::vector<const CGridDimension*> dims;
+        // the stream may have its own grid
+        for (const CGridDimension* dim : stream->GetGrid().GetGridDimensions())
+            if (dim->DimensionType() != EDistrTypes::DISTR_COMPOUNDS && GetDistributionTypeIndex(dim->DimensionType()) >= 0)
+                dims.push_back(dim);
+
+        const size_t nTimes = timepoints.size();
+        const size_t nPhases = phases.size();
+        const size_t nCompounds = compoundKeys.size();
+
+        CArrayBuffer times({ nTimes });
+        CArrayBuffer overall({ nTimes, 3 });
+        CArrayBuffer composition({ nTimes, nPhases, nCompounds });
+        std::vector<std::unique_ptr<CArrayBuffer>> distributions;
+        for (const CGridDimension* dim : dims)
+            distributions.push_back(std::make_unique<CArrayBuffer>(std::vector<size_t>{ nTimes, dim->ClassesNumber() }));
+
+        // fill all arrays in one pass over time points
+        std::copy(timepoints.begin(), timepoints.end(), times.data());
+        double* pOverall = overall.data();
+        double* pComposition = composition.data();
+        for (size_t i = 0; i < nTimes; ++i)
+        {
+            const double t = timepoints[i];
+            *pOverall++ = stream->GetMass(t);
+            *pOverall++ = stream->GetTemperature(t);
+            *pOverall++ = stream->GetPressure(t);
+            for (const auto& phase : phases)
+                for (const auto& compoundKey : compoundKeys)
+                    *pComposition++ = stream->GetCompoundMass(t, compoundKey, phase.state);
+        }
+        // distributions for all time points at once; they stay zero if the stream has no solid phase
+        for (size_t d = 0; d < dims.size(); ++d)
+        {
+            const std::vector<double> distr = stream->GetDistributions(timepoints, dims[d]->DimensionType());
+            std::copy(distr.begin(), distr.end(), distributions[d]->data());
+        }
+
+        // shape metadata
+        std::vector<std::string> compoundNames;
+        for (const auto& compoundKey : compoundKeys) {
+            const CCompound* compound = materialsDatabase.GetCompound(compoundKey);
+            compoundNames.push_back(compound ? compound->GetName() : compoundKey);
+        }
+        std::vector<std::string> phaseNames;
+        for (const auto& phase : phases)
+            phaseNames.push_back(PhaseToString(phase.state));
+        std::vector<std::string> dimNames;
+        std::vector<size_t> classes;
+        nb::dict distrDict;
+        for (size_t d = 0; d < dims.size(); ++d) {
+            dimNames.emplace_back(DISTR_NAMES[GetDistributionTypeIndex(dims[d]->DimensionType())]);
+            classes.push_back(dims[d]->ClassesNumber());
+            distrDict[nb::str(dimNames.back().c_str())] = distributions[d]->release();
+        }
+
+        nb::dict result;
+        result["timepoints"] = times.release();
+        result["overall"] = overall.release();
+        result["overall_names"] = nb::cast(std::vector<std::string>{ massName, "temperature", "pressure" });
+        result["composition"] = composition.release();
+        result["phases"] = nb::cast(phaseNames);
+        result["compounds"] = nb::cast(compoundNames);
+        result["distributions"] = distrDict;
+        result["dimensions"] = nb::cast(dimNames);
+        result["classes"] = nb::cast(classes);
+        return result;
+    }
+}
+
+nanobind::dict PyDyssol::GetStreamArrays(const std::string& streamName) const {
+    const CStream* stream = m_flowsheet.GetStreamByName(streamName);
+    if (!stream) throw std::runtime_error("Stream not found: " + streamName);
+
+    std::vector<double> timepoints = stream->GetAllTimePoints();
+    double t_end = m_flowsheet.GetParameters()->endSimulationTime;
+    if (timepoints.empty() || std::abs(timepoints.back() - t_end) > 1e-6)
+        timepoints.push_back(t_end);
+
+    nanobind::dict result = StreamToArrays(stream, timepoints, "massflow", m_flowsheet, m_materialsDatabase);
+    result["stream"] = nb::cast(streamName);
+    return result;
+}
+
+nanobind::dict PyDyssol::GetUnitStreamArrays(const std::string& unitName, const std::string& streamName) const {
+    const auto* unit = m_flowsheet.GetUnitByName(unitName);
+    if (!unit) throw std::runtime_error("Unit not found: " + unitName);
+    const auto* stream = unit->GetModel()->GetStreamsManager().GetStream(streamName);
+    if (!stream) throw std::runtime_error("Stream not found: " + streamName);
+
+    std::vector<double> timepoints = stream->GetAllTimePoints();
+    double t_end = m_flowsheet.GetParameters()->endSimulationTime;
+    if (timepoints.empty() || std::abs(timepoints.back() - t_end) > 1e-6)
+        timepoints.push_back(t_end);
+
+    nanobind::dict result = StreamToArrays(stream, timepoints, "massflow", m_flowsheet, m_materialsDatabase);
+    result["unit"] = nb::cast(unitName);
+    result["stream"] = nb::cast(streamName);
+    return result;
+}
+
+nanobind::dict PyDyssol::GetUnitHoldupArrays(const std::string& unitName, const std::string& holdupName) const {
+    const auto* unit = m_flowsheet.GetUnitByName(unitName);
+    if (!unit) throw std::runtime_error("Unit not found: " + unitName);
+    const auto* model = unit->GetModel();
+    if (!model) throw std::runtime_error("Model not found for unit: " + unitName);
+    const auto* holdup = dynamic_cast<const CHoldup*>(model->GetStreamsManager().GetObjectWork(holdupName));
+    if (!holdup) throw std::runtime_error("Holdup not found: " + holdupName);
+
+    nanobind::dict result = StreamToArrays(holdup, holdup->GetAllTimePoints(), "mass", m_flowsheet, m_materialsDatabase);
+    result["unit"] = nb::cast(unitName);
+    result["holdup"] = nb::cast(holdupName);
+    return result;
+}
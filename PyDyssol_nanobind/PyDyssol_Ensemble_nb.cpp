@@ -0,0 +1,96 @@
+#include "PyDyssol_nb.h"
+#include "../SimulatorCore/EnsembleRunner.h"
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <nanobind/nanobind.h> // Include nanobind headers
+#include <nanobind/ndarray.h>  // For NumPy arrays
+#include <nanobind/stl/string.h> // For std::string bindings
+#include <nanobind/stl/vector.h> // For std::vector bindings
+
+namespace nb = nanobind;
+
+//Ensemble
+
+namespace
+{
+    // Converts a Python value of a unit parameter to a string in the same format as in scripts.
+    std::string ToParameterString(const nb::handle& value)
+    {
+        if (nb::isinstance<nb::str>(value))
+            return nb::cast<std::string>(value);
+        if (nb::isinstance<nb::bool_>(value))
+            return nb::cast<bool>(value) ? "1" : "0";
+        if (nb::isinstance<nb::list>(value) || nb::isinstance<nb::tuple>(value)) {
+            auto seq = nb::cast<nb::sequence>(value);
+            std::string res;
+            for (size_t i = 0; i < nb::len(seq); ++i)
+                res += (i == 0 ? "" : " ") + ToParameterString(seq[i]);
+            return res;
+        }
+        return nb::cast<std::string>(nb::str(value));
+    }
+
+    // Copies values into a new NumPy array.
+    nb::object ToArray(const std::vector<double>& values)
+    {
+        auto* data = new double[values.empty() ? 1 : values.size()];
+        std::copy(values.begin(), values.end(), data);
+        nb::capsule owner(data, [](void* p) noexcept { delete[] static_cast<double*>(p); });
+        const size_t shape[1]{ values.size() };
+        return nb::cast(nb::ndarray<nb::numpy, double>(data, 1, shape, owner));
+    }
+}
+
+nanobind::dict PyDyssol::RunEnsemble(const std::vector<std::pair<std::string, std::string>>& parameters,
+    const std::vector<std::vector<nanobind::object>>& values, const std::vector<std::vector<std::string>>& kpis, size_t threads)
+{
+    ThrowIfSimulationRunning();
+
+    CEnsembleRunner ensemble{ &m_flowsheet };
+    std::vector<CEnsembleRunner::SParameter> params;
+    for (const auto& [unit, parameter] : parameters)
+        params.push_back({ unit, parameter });
+    ensemble.SetParameters(params);
+
+    std::vector<CEnsembleRunner::SKPI> kpiList;
+    for (const auto& kpi : kpis) {
+        if (kpi.size() != 3 && kpi.size() != 4)
+            throw std::invalid_argument("KPI must be given as (name, type, stream) or (name, type, unit, holdup/state_variable).");
+        kpiList.push_back({ kpi[0], CEnsembleRunner::KPIType(kpi[1]), kpi[2], kpi.size() == 4 ? kpi[3] : "" });
+    }
+    ensemble.SetKPIs(kpiList);
+    ensemble.SetThreadsNumber(threads);
+    std::mutex consoleMutex;
+    ensemble.SetConsoleFunction([&](const std::string& _message) {
+        std::lock_guard lock{ consoleMutex };
+        std::cout << _message << std::endl;
+    });
+
+    // convert all values while holding the GIL
+    std::vector<std::vector<std::string>> strValues;
+    for (const auto& variant : values) {
+        std::vector<std::string> row;
+        for (const auto& value : variant)
+            row.push_back(ToParameterString(value));
+        strValues.push_back(std::move(row));
+    }
+    const std::string error = ensemble.Check(strValues);
+    if (!error.empty())
+        throw std::invalid_argument("Ensemble setup failed: " + error);
+
+    std::cout << "[PyDyssol] Starting simulation of " << strValues.size() << " flowsheet variants..." << std::endl;
+    CEnsembleRunner::SResults res;
+    {
+        // Python is not used during simulation, so other Python threads may run meanwhile
+        nb::gil_scoped_release release;
+        res = ensemble.Run(strValues);
+    }
+
+    nanobind::dict result;
+    for (size_t i = 0; i < res.names.size(); ++i)
+        result[nb::str(res.names[i].c_str())] = ToArray(res.columns[i]);
+    result["duration"] = ToArray(res.durations);
+    result["error"] = nb::cast(res.errors);
+    return result;
+}
@@ -395,6 +395,7 @@ nb::dict PyDyssol::GetUnitFeed(const std::string& unitName) {
 
 // Sets
 void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedName, double time, const nb::dict& data) {
+    ThrowIfSimulationRunning();
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
     if (!unit) throw std::runtime_error("Unit not found: " + unitName);
 
@@ -478,6 +479,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedN
 }
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, const nb::dict& data) {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
     const auto feeds = GetUnitFeeds(unitName);
     if (feeds.empty())
@@ -486,6 +488,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, const nb::dict& data) {
 }
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, double time, const nb::dict& data) {
+    ThrowIfSimulationRunning();
     const auto feeds = GetUnitFeeds(unitName);
     if (feeds.empty())
         throw std::runtime_error("No feeds found in unit: " + unitName);
@@ -493,6 +496,7 @@ void PyDyssol::SetUnitFeed(const std::string& unitName, double time, const nb::d
 }
 
 void PyDyssol::SetUnitFeed(const std::string& unitName, const std::string& feedName, const nb::dict& data) {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
     SetUnitFeed(unitName, feedName, time, data);
 }
\ No newline at end of file
@@ -583,6 +583,7 @@ void PyDyssol::SetHoldupValues(CHoldup* holdup, double time, const nanobind::dic
 
 void PyDyssol::SetUnitHoldup(const std::string& unitName, const nanobind::dict& data)
 {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
 
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
@@ -604,6 +605,7 @@ void PyDyssol::SetUnitHoldup(const std::string& unitName, const nanobind::dict&
 
 void PyDyssol::SetUnitHoldup(const std::string& unitName, const std::string& holdupName, const nanobind::dict& data)
 {
+    ThrowIfSimulationRunning();
     const double time = 0.0;
 
     CUnitContainer* unit = m_flowsheet.GetUnitByName(unitName);
@@ -15,6 +15,7 @@ inline std::string ToString(EConvergenceMethod method) {
     case EConvergenceMethod::DIRECT_SUBSTITUTION: return "DIRECT_SUBSTITUTION";
     case EConvergenceMethod::WEGSTEIN: return "WEGSTEIN";
     case EConvergenceMethod::STEFFENSEN: return "STEFFENSEN";
+    case EConvergenceMethod::ANDERSON: return "ANDERSON";
     default: return "UNKNOWN";
     }
 }
@@ -23,6 +24,7 @@ inline EConvergenceMethod ToConvergenceMethod(const std::string& name) {
     if (name == "DIRECT_SUBSTITUTION") return EConvergenceMethod::DIRECT_SUBSTITUTION;
     if (name == "WEGSTEIN") return EConvergenceMethod::WEGSTEIN;
     if (name == "STEFFENSEN") return EConvergenceMethod::STEFFENSEN;
+    if (name == "ANDERSON") return EConvergenceMethod::ANDERSON;
     throw std::invalid_argument("Unknown ConvergenceMethod: " + name);
 }
 
@@ -73,6 +75,7 @@ nb::dict PyDyssol::GetOptions() const
     out["convergenceMethod"] = ToString(static_cast<EConvergenceMethod>(p->convergenceMethod));
     out["wegsteinAccelParam"] = static_cast<double>(p->wegsteinAccelParam);
     out["relaxationParam"] = static_cast<double>(p->relaxationParam);
+    out["andersonDepth"] = static_cast<uint32_t>(p->andersonDepth);
 
     // Extrapolation
     out["extrapolationMethod"] = ToString(static_cast<EExtrapolationMethod>(p->extrapolationMethod));
@@ -91,6 +94,7 @@ nb::dict PyDyssol::GetOptions() const
 
 void PyDyssol::SetOptions(const nb::dict& options)
 {
+    ThrowIfSimulationRunning();
     CParametersHolder* p = m_flowsheet.GetParameters();
 
     auto get_double = [&](const char* key, auto setter) {
@@ -149,6 +153,7 @@ void PyDyssol::SetOptions(const nb::dict& options)
     get_enum_conv("convergenceMethod");
     get_double("wegsteinAccelParam", &CParametersHolder::WegsteinAccelParam);
     get_double("relaxationParam", &CParametersHolder::RelaxationParam);
+    get_uint("andersonDepth", &CParametersHolder::AndersonDepth);
 
     // Extrapolation method
     get_enum_extr("extrapolationMethod");
@@ -168,7 +173,7 @@ nb::dict PyDyssol::GetOptionsMethods() const
     nb::dict result;
 
     nb::list conv;
-    for (int i = 0; i <= static_cast<int>(EConvergenceMethod::STEFFENSEN); ++i)
+    for (int i = 0; i <= static_cast<int>(EConvergenceMethod::ANDERSON); ++i)
         conv.append(ToString(static_cast<EConvergenceMethod>(i)));
     result["convergenceMethod"] = conv;
 
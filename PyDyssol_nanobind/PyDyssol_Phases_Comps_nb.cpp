@@ -34,6 +34,7 @@ std::vector<std::pair<std::string, std::string>> PyDyssol::GetCompounds() const
 
 bool PyDyssol::SetCompounds(const std::vector<std::string>& compounds)
 {
+    ThrowIfSimulationRunning();
     std::vector<std::string> validKeys;
     for (const auto& comp : compounds)
     {
@@ -53,6 +54,7 @@ bool PyDyssol::SetCompounds(const std::vector<std::string>& compounds)
 
 bool PyDyssol::AddCompound(const std::string& compoundKeyOrName)
 {
+    ThrowIfSimulationRunning();
     const CCompound* comp = m_materialsDatabase.GetCompound(compoundKeyOrName);
     if (!comp)
         comp = m_materialsDatabase.GetCompoundByName(compoundKeyOrName);
@@ -78,6 +80,7 @@ nb::list PyDyssol::GetPhases() const
 
 bool PyDyssol::SetPhases(const nb::list& phaseStates)
 {
+    ThrowIfSimulationRunning();
     std::vector<SPhaseDescriptor> descriptors;
     for (const auto& stateObj : phaseStates)
     {
@@ -91,6 +94,7 @@ bool PyDyssol::SetPhases(const nb::list& phaseStates)
 
 bool PyDyssol::AddPhase(const nb::object& stateObj)
 {
+    ThrowIfSimulationRunning();
     EPhase state = ConvertPhaseState(nb::cast<nb::object>(stateObj));
     std::string name = PhaseToString(state);
     m_flowsheet.AddPhase(state, name);
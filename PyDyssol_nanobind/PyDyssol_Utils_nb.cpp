@@ -73,6 +73,7 @@ std::string FormatDouble(double value)
 
 bool PyDyssol::LoadMaterialsDatabase(const std::string& path)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Loading materials database: " << path << std::endl;
     fs::path absPath = fs::absolute(path);
     if (!m_materialsDatabase.LoadFromFile(absPath)) {
@@ -88,6 +89,7 @@ bool PyDyssol::LoadMaterialsDatabase(const std::string& path)
 
 bool PyDyssol::AddModelPath(const std::string& path)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Adding model path: " << path << std::endl;
     fs::path absPath = fs::absolute(path);
     m_modelsManager.AddDir(absPath);
@@ -5,6 +5,7 @@
 #include <map>
 #include <filesystem>
 #include <chrono>
+#include <algorithm>
 #include <iomanip>    // for std::setprecision
 #include <sstream>    // for std::ostringstream
 #include <nanobind/nanobind.h>
@@ -14,25 +15,38 @@
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/tuple.h>
 #include "SaveLoadManager.h"
+#include "Profiler.h"
 
 namespace fs = std::filesystem;
 namespace nb = nanobind; // Add namespace alias
 
-PyDyssol::PyDyssol(const std::string& materialsPath, const std::string& modelsPath)
+PyDyssol::PyDyssol(const std::string& materialsPath, const std::string& modelsPath, const std::string& modelsCache)
     : m_flowsheet(&m_modelsManager, &m_materialsDatabase),
     m_defaultMaterialsPath(materialsPath),
     m_defaultModelsPath(modelsPath),
     m_isInitialized(false)
 {
     m_simulator.SetFlowsheet(&m_flowsheet);
+    m_simulator.SetConsoleFunction([](const std::string& _message) { std::cout << _message << std::endl; });
 
     // Automatically load the default materials database and model path
     LoadMaterialsDatabase(m_defaultMaterialsPath);
+    // must be set before models are searched, so that unchanged libraries are not loaded
+    m_modelsManager.SetCacheFile(modelsCache);
     AddModelPath(m_defaultModelsPath);
 }
 
+PyDyssol::~PyDyssol()
+{
+    // the asynchronous simulation works with members of this object
+    m_simulator.Stop();
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+}
+
 bool PyDyssol::OpenFlowsheet(const std::string& filePath)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Opening flowsheet: " << filePath << std::endl;
     if (!fs::exists(filePath)) {
         std::cerr << "[PyDyssol] Flowsheet file does not exist: " << filePath << std::endl;
@@ -72,6 +86,7 @@ bool PyDyssol::OpenFlowsheet(const std::string& filePath)
 
 bool PyDyssol::SaveFlowsheet(const std::string& filePath)
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Saving flowsheet to: " << filePath << std::endl;
 
     // Ensure the directory exists
@@ -147,6 +162,7 @@ void PyDyssol::DebugFlowsheet()
 
 std::string PyDyssol::Initialize()
 {
+    ThrowIfSimulationRunning();
     std::cout << "[PyDyssol] Initializing flowsheet..." << std::endl;
     std::string error = m_flowsheet.Initialize();
     if (!error.empty()) {
@@ -160,6 +176,31 @@ std::string PyDyssol::Initialize()
 }
 
 void PyDyssol::Simulate(double endTime)
+{
+    ThrowIfSimulationRunning();
+    PrepareSimulation(endTime);
+    m_simulator.ClearLogEvents();
+    m_simulationStart = std::chrono::steady_clock::now();
+    m_simulationRunning = true;
+    // clears the running flag also if the simulation throws, so that the flowsheet is not locked forever
+    struct SRunningGuard
+    {
+        PyDyssol& self;
+        ~SRunningGuard()
+        {
+            {
+                std::lock_guard<std::mutex> lock(self.m_simulationMutex);
+                self.m_simulationRunning = false;
+            }
+            self.m_simulationFinished.notify_all();
+        }
+    } running{ *this };
+    // Python is not used during simulation, so other Python threads may run meanwhile
+    nb::gil_scoped_release release;
+    RunSimulation();
+}
+
+void PyDyssol::PrepareSimulation(double endTime)
 {
     if (!m_isInitialized) {
         std::string error = Initialize();
@@ -192,7 +233,10 @@ void PyDyssol::Simulate(double endTime)
         std::string model = GetModelNameForUnit(unit->GetKey());
         std::cout << "Simulation of " << name << " (" << model << "): [" << simStartTime << ", " << simEndTime << "]..." << std::endl;
     }
+}
 
+void PyDyssol::RunSimulation()
+{
     std::cout << "[PyDyssol] Starting simulation..." << std::endl;
     auto start = std::chrono::high_resolution_clock::now();
     m_simulator.Simulate();
@@ -209,9 +253,161 @@ void PyDyssol::Simulate(double endTime)
     std::cout << "Saving new initial values of tear streams..." << std::endl;
 
     double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1'000'000.0;
+    if (m_simulator.HasError())
+        std::cout << "[PyDyssol] Simulation finished with error: " << m_simulator.GetLastError() << std::endl;
     std::cout << "[PyDyssol] Simulation finished in " << std::fixed << std::setprecision(3) << seconds << " [s]" << std::endl;
 }
 
+void PyDyssol::StartSimulation(double endTime)
+{
+    ThrowIfSimulationRunning();
+    PrepareSimulation(endTime);
+    m_simulator.ClearLogEvents();
+    m_simulationStart = std::chrono::steady_clock::now();
+    m_simulationException = nullptr;
+    m_simulationRunning = true;
+    // so that cancel_simulation() is not lost, if it is called before the thread starts the simulation
+    m_simulator.SetCurrentStatus(ESimulatorState::RUNNING);
+    m_simulationThread = std::thread([this] {
+        try {
+            RunSimulation();
+        }
+        catch (...) {
+            m_simulationException = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_simulationMutex);
+            m_simulationRunning = false;
+        }
+        m_simulationFinished.notify_all();
+    });
+}
+
+nanobind::dict PyDyssol::PollSimulation() const
+{
+    const bool running = m_simulationRunning || m_simulator.GetCurrentStatus() != ESimulatorState::IDLE;
+    const CSimulator::SProgress progress = m_simulator.GetProgress();
+    const CParametersHolder* parameters = m_flowsheet.GetParameters();
+    const double duration = parameters->endSimulationTime - parameters->startSimulationTime;
+
+    // each partition is simulated over the whole time interval one after another
+    double fraction = 0.0;
+    if (!running && !m_simulator.HasError() && progress.partitionsNumber != 0)
+        fraction = 1.0;
+    else if (progress.partitionsNumber != 0) {
+        const double local = duration > 0.0 ? (progress.dTWStart - parameters->startSimulationTime) / duration : 0.0;
+        fraction = std::clamp((static_cast<double>(progress.iPartition) + local) / static_cast<double>(progress.partitionsNumber), 0.0, 1.0);
+    }
+
+    std::string status;
+    switch (m_simulator.GetCurrentStatus()) {
+    case ESimulatorState::IDLE:          status = "idle";     break;
+    case ESimulatorState::RUNNING:       status = "running";  break;
+    case ESimulatorState::TO_BE_STOPPED: status = "stopping"; break;
+    }
+
+    nanobind::dict result;
+    result["running"] = running;
+    result["status"] = nb::cast(status);
+    result["unit"] = nb::cast(progress.unitName);
+    result["partition"] = progress.iPartition;
+    result["partitions"] = progress.partitionsNumber;
+    result["time_window"] = nb::make_tuple(progress.dTWStart, progress.dTWEnd);
+    result["window"] = progress.iWindowNumber;
+    result["iteration"] = progress.iIteration;
+    result["time"] = progress.time;
+    result["progress"] = fraction;
+    result["elapsed"] = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_simulationStart).count();
+    result["dropped_events"] = m_simulator.DroppedLogEventsNumber();
+    result["error"] = nb::cast(running ? std::string{} : m_simulator.GetLastError());
+    return result;
+}
+
+nanobind::list PyDyssol::PopSimulationEvents()
+{
+    nanobind::list events;
+    CSimulatorLog::SEvent e;
+    while (m_simulator.ReadLogEvent(e)) {
+        nanobind::dict event;
+        if (e.type == CSimulatorLog::EEventType::MESSAGE) {
+            std::string level;
+            switch (e.color) {
+            case CSimulatorLog::ELogColor::DEFAULT: level = "info";    break;
+            case CSimulatorLog::ELogColor::ORANGE:  level = "warning"; break;
+            case CSimulatorLog::ELogColor::RED:     level = "error";   break;
+            }
+            event["type"] = nb::cast(std::string{ "message" });
+            event["level"] = nb::cast(level);
+            event["text"] = nb::cast(e.text);
+        }
+        else {
+            event["type"] = nb::cast(std::string{ "progress" });
+            event["unit"] = nb::cast(e.progress.unitName);
+            event["partition"] = e.progress.iPartition;
+            event["partitions"] = e.progress.partitionsNumber;
+            event["window"] = e.progress.iWindowNumber;
+            event["iteration"] = e.progress.iIteration;
+            event["time_window"] = nb::make_tuple(e.progress.dTWStart, e.progress.dTWEnd);
+            event["time"] = e.progress.time;
+        }
+        events.append(event);
+    }
+    return events;
+}
+
+void PyDyssol::CancelSimulation()
+{
+    m_simulator.Stop();
+}
+
+bool PyDyssol::WaitSimulation(double timeout)
+{
+    {
+        nb::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(m_simulationMutex);
+        const auto finished = [&] { return !m_simulationRunning; };
+        if (timeout < 0.0)
+            m_simulationFinished.wait(lock, finished);
+        else if (!m_simulationFinished.wait_for(lock, std::chrono::duration<double>(timeout), finished))
+            return false;
+    }
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+    if (m_simulationException) {
+        std::exception_ptr exception = m_simulationException;
+        m_simulationException = nullptr;
+        std::rethrow_exception(exception);
+    }
+    return true;
+}
+
+void PyDyssol::EnableProfiling(bool enable)
+{
+    // each profiling session starts from scratch
+    if (enable)
+        Profiler::Reset();
+    Profiler::Enable(enable);
+}
+
+std::string PyDyssol::GetProfile() const
+{
+    return Profiler::Report();
+}
+
+bool PyDyssol::ExportProfileTrace(const std::string& filePath) const
+{
+    return Profiler::ExportTrace(filePath);
+}
+
+void PyDyssol::ThrowIfSimulationRunning()
+{
+    if (m_simulationRunning)
+        throw std::runtime_error("Simulation is running. Call wait_simulation() or cancel_simulation() first.");
+    // release the thread of the finished asynchronous simulation
+    if (m_simulationThread.joinable())
+        m_simulationThread.join();
+}
+
 // Methods for unit parameters
 
 std::vector<std::pair<std::string, std::string>> PyDyssol::GetUnits()
@@ -4,6 +4,12 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <variant>
 #include <nanobind/nanobind.h> // Include nanobind headers
 #include <nanobind/stl/string.h> // For std::string bindings
@@ -32,20 +38,41 @@ private:
     CModelsManager m_modelsManager;         // Units and solvers manager
     CFlowsheet m_flowsheet;                 // Flowsheet, now dependent on materials and models
     CSimulator m_simulator;                 // Simulator
+    std::thread m_simulationThread;         // Thread of the asynchronous simulation
+    std::atomic<bool> m_simulationRunning{ false }; // Flag to track whether the asynchronous simulation is running
+    std::mutex m_simulationMutex;           // Guards waiting for the end of the asynchronous simulation
+    std::condition_variable m_simulationFinished; // Notifies about the end of the asynchronous simulation
+    std::exception_ptr m_simulationException; // Exception thrown during the asynchronous simulation
+    std::chrono::steady_clock::time_point m_simulationStart; // Start time of the last simulation
     std::string m_defaultMaterialsPath;     // Default path for materials database
     std::string m_defaultModelsPath;        // Default path for model units
     bool m_isInitialized;                   // Flag to track initialization state
     void SetHoldupValues(CHoldup* holdup, double time, const nanobind::dict& data, const std::vector<const CGridDimension*>& gridDims);
+    void PrepareSimulation(double endTime); // Initialize flowsheet and set simulation time
+    void RunSimulation();                   // Run prepared simulation, does not use Python
+    void ThrowIfSimulationRunning();        // Throw if the asynchronous simulation is running
 
 public:
     PyDyssol(const std::string& materialsPath = "D:/Dyssol/Materials.dmdb",
-        const std::string& modelsPath = "C:/Program Files/Dyssol/Units");
+        const std::string& modelsPath = "C:/Program Files/Dyssol/Units",
+        const std::string& modelsCache = "");
+    ~PyDyssol();
 
     bool LoadMaterialsDatabase(const std::string& path);
     bool AddModelPath(const std::string& path);
     bool OpenFlowsheet(const std::string& filePath);
     bool SaveFlowsheet(const std::string& filePath);
     void Simulate(double endTime = -1.0); // Default: -1 means no override
+    //Asynchronous simulation in a background thread
+    void StartSimulation(double endTime = -1.0);
+    nanobind::dict PollSimulation() const;
+    nanobind::list PopSimulationEvents();
+    void CancelSimulation();
+    bool WaitSimulation(double timeout = -1.0); // Default: -1 means wait until finished
+    //Profiling of the simulation
+    void EnableProfiling(bool enable = true);
+    std::string GetProfile() const;
+    bool ExportProfileTrace(const std::string& filePath) const;
     std::string Initialize();
     void DebugFlowsheet();
     std::vector<std::pair<std::string, std::string>> GetDatabaseCompounds() const;
@@ -168,6 +195,15 @@ public:
     nanobind::dict GetStreamDistribution(const std::string& streamName);
     nanobind::dict GetStream(const std::string& streamName);
 
+    //Arrays: all timepoints as contiguous NumPy arrays [time x ...]
+    nanobind::dict GetStreamArrays(const std::string& streamName) const;
+    nanobind::dict GetUnitStreamArrays(const std::string& unitName, const std::string& streamName) const;
+    nanobind::dict GetUnitHoldupArrays(const std::string& unitName, const std::string& holdupName) const;
+
+    //Ensemble: in-memory variants of the flowsheet simulated in parallel
+    nanobind::dict RunEnsemble(const std::vector<std::pair<std::string, std::string>>& parameters,
+        const std::vector<std::vector<nanobind::object>>& values, const std::vector<std::vector<std::string>>& kpis, size_t threads = 0);
+
     //Options
     nanobind::dict GetOptions() const;
     void SetOptions(const nanobind::dict& options);
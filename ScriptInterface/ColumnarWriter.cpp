@@ -0,0 +1,165 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "ColumnarWriter.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+
+void CColumnarWriter::SetNotation(ENotation _notation, int _precision)
+{
+	m_notation = _notation;
+	m_precision = _precision;
+}
+
+bool CColumnarWriter::Open(const std::filesystem::path& _path, EFormat _format, const std::vector<std::string>& _columns, size_t _rows)
+{
+	m_format = _format;
+	m_columns = _columns.size();
+	m_rowsLeft = _rows;
+	m_file.open(_path, std::ios::out | std::ios::trunc | std::ios::binary);
+	if (!m_file) return false;
+	const auto columns = MakeUnique(_columns);
+	switch (m_format)
+	{
+	case EFormat::CSV: WriteHeaderCSV(columns);			break;
+	case EFormat::NPY: WriteHeaderNPY(columns, _rows);	break;
+	}
+	return m_file.good();
+}
+
+bool CColumnarWriter::Write(const std::vector<double>& _values)
+{
+	if (!m_file || m_columns == 0 || _values.size() % m_columns != 0 || _values.size() / m_columns > m_rowsLeft) return false;
+	switch (m_format)
+	{
+	case EFormat::CSV: WriteCSV(_values); break;
+	case EFormat::NPY: WriteNPY(_values); break;
+	}
+	m_rowsLeft -= _values.size() / m_columns;
+	return m_file.good();
+}
+
+bool CColumnarWriter::Close()
+{
+	const bool success = m_file.good() && m_rowsLeft == 0;
+	m_file.close();
+	return success;
+}
+
+void CColumnarWriter::WriteHeaderCSV(const std::vector<std::string>& _columns)
+{
+	for (size_t i = 0; i < _columns.size(); ++i)
+	{
+		if (i != 0) m_file << ',';
+		// quote names, doubling the quotes inside
+		m_file << '"';
+		for (const char c : _columns[i])
+			m_file << (c == '"' ? "\"\"" : std::string(1, c));
+		m_file << '"';
+	}
+	m_file << '\n';
+}
+
+void CColumnarWriter::WriteHeaderNPY(const std::vector<std::string>& _columns, size_t _rows)
+{
+	// byte order of doubles on this machine
+	constexpr uint16_t test = 1;
+	const char order = *reinterpret_cast<const char*>(&test) == 1 ? '<' : '>';
+
+	// structured data type with a named double field for each column
+	bool ascii = true;
+	std::string dict = "{'descr': [";
+	for (const auto& name : _columns)
+	{
+		dict += "('";
+		for (const char c : name)
+		{
+			if (c == '\\' || c == '\'') dict += '\\';
+			dict += c;
+			ascii &= static_cast<unsigned char>(c) < 128;
+		}
+		dict += "', '" + std::string(1, order) + "f8'), ";
+	}
+	dict += "], 'fortran_order': False, 'shape': (" + std::to_string(_rows) + ",), }";
+
+	// version 1.0 allows only short latin-1 headers, version 3.0 allows long utf-8 headers
+	constexpr size_t magicLen = 6;
+	const bool v1 = ascii && dict.size() + 64 < 65535;
+	const size_t prefixLen = magicLen + 2 + (v1 ? 2 : 4);
+	// total header length must be divisible by 64, the header ends with a new line
+	const size_t headerLen = (prefixLen + dict.size() + 1 + 63) / 64 * 64 - prefixLen;
+	dict.append(headerLen - dict.size() - 1, ' ');
+	dict += '\n';
+
+	m_file.write("\x93NUMPY", magicLen);
+	m_file.put(static_cast<char>(v1 ? 1 : 3));
+	m_file.put(0);
+	// length of the header in little-endian
+	for (size_t i = 0; i < (v1 ? 2 : 4); ++i)
+		m_file.put(static_cast<char>(headerLen >> 8 * i & 0xFF));
+	m_file.write(dict.data(), static_cast<std::streamsize>(dict.size()));
+}
+
+void CColumnarWriter::WriteCSV(const std::vector<double>& _values)
+{
+	// each block of rows is formatted into its own buffer in parallel, and then all buffers are written in order
+	constexpr size_t rowsPerBlock = 256;
+	const size_t maxValueLen = 32 + static_cast<size_t>(std::max(m_precision, 0));
+	const size_t rows = _values.size() / m_columns;
+	const size_t blocks = (rows + rowsPerBlock - 1) / rowsPerBlock;
+	std::vector<std::string> buffers(blocks);
+	ParallelFor(blocks, [&](size_t _iBlock)
+	{
+		const size_t iBeg = _iBlock * rowsPerBlock;
+		const size_t iEnd = std::min(iBeg + rowsPerBlock, rows);
+		std::string& buf = buffers[_iBlock];
+		buf.resize((iEnd - iBeg) * m_columns * (maxValueLen + 1));
+		char* pos = buf.data();
+		for (size_t i = iBeg; i < iEnd; ++i)
+			for (size_t j = 0; j < m_columns; ++j)
+			{
+				pos = FormatValue(pos, pos + maxValueLen, _values[i * m_columns + j]);
+				*pos++ = j == m_columns - 1 ? '\n' : ',';
+			}
+		buf.resize(pos - buf.data());
+	});
+	for (const auto& buf : buffers)
+		m_file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+}
+
+void CColumnarWriter::WriteNPY(const std::vector<double>& _values)
+{
+	m_file.write(reinterpret_cast<const char*>(_values.data()), static_cast<std::streamsize>(_values.size() * sizeof(double)));
+}
+
+std::vector<std::string> CColumnarWriter::MakeUnique(const std::vector<std::string>& _names)
+{
+	// NumPy rejects structured types with repeated field names, and tables with repeated column names are ambiguous
+	std::vector<std::string> res;
+	res.reserve(_names.size());
+	for (const auto& name : _names)
+	{
+		std::string unique = name;
+		for (size_t i = 2; std::find(res.begin(), res.end(), unique) != res.end(); ++i)
+			unique = name + "_" + std::to_string(i);
+		res.push_back(unique);
+	}
+	return res;
+}
+
+char* CColumnarWriter::FormatValue(char* _pos, char* _end, double _value) const
+{
+	std::to_chars_result res{};
+	switch (m_notation)
+	{
+	case ENotation::SHORTEST:	res = std::to_chars(_pos, _end, _value);											break;
+	case ENotation::GENERAL:	res = std::to_chars(_pos, _end, _value, std::chars_format::general, m_precision);		break;
+	case ENotation::FIXED:		res = std::to_chars(_pos, _end, _value, std::chars_format::fixed, m_precision);		break;
+	case ENotation::SCIENTIFIC:	res = std::to_chars(_pos, _end, _value, std::chars_format::scientific, m_precision);	break;
+	}
+	if (res.ec == std::errc{}) return res.ptr;
+	// does not fit into the reserved space, e.g. a huge value in fixed notation
+	return std::to_chars(_pos, _end, _value, std::chars_format::scientific, m_precision).ptr;
+}
@@ -0,0 +1,64 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * Writes a table of double values with named columns into a file, row by row in blocks.
+ * The number of rows is known in advance, so only the current block must be kept in memory.
+ * Supported formats:
+ * CSV - text with a header line, values are formatted in parallel;
+ * NPY - NumPy binary file with a structured array, one named field per column (numpy.load, pandas.DataFrame).
+ */
+class CColumnarWriter
+{
+public:
+	// Formats of the output file.
+	enum class EFormat
+	{
+		CSV, NPY
+	};
+	// Representation of floating point values in text formats.
+	enum class ENotation
+	{
+		SHORTEST, GENERAL, FIXED, SCIENTIFIC
+	};
+
+private:
+	std::ofstream m_file;							// Output file.
+	EFormat m_format{ EFormat::CSV };				// Format of the output file.
+	ENotation m_notation{ ENotation::SHORTEST };	// Representation of values in text formats.
+	int m_precision{ 6 };							// Precision of values in text formats, if notation is not SHORTEST.
+	size_t m_columns{ 0 };							// Number of columns.
+	size_t m_rowsLeft{ 0 };							// Number of rows, which still must be written.
+
+public:
+	// Sets representation of values in text formats. Must be called before Open().
+	void SetNotation(ENotation _notation, int _precision = 6);
+
+	// Creates a file and writes a header for a table with the given columns and number of rows. Repeated names of columns get numeric suffixes. Returns success flag.
+	bool Open(const std::filesystem::path& _path, EFormat _format, const std::vector<std::string>& _columns, size_t _rows);
+	// Appends complete rows, given in row-major order. Returns success flag.
+	bool Write(const std::vector<double>& _values);
+	// Closes the file. Returns false if not all announced rows have been written or writing failed.
+	bool Close();
+
+private:
+	// Writes the header of a CSV file.
+	void WriteHeaderCSV(const std::vector<std::string>& _columns);
+	// Writes the header of a NPY file.
+	void WriteHeaderNPY(const std::vector<std::string>& _columns, size_t _rows);
+	// Formats and writes rows in a CSV file.
+	void WriteCSV(const std::vector<double>& _values);
+	// Writes rows in a NPY file.
+	void WriteNPY(const std::vector<double>& _values);
+
+	// Returns names with numeric suffixes added to the repeated ones, e.g. {a, a, b} -> {a, a_2, b}.
+	static std::vector<std::string> MakeUnique(const std::vector<std::string>& _names);
+	// Converts the value to a string and writes it into the buffer starting at _pos. Returns a pointer to the end of the written value.
+	char* FormatValue(char* _pos, char* _end, double _value) const;
+};
@@ -9,6 +9,14 @@
 #include <map>
 #include <algorithm>
 
+// Formats of files with exported simulation results.
+enum class EExportFormat
+{
+	TEXT, // all results in one text file, one line per exported entry
+	CSV,  // one CSV table per exported entry, one row per time point
+	NPY   // one binary NumPy table per exported entry, one row per time point
+};
+
 /*
  * Helper functions for mapping enum values and their string representations.
  */
@@ -29,6 +37,7 @@ namespace
 		{ EConvergenceMethod::DIRECT_SUBSTITUTION , { "DIRECT_SUBSTITUTION" } },
 		{ EConvergenceMethod::WEGSTEIN            , { "WEGSTEIN"            } },
 		{ EConvergenceMethod::STEFFENSEN          , { "STEFFENSEN"          } },
+		{ EConvergenceMethod::ANDERSON            , { "ANDERSON"            } },
 	};
 
 	template<> std::map<EExtrapolationMethod, std::vector<std::string>>SEnumStrings<EExtrapolationMethod>::data
@@ -38,6 +47,13 @@ namespace
 		{ EExtrapolationMethod::NEAREST, { "NEAREST_NEIGHBOR" } },
 	};
 
+	template<> std::map<EExportFormat, std::vector<std::string>>SEnumStrings<EExportFormat>::data
+	{
+		{ EExportFormat::TEXT, { "TEXT" } },
+		{ EExportFormat::CSV , { "CSV"  } },
+		{ EExportFormat::NPY , { "NPY"  } },
+	};
+
 	template<> std::map<EPhase, std::vector<std::string>>SEnumStrings<EPhase>::data
 	{
 		{ EPhase::SOLID , { "SOLID"        } },
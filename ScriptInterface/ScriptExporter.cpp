@@ -158,6 +158,11 @@ namespace ScriptInterface
 				job.AddEntry(e.keyStr)->value = _flowsheet.GetParameters()->wegsteinAccelParam;
 				break;
 			}
+			case EScriptKeys::ANDERSON_DEPTH:
+			{
+				job.AddEntry(e.keyStr)->value = static_cast<uint64_t>(_flowsheet.GetParameters()->andersonDepth);
+				break;
+			}
 			case EScriptKeys::EXTRAPOLATION_METHOD:
 			{
 				job.AddEntry(e.keyStr)->value = SNamedEnum{ static_cast<EExtrapolationMethod>(_flowsheet.GetParameters()->extrapolationMethod) };
@@ -366,7 +371,12 @@ namespace ScriptInterface
 				}
 				break;
 			}
+			case EScriptKeys::KERNEL_CACHE_FILE:
+			case EScriptKeys::MODELS_CACHE_FILE:
+			case EScriptKeys::PROFILING:
+			case EScriptKeys::PROFILING_TRACE_FILE:
 			case EScriptKeys::EXPORT_FILE:
+			case EScriptKeys::EXPORT_FORMAT:
 			case EScriptKeys::EXPORT_PRECISION:
 			case EScriptKeys::EXPORT_FIXED_POINT:
 			case EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT:
@@ -389,6 +399,11 @@ namespace ScriptInterface
 			case EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS:
 			case EScriptKeys::EXPORT_UNIT_STATE_VARIABLE:
 			case EScriptKeys::EXPORT_UNIT_PLOT:
+			case EScriptKeys::ENSEMBLE_FILE:
+			case EScriptKeys::ENSEMBLE_THREADS:
+			case EScriptKeys::ENSEMBLE_PARAMETER:
+			case EScriptKeys::ENSEMBLE_VARIANT:
+			case EScriptKeys::ENSEMBLE_KPI:
 				break;
 			}
 		}
@@ -43,6 +43,10 @@ namespace ScriptInterface
 		RESULT_FILE                      ,
 		MATERIALS_DATABASE               ,
 		MODELS_PATH                      ,
+		KERNEL_CACHE_FILE                ,
+		MODELS_CACHE_FILE                ,
+		PROFILING                        ,
+		PROFILING_TRACE_FILE             ,
 		SIMULATION_TIME                  ,
 		RELATIVE_TOLERANCE               ,
 		ABSOLUTE_TOLERANCE               ,
@@ -63,6 +67,7 @@ namespace ScriptInterface
 		CONVERGENCE_METHOD               ,
 		RELAXATION_PARAMETER             ,
 		ACCELERATION_LIMIT               ,
+		ANDERSON_DEPTH                   ,
 		EXTRAPOLATION_METHOD             ,
 		COMPOUNDS                        ,
 		PHASES                           ,
@@ -79,6 +84,7 @@ namespace ScriptInterface
 		HOLDUP_COMPOUNDS                 ,
 		HOLDUP_DISTRIBUTION              ,
 		EXPORT_FILE                      ,
+		EXPORT_FORMAT                    ,
 		EXPORT_PRECISION                 ,
 		EXPORT_FIXED_POINT               ,
 		EXPORT_SIGNIFICANCE_LIMIT        ,
@@ -101,6 +107,11 @@ namespace ScriptInterface
 		EXPORT_HOLDUP_DISTRIBUTIONS      ,
 		EXPORT_UNIT_STATE_VARIABLE       ,
 		EXPORT_UNIT_PLOT                 ,
+		ENSEMBLE_FILE                    ,
+		ENSEMBLE_THREADS                 ,
+		ENSEMBLE_PARAMETER               ,
+		ENSEMBLE_VARIANT                 ,
+		ENSEMBLE_KPI                     ,
 	};
 
 	// All possible types of script entries.
@@ -226,6 +237,10 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::RESULT_FILE                      , EEntryType::PATH)               ,
 		MAKE_SED(EScriptKeys::MATERIALS_DATABASE               , EEntryType::PATH)               ,
 		MAKE_SED(EScriptKeys::MODELS_PATH                      , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::KERNEL_CACHE_FILE                , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::MODELS_CACHE_FILE                , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::PROFILING                        , EEntryType::BOOL)               ,
+		MAKE_SED(EScriptKeys::PROFILING_TRACE_FILE             , EEntryType::PATH)               ,
 		// flowsheet parameters
 		MAKE_SED(EScriptKeys::SIMULATION_TIME                  , EEntryType::DOUBLE)             ,
 		MAKE_SED(EScriptKeys::RELATIVE_TOLERANCE               , EEntryType::DOUBLE)             ,
@@ -247,6 +262,7 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::CONVERGENCE_METHOD               , EEntryType::NAME_OR_KEY)        ,
 		MAKE_SED(EScriptKeys::RELAXATION_PARAMETER             , EEntryType::DOUBLE)             ,
 		MAKE_SED(EScriptKeys::ACCELERATION_LIMIT               , EEntryType::DOUBLE)             ,
+		MAKE_SED(EScriptKeys::ANDERSON_DEPTH                   , EEntryType::UINT)               ,
 		MAKE_SED(EScriptKeys::EXTRAPOLATION_METHOD             , EEntryType::NAME_OR_KEY)        ,
 		// flowsheet settings
 		MAKE_SED(EScriptKeys::COMPOUNDS                        , EEntryType::STRINGS)            ,
@@ -266,6 +282,7 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::HOLDUP_DISTRIBUTION              , EEntryType::HOLDUP_DISTRIBUTION),
 		// export
 		MAKE_SED(EScriptKeys::EXPORT_FILE                      , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::EXPORT_FORMAT                    , EEntryType::NAME_OR_KEY)        ,
 		MAKE_SED(EScriptKeys::EXPORT_PRECISION                 , EEntryType::INT)                ,
 		MAKE_SED(EScriptKeys::EXPORT_FIXED_POINT               , EEntryType::BOOL)               ,
 		MAKE_SED(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT        , EEntryType::DOUBLE)             ,
@@ -288,6 +305,12 @@ namespace ScriptInterface
 		MAKE_SED(EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS      , EEntryType::EXPORT_HOLDUP)      ,
 		MAKE_SED(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE       , EEntryType::EXPORT_STATE_VAR)   ,
 		MAKE_SED(EScriptKeys::EXPORT_UNIT_PLOT                 , EEntryType::EXPORT_PLOT)        ,
+		// ensemble
+		MAKE_SED(EScriptKeys::ENSEMBLE_FILE                    , EEntryType::PATH)               ,
+		MAKE_SED(EScriptKeys::ENSEMBLE_THREADS                 , EEntryType::UINT)               ,
+		MAKE_SED(EScriptKeys::ENSEMBLE_PARAMETER               , EEntryType::STRINGS)            ,
+		MAKE_SED(EScriptKeys::ENSEMBLE_VARIANT                 , EEntryType::STRINGS)            ,
+		MAKE_SED(EScriptKeys::ENSEMBLE_KPI                     , EEntryType::STRINGS)            ,
 	};
 
 	// Returns a vector of string representations all possible script keys.
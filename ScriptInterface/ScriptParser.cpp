@@ -82,5 +82,7 @@ void CScriptParser::NamesToKeys() const
 			param->FillAndWarn<EConvergenceMethod>();
 		for (auto* param : job->GetValuesPtr<SNamedEnum>(EScriptKeys::EXTRAPOLATION_METHOD))
 			param->FillAndWarn<EExtrapolationMethod>();
+		for (auto* param : job->GetValuesPtr<SNamedEnum>(EScriptKeys::EXPORT_FORMAT))
+			param->FillAndWarn<EExportFormat>();
 	}
 }
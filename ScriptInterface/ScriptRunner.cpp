@@ -7,9 +7,14 @@
 #include "SaveLoadManager.h"
 #include "DyssolStringConstants.h"
 #include "DyssolUtilities.h"
+#include "EnsembleRunner.h"
+#include "ColumnarWriter.h"
+#include "Profiler.h"
 #include <sstream>
 #include <fstream>
 #include <functional>
+#include <mutex>
+#include <set>
 
 using namespace ScriptInterface;
 using namespace StrConst;
@@ -23,7 +28,7 @@ bool CScriptRunner::RunJob(const CScriptJob& _job)
 	Clear();
 	bool success = true;
 	if (success) success &= CreateFlowsheet(_job);
-	if (success) success &= RunSimulation(_job);
+	if (success) success &= _job.HasKey(EScriptKeys::ENSEMBLE_FILE) ? RunEnsemble(_job) : RunSimulation(_job);
 	if (success) success &= ExportResults(_job);
 
 	const auto tEnd = ch::steady_clock::now();
@@ -39,6 +44,11 @@ bool CScriptRunner::RunJob(const CScriptJob& _job)
 	return success;
 }
 
+void CScriptRunner::SetLogPrefix(const std::string& _prefix)
+{
+	m_logPrefix = _prefix;
+}
+
 bool CScriptRunner::CreateFlowsheet(const CScriptJob& _job)
 {
 	bool success = true;
@@ -66,6 +76,14 @@ bool CScriptRunner::LoadFiles(const CScriptJob& _job)
 	if (!m_materialsDatabase.LoadFromFile(MDBfile))
 		return PrintMessage(DyssolC_ErrorMDB());
 
+	// set file to store descriptors of models
+	if (_job.HasKey(EScriptKeys::MODELS_CACHE_FILE))
+	{
+		const auto cacheFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::MODELS_CACHE_FILE)).make_preferred();
+		PrintMessage(DyssolC_ModelsCache(cacheFile.string()));
+		m_modelsManager.SetCacheFile(cacheFile);
+	}
+
 	// set paths to models
 	auto modelsPaths = _job.GetValues<fs::path>(EScriptKeys::MODELS_PATH);
 	modelsPaths.insert(modelsPaths.begin(), fs::current_path()); // add current path
@@ -74,6 +92,14 @@ bool CScriptRunner::LoadFiles(const CScriptJob& _job)
 	for (auto& dir : m_modelsManager.GetAllActiveDirFullPaths())
 		PrintMessage(DyssolC_LoadModels(dir.make_preferred().string()));
 
+	// set file to store tabulated agglomeration kernels
+	if (_job.HasKey(EScriptKeys::KERNEL_CACHE_FILE))
+	{
+		const auto cacheFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::KERNEL_CACHE_FILE)).make_preferred();
+		PrintMessage(DyssolC_KernelCache(cacheFile.string()));
+		m_modelsManager.SetKernelCacheFile(cacheFile);
+	}
+
 	// load flowsheet
 	if (hasSrc)
 	{
@@ -288,6 +314,7 @@ bool CScriptRunner::SetupFlowsheetParameters(const CScriptJob& _job)
 	if (_job.HasKey(EScriptKeys::ITERATIONS_UPPER_LIMIT))       params->ItersUpperLimit    (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_UPPER_LIMIT)      ));
 	if (_job.HasKey(EScriptKeys::ITERATIONS_LOWER_LIMIT))       params->ItersLowerLimit    (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_LOWER_LIMIT)      ));
 	if (_job.HasKey(EScriptKeys::ITERATIONS_UPPER_LIMIT_1ST))   params->Iters1stUpperLimit (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ITERATIONS_UPPER_LIMIT_1ST)  ));
+	if (_job.HasKey(EScriptKeys::ANDERSON_DEPTH))               params->AndersonDepth      (static_cast<uint32_t>            (_job.GetValue<uint64_t>  (EScriptKeys::ANDERSON_DEPTH)              ));
 	if (_job.HasKey(EScriptKeys::CONVERGENCE_METHOD))           params->ConvergenceMethod  (static_cast<EConvergenceMethod>  (_job.GetValue<SNamedEnum>(EScriptKeys::CONVERGENCE_METHOD).key      ));
 	if (_job.HasKey(EScriptKeys::EXTRAPOLATION_METHOD))         params->ExtrapolationMethod(static_cast<EExtrapolationMethod>(_job.GetValue<SNamedEnum>(EScriptKeys::EXTRAPOLATION_METHOD).key    ));
 
@@ -506,8 +533,17 @@ bool CScriptRunner::RunSimulation(const CScriptJob& _job)
 	if (!error.empty())
 		return PrintMessage(DyssolC_ErrorInit(error));
 
+	// start profiling
+	const bool profiling = (_job.HasKey(EScriptKeys::PROFILING) && _job.GetValue<bool>(EScriptKeys::PROFILING)) || _job.HasKey(EScriptKeys::PROFILING_TRACE_FILE);
+	if (profiling)
+	{
+		Profiler::Reset();
+		Profiler::Enable(true);
+	}
+
 	// run simulation
 	m_simulator.SetFlowsheet(&m_flowsheet);
+	m_simulator.SetConsoleFunction([this](const std::string& _message) { PrintMessage(_message); });
 	PrintMessage(DyssolC_Start());
 	const auto tStart = ch::steady_clock::now();
 	m_simulator.Simulate();
@@ -518,7 +554,108 @@ bool CScriptRunner::RunSimulation(const CScriptJob& _job)
 	PrintMessage(DyssolC_SimFinished(elapsed_s.count(), elapsed_ms.count()));
 
 	// save simulation results
-	return SaveFlowsheet(_job);
+	const bool success = SaveFlowsheet(_job);
+
+	// report profiling results
+	if (profiling)
+	{
+		Profiler::Enable(false);
+		PrintMessage(DyssolC_ProfilingReport(Profiler::Report()));
+		if (_job.HasKey(EScriptKeys::PROFILING_TRACE_FILE))
+		{
+			const auto traceFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::PROFILING_TRACE_FILE)).make_preferred();
+			PrintMessage(DyssolC_ProfilingTrace(traceFile.string()));
+			if (!Profiler::ExportTrace(traceFile))
+				PrintMessage(DyssolC_ErrorProfilingTrace());
+		}
+	}
+
+	return success;
+}
+
+bool CScriptRunner::RunEnsemble(const CScriptJob& _job)
+{
+	CEnsembleRunner ensemble{ &m_flowsheet };
+
+	// overridden parameters
+	std::vector<CEnsembleRunner::SParameter> params;
+	for (const auto& entry : _job.GetValues<std::vector<std::string>>(EScriptKeys::ENSEMBLE_PARAMETER))
+	{
+		if (entry.size() != 2)
+			return PrintMessage(DyssolC_ErrorArgumentsNumberUnit(StrKey(EScriptKeys::ENSEMBLE_PARAMETER)));
+		params.push_back({ entry[0], entry[1] });
+	}
+	ensemble.SetParameters(params);
+
+	// KPIs
+	std::vector<CEnsembleRunner::SKPI> kpis;
+	for (const auto& entry : _job.GetValues<std::vector<std::string>>(EScriptKeys::ENSEMBLE_KPI))
+	{
+		if (entry.size() != 3 && entry.size() != 4)
+			return PrintMessage(DyssolC_ErrorArgumentsNumberUnit(StrKey(EScriptKeys::ENSEMBLE_KPI)));
+		try
+		{
+			kpis.push_back({ entry[0], CEnsembleRunner::KPIType(entry[1]), entry[2], entry.size() == 4 ? entry[3] : "" });
+		}
+		catch (const std::invalid_argument& e)
+		{
+			return PrintMessage(DyssolC_ErrorInit(e.what()));
+		}
+	}
+	ensemble.SetKPIs(kpis);
+
+	// values of parameters
+	const auto values = _job.GetValues<std::vector<std::string>>(EScriptKeys::ENSEMBLE_VARIANT);
+	if (const std::string error = ensemble.Check(values); !error.empty())
+		return PrintMessage(DyssolC_ErrorInit(error));
+
+	// simulate
+	if (_job.HasKey(EScriptKeys::ENSEMBLE_THREADS))
+		ensemble.SetThreadsNumber(_job.GetValue<uint64_t>(EScriptKeys::ENSEMBLE_THREADS));
+	ensemble.SetProgressFunction([&](size_t, size_t _finished)
+	{
+		PrintMessage(DyssolC_EnsembleProgress(_finished, values.size()));
+	});
+	ensemble.SetConsoleFunction([this](const std::string& _message) { PrintMessage(_message); });
+	PrintMessage(DyssolC_StartEnsemble(values.size()));
+	const auto tStart = ch::steady_clock::now();
+	const auto res = ensemble.Run(values);
+	const auto tEnd = ch::steady_clock::now();
+	const auto elapsed_time = tEnd - tStart;
+	const auto elapsed_s = ch::duration_cast<ch::seconds>(elapsed_time);
+	const auto elapsed_ms = ch::duration_cast<ch::milliseconds>(elapsed_time - elapsed_s);
+	PrintMessage(DyssolC_SimFinished(elapsed_s.count(), elapsed_ms.count()));
+	for (size_t i = 0; i < res.errors.size(); ++i)
+		if (!res.errors[i].empty())
+			PrintMessage(DyssolC_ErrorEnsemble(i, res.errors[i]));
+		else
+			PrintMessage(DyssolC_EnsembleVariantTime(i, res.durations[i]));
+
+	// write results as a table: one row per variant; durations are not written, so that results of several runs can be compared
+	const auto ensembleFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::ENSEMBLE_FILE)).make_preferred();
+	PrintMessage(DyssolC_ExportEnsemble(ensembleFile.string()));
+	std::ofstream file(ensembleFile);
+	if (!file)
+		return PrintMessage(DyssolC_ErrorExportFile());
+	if (_job.HasKey(EScriptKeys::EXPORT_PRECISION))
+		file.precision(_job.GetValue<int64_t>(EScriptKeys::EXPORT_PRECISION));
+	file << "variant";
+	for (const auto& p : params)
+		file << "," << p.unit << "." << p.parameter;
+	for (const auto& n : res.names)
+		file << "," << n;
+	file << ",error" << std::endl;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		file << i + 1;
+		for (const auto& v : values[i])
+			file << "," << StringFunctions::Quote(v);
+		for (const auto& c : res.columns)
+			file << "," << c[i];
+		file << "," << StringFunctions::Quote(res.errors[i]) << std::endl;
+	}
+
+	return true;
 }
 
 // TODO: split
@@ -526,6 +663,10 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 {
 	if (!_job.HasKey(EScriptKeys::EXPORT_FILE)) return true;
 
+	if (_job.HasKey(EScriptKeys::EXPORT_FORMAT))
+		if (const auto format = static_cast<EExportFormat>(_job.GetValue<SNamedEnum>(EScriptKeys::EXPORT_FORMAT).key); format == EExportFormat::CSV || format == EExportFormat::NPY)
+			return ExportResultsColumnar(_job, format);
+
 	const auto exportFile = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred();
 	PrintMessage(DyssolC_ExportResults(exportFile.string()));
 
@@ -650,21 +791,49 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 	// export state variables
 	for (const auto& e : _job.GetValues<SExportStateVarSE>(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE))
 	{
-		// get pointer to holdup
-		const auto* variable = TryGetStateVarPtr(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE , e.unit, e.variable);
-		success &= variable != nullptr;
-		if (!variable) continue;
-		// export
-		file << "UNIT_STATE_VAR" << " " << StringFunctions::Quote(variable->GetName());
-		if (!variable->HasHistory())
-			file << " " << variable->GetValue();
-		else if (e.times.empty())
-			for (const auto& v : variable->GetHistory())
-				file << " " << v.time << " " << Filter(v.value);
-		else
-			for (const double t : e.times)
-				file << " " << t << " " << Filter(variable->GetHistoryValue(t));
-		file << std::endl;
+		// get pointer to state variable
+		CStateVariable* variable;
+		CArrayStateVariable* array;
+		std::tie(variable, array) = TryGetStateVarPtr(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE , e.unit, e.variable);
+		success &= variable != nullptr || array != nullptr;
+		if (variable)
+		{
+			// export
+			file << "UNIT_STATE_VAR" << " " << StringFunctions::Quote(variable->GetName());
+			if (!variable->HasHistory())
+				file << " " << variable->GetValue();
+			else if (e.times.empty())
+				for (const auto& v : variable->GetHistory())
+					file << " " << v.time << " " << Filter(v.value);
+			else
+				for (const double t : e.times)
+					file << " " << t << " " << Filter(variable->GetHistoryValue(t));
+			file << std::endl;
+		}
+		else if (array)
+		{
+			// export all values at each time point
+			file << "UNIT_STATE_VAR" << " " << StringFunctions::Quote(array->GetName());
+			if (!array->HasHistory())
+				for (const double v : array->GetValues())
+					file << " " << v;
+			else if (e.times.empty())
+				for (size_t i = 0; i < array->GetHistoryTimes().size(); ++i)
+				{
+					file << " " << array->GetHistoryTimes()[i];
+					const double* values = array->GetHistoryValues(i);
+					for (size_t j = 0; j < array->GetSize(); ++j)
+						file << " " << Filter(values[j]);
+				}
+			else
+				for (const double t : e.times)
+				{
+					file << " " << t;
+					for (const double v : array->GetHistoryValues(t))
+						file << " " << Filter(v);
+				}
+			file << std::endl;
+		}
 	}
 
 	// export plots
@@ -687,6 +856,312 @@ bool CScriptRunner::ExportResults(const CScriptJob& _job)
 	return success;
 }
 
+bool CScriptRunner::ExportResultsColumnar(const CScriptJob& _job, EExportFormat _format)
+{
+	const auto exportDir = fs::absolute(_job.GetValue<fs::path>(EScriptKeys::EXPORT_FILE)).make_preferred();
+	PrintMessage(DyssolC_ExportResults(exportDir.string()));
+
+	// create directory for export
+	std::error_code ec;
+	fs::create_directories(exportDir, ec);
+	if (!fs::is_directory(exportDir))
+		return PrintMessage(DyssolC_ErrorExportDir());
+
+	// setup export
+	CColumnarWriter::ENotation notation = CColumnarWriter::ENotation::SHORTEST;
+	if (_job.HasKey(EScriptKeys::EXPORT_FIXED_POINT))
+		notation = _job.GetValue<bool>(EScriptKeys::EXPORT_FIXED_POINT) ? CColumnarWriter::ENotation::FIXED : CColumnarWriter::ENotation::SCIENTIFIC;
+	else if (_job.HasKey(EScriptKeys::EXPORT_PRECISION))
+		notation = CColumnarWriter::ENotation::GENERAL;
+	const int precision = _job.HasKey(EScriptKeys::EXPORT_PRECISION) ? static_cast<int>(_job.GetValue<int64_t>(EScriptKeys::EXPORT_PRECISION)) : 6;
+	const auto writerFormat = _format == EExportFormat::NPY ? CColumnarWriter::EFormat::NPY : CColumnarWriter::EFormat::CSV;
+	const std::string extension = _format == EExportFormat::NPY ? ".npy" : ".csv";
+	const double limit = _job.HasKey(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT) ? std::abs(_job.GetValue<double>(EScriptKeys::EXPORT_SIGNIFICANCE_LIMIT)) : 0.0;
+	// replaces all values less than the limit with zeros
+	const auto Filter = [&](double v) { return limit == 0.0 ? v : std::abs(v) >= limit ? v : 0.0; };
+
+	// flowsheet settings are requested only once, not for each time point
+	const auto overalls  = m_flowsheet.GetOverallProperties();
+	const auto phases    = m_flowsheet.GetPhases();
+	const auto compounds = m_flowsheet.GetCompounds();
+
+	// flag to return
+	bool success{ true };
+
+	// names of already written files, to make each file name unique
+	std::set<std::string> usedNames;
+
+	// helper function to export a table with one row per time point; the function _fill writes all values of a row into the given pointer
+	const auto ExportTable = [&](const std::vector<std::string>& _nameParts, const std::vector<std::string>& _columns, size_t _rows, const std::function<void(size_t, double*)>& _fill)
+	{
+		// file name consisting of name parts with all special characters replaced
+		std::string name;
+		for (const auto& part : _nameParts)
+			name += (name.empty() ? "" : ".") + part;
+		for (auto& c : name)
+			if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-' && c != '_')
+				c = '_';
+		std::string unique = name;
+		for (size_t i = 2; usedNames.count(unique); ++i)
+			unique = name + "." + std::to_string(i);
+		usedNames.insert(unique);
+
+		const fs::path path = exportDir / (unique + extension);
+		CColumnarWriter writer;
+		writer.SetNotation(notation, precision);
+		bool ok = writer.Open(path, writerFormat, _columns, _rows);
+		// values are gathered and written in blocks, so that memory usage does not depend on the number of time points
+		constexpr size_t rowsPerBlock = 4096;
+		std::vector<double> buffer;
+		for (size_t iRow = 0; ok && iRow < _rows; iRow += rowsPerBlock)
+		{
+			const size_t n = std::min(rowsPerBlock, _rows - iRow);
+			buffer.resize(n * _columns.size());
+			for (size_t i = 0; i < n; ++i)
+				_fill(iRow + i, &buffer[i * _columns.size()]);
+			ok = writer.Write(buffer);
+		}
+		ok &= writer.Close();
+		if (!ok)
+			success &= PrintMessage(DyssolC_ErrorExportTable(path.string()));
+	};
+
+	// descriptor of exported data: names of value columns and a function to get all values of a stream at the given time point
+	struct SExportData
+	{
+		std::function<std::vector<std::string>(const CBaseStream*)> columns;
+		std::function<void(const CBaseStream*, double, double*)> values;
+	};
+
+	// helper function to export time-dependent values of a stream
+	const auto ExportValues = [&](const std::vector<std::string>& _nameParts, const std::vector<double>& _times, const CBaseStream* _stream, const SExportData& _data)
+	{
+		const std::vector<double> times = !_times.empty() ? _times : _stream->GetAllTimePoints();
+		std::vector<std::string> columns{ "time" };
+		for (const auto& c : _data.columns(_stream))
+			columns.push_back(c);
+		ExportTable(_nameParts, columns, times.size(), [&](size_t _row, double* _values)
+		{
+			_values[0] = times[_row];
+			std::fill(_values + 1, _values + columns.size(), 0.0); // some values may be not available, e.g. PSD without solids
+			_data.values(_stream, times[_row], _values + 1);
+			for (size_t i = 1; i < columns.size(); ++i)
+				_values[i] = Filter(_values[i]);
+		});
+	};
+
+	// helper function to export streams data
+	const auto ExportStreams = [&](const EScriptKeys& key, const std::string& tag, const SExportData& _data)
+	{
+		for (const auto& e : _job.GetValues<SExportStreamSE>(key))
+		{
+			// get pointer to stream
+			const CBaseStream* stream = TryGetStreamPtr(key, e.stream);
+			success &= stream != nullptr;
+			if (!stream) continue;
+			// export
+			ExportValues({ tag, stream->GetName() }, e.times, stream, _data);
+		}
+	};
+
+	// helper function to export holdups data
+	const auto ExportHoldups = [&](const EScriptKeys& key, const std::string& tag, const SExportData& _data)
+	{
+		for (const auto& e : _job.GetValues<SExportHoldupSE>(key))
+		{
+			// get pointer to holdup
+			auto [holdup, unit] = TryGetHoldupWorkPtr(key, e.unit, e.holdup);
+			success &= holdup != nullptr;
+			if (!holdup) continue;
+			// export
+			ExportValues({ tag, unit->GetName(), holdup->GetName() }, e.times, holdup, _data);
+		}
+	};
+
+	// helper functions to name and export specific data
+	const auto Indexed = [](const std::string& _name, size_t _number)
+	{
+		std::vector<std::string> res;
+		for (size_t i = 0; i < _number; ++i)
+			res.push_back(_name + "[" + std::to_string(i) + "]");
+		return res;
+	};
+	const SExportData ExportMass{
+		[](const CBaseStream*) { return std::vector<std::string>{ "mass" }; },
+		[](const CBaseStream* s, double t, double* v) { v[0] = s->GetMass(t); } };
+	const SExportData ExportTemperature{
+		[](const CBaseStream*) { return std::vector<std::string>{ "temperature" }; },
+		[](const CBaseStream* s, double t, double* v) { v[0] = s->GetTemperature(t); } };
+	const SExportData ExportPressure{
+		[](const CBaseStream*) { return std::vector<std::string>{ "pressure" }; },
+		[](const CBaseStream* s, double t, double* v) { v[0] = s->GetPressure(t); } };
+	const SExportData ExportOveralls{
+		[&](const CBaseStream*)
+		{
+			std::vector<std::string> res;
+			for (const auto& o : overalls)
+				res.push_back(o.name);
+			return res;
+		},
+		[&](const CBaseStream* s, double t, double* v)
+		{
+			for (const auto& o : overalls)
+				*v++ = s->GetOverallProperty(t, o.type);
+		} };
+	const SExportData ExportPhases{
+		[&](const CBaseStream*)
+		{
+			std::vector<std::string> res;
+			for (const auto& p : phases)
+				res.push_back(p.name);
+			return res;
+		},
+		[&](const CBaseStream* s, double t, double* v)
+		{
+			for (const auto& p : phases)
+				*v++ = s->GetPhaseFraction(t, p.state);
+		} };
+	const SExportData ExportCompounds{
+		[&](const CBaseStream*)
+		{
+			std::vector<std::string> res;
+			for (const auto& c : compounds)
+			{
+				const auto* compound = m_materialsDatabase.GetCompound(c);
+				res.push_back(compound ? compound->GetName() : c);
+			}
+			return res;
+		},
+		[&](const CBaseStream* s, double t, double* v)
+		{
+			for (const auto& c : compounds)
+				*v++ = s->GetCompoundFraction(t, c);
+		} };
+	const SExportData ExportPSD{
+		[&](const CBaseStream* s)
+		{
+			const bool solids = std::any_of(phases.begin(), phases.end(), [](const auto& p) { return p.state == EPhase::SOLID; });
+			return Indexed("PSD", solids && s->GetGrid().HasDimension(DISTR_SIZE) ? s->GetGrid().GetGridDimension(DISTR_SIZE)->ClassesNumber() : 0);
+		},
+		[&](const CBaseStream* s, double t, double* v)
+		{
+			for (const double d : s->GetPSD(t, PSD_MassFrac))
+				*v++ = d;
+		} };
+	const SExportData ExportDistributions{
+		[&](const CBaseStream* s)
+		{
+			std::vector<std::string> res;
+			for (const auto& d : s->GetGrid().GetDimensionsTypes())
+				for (auto& name : Indexed(Enum2Name(d), s->GetGrid().GetGridDimension(d)->ClassesNumber()))
+					res.push_back(std::move(name));
+			return res;
+		},
+		[&](const CBaseStream* s, double t, double* v)
+		{
+			for (const auto& d : s->GetGrid().GetDimensionsTypes())
+				for (const double x : s->GetDistribution(t, d))
+					*v++ = x;
+		} };
+
+	// export streams' data
+	ExportStreams(EScriptKeys::EXPORT_STREAM_MASS               , "STREAM_MASS"         , ExportMass);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_TEMPERATURE        , "STREAM_TEMPERATURE"  , ExportTemperature);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_PRESSURE           , "STREAM_PRESSURE"     , ExportPressure);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_OVERALLS           , "STREAM_OVERALLS"     , ExportOveralls);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_PHASES_FRACTIONS   , "STREAM_PHASES"       , ExportPhases);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_COMPOUNDS_FRACTIONS, "STREAM_COMPOUNDS"    , ExportCompounds);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_PSD                , "STREAM_PSD"          , ExportPSD);
+	ExportStreams(EScriptKeys::EXPORT_STREAM_DISTRIBUTIONS      , "STREAM_DISTRIBUTIONS", ExportDistributions);
+
+	// export holdups' data
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_MASS               , "HOLDUP_MASS"         , ExportMass);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_TEMPERATURE        , "HOLDUP_TEMPERATURE"  , ExportTemperature);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_PRESSURE           , "HOLDUP_PRESSURE"     , ExportPressure);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_OVERALLS           , "HOLDUP_OVERALLS"     , ExportOveralls);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_PHASES_FRACTIONS   , "HOLDUP_PHASES"       , ExportPhases);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_COMPOUNDS_FRACTIONS, "HOLDUP_COMPOUNDS"    , ExportCompounds);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_PSD                , "HOLDUP_PSD"          , ExportPSD);
+	ExportHoldups(EScriptKeys::EXPORT_HOLDUP_DISTRIBUTIONS      , "HOLDUP_DISTRIBUTIONS", ExportDistributions);
+
+	// export state variables
+	for (const auto& e : _job.GetValues<SExportStateVarSE>(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE))
+	{
+		// get pointer to state variable
+		CStateVariable* variable;
+		CArrayStateVariable* array;
+		std::tie(variable, array) = TryGetStateVarPtr(EScriptKeys::EXPORT_UNIT_STATE_VARIABLE, e.unit, e.variable);
+		success &= variable != nullptr || array != nullptr;
+		if (variable)
+		{
+			// export
+			const std::vector<std::string> name{ "UNIT_STATE_VAR", variable->GetName() };
+			if (!variable->HasHistory())
+				ExportTable(name, { "value" }, 1, [&](size_t, double* v) { v[0] = variable->GetValue(); });
+			else if (e.times.empty())
+				ExportTable(name, { "time", "value" }, variable->GetHistory().size(), [&](size_t i, double* v)
+				{
+					v[0] = variable->GetHistory()[i].time;
+					v[1] = Filter(variable->GetHistory()[i].value);
+				});
+			else
+				ExportTable(name, { "time", "value" }, e.times.size(), [&](size_t i, double* v)
+				{
+					v[0] = e.times[i];
+					v[1] = Filter(variable->GetHistoryValue(e.times[i]));
+				});
+		}
+		else if (array)
+		{
+			// export one column per element
+			const std::vector<std::string> name{ "UNIT_STATE_VAR", array->GetName() };
+			const size_t size = array->GetSize();
+			std::vector<std::string> columns{ "time" };
+			for (auto& column : Indexed("value", size))
+				columns.push_back(std::move(column));
+			if (!array->HasHistory())
+				ExportTable(name, Indexed("value", size), 1, [&](size_t, double* v)
+				{
+					std::copy(array->GetValues().begin(), array->GetValues().end(), v);
+				});
+			else if (e.times.empty())
+				ExportTable(name, columns, array->GetHistoryTimes().size(), [&](size_t i, double* v)
+				{
+					v[0] = array->GetHistoryTimes()[i];
+					const double* values = array->GetHistoryValues(i);
+					for (size_t j = 0; j < size; ++j)
+						v[j + 1] = Filter(values[j]);
+				});
+			else
+				ExportTable(name, columns, e.times.size(), [&](size_t i, double* v)
+				{
+					v[0] = e.times[i];
+					const std::vector<double> values = array->GetHistoryValues(e.times[i]);
+					for (size_t j = 0; j < values.size(); ++j)
+						v[j + 1] = Filter(values[j]);
+				});
+		}
+	}
+
+	// export plots
+	for (const auto& e : _job.GetValues<SExportPlotSE>(EScriptKeys::EXPORT_UNIT_PLOT))
+	{
+		// get pointer to curve
+		auto [plot, curve] = TryGetCurvePtr(EScriptKeys::EXPORT_UNIT_PLOT, e.unit, e.plot, e.curve);
+		success &= curve != nullptr;
+		if (!curve) continue;
+		// export
+		const auto points = curve->GetPoints();
+		ExportTable({ "UNIT_PLOT", plot->GetName(), curve->GetName() }, { plot->GetLabelX(), plot->GetLabelY() }, points.size(), [&](size_t i, double* v)
+		{
+			v[0] = points[i].x;
+			v[1] = points[i].y;
+		});
+	}
+
+	return success;
+}
+
 void CScriptRunner::Clear()
 {
 	m_flowsheet.Clear();
@@ -701,7 +1176,7 @@ CUnitContainer* CScriptRunner::TryGetUnitPtr(EScriptKeys _sk, const SNameOrIndex
 	return unit;
 }
 
-CBaseUnit* CScriptRunner::TryGetModelPtr(EScriptKeys _sk, CUnitContainer* _unit)
+CBaseUnit* CScriptRunner::TryGetModelPtr(EScriptKeys _sk, CUnitContainer* _unit) const
 {
 	auto* model = GetModelPtr(_unit);
 	if (!model && _unit) PrintMessage(DyssolC_ErrorLoadModel(StrKey(_sk), _unit->GetName()));
@@ -761,12 +1236,13 @@ CUnitPort* CScriptRunner::TryGetPortPtr(EScriptKeys _sk, const SNameOrIndex& _un
 	return port;
 }
 
-CStateVariable* CScriptRunner::TryGetStateVarPtr(EScriptKeys _sk, const SNameOrIndex& _unit, const SNameOrIndex& _var)
+std::tuple<CStateVariable*, CArrayStateVariable*> CScriptRunner::TryGetStateVarPtr(EScriptKeys _sk, const SNameOrIndex& _unit, const SNameOrIndex& _var)
 {
 	auto [model, unit] = TryGetUnitAndModelPtr(_sk, _unit);
 	auto* var = GetStateVarPtr(model, _var);
-	if (!var && model && unit) PrintMessage(DyssolC_ErrorNoStateVar(StrKey(_sk), unit->GetName(), _var.name, _var.index));
-	return var;
+	auto* arr = !var ? GetArrayStateVarPtr(model, _var) : nullptr;
+	if (!var && !arr && model && unit) PrintMessage(DyssolC_ErrorNoStateVar(StrKey(_sk), unit->GetName(), _var.name, _var.index));
+	return std::make_tuple(var, arr);
 }
 
 std::tuple<const CPlot*, const CCurve*> CScriptRunner::TryGetCurvePtr(EScriptKeys _sk, const SNameOrIndex& _unit, const SNameOrIndex& _plot, const SNameOrIndex& _curve)
@@ -858,6 +1334,16 @@ CStateVariable* CScriptRunner::GetStateVarPtr(CBaseUnit* _model, const SNameOrIn
 	return variable;														// return pointer
 }
 
+CArrayStateVariable* CScriptRunner::GetArrayStateVarPtr(CBaseUnit* _model, const SNameOrIndex& _nameOrIndex)
+{
+	if (!_model) return {};
+	auto& manager = _model->GetStateVariablesManager();										// get manager
+	auto* variable = manager.GetArrayStateVariable(_nameOrIndex.name);						// try to access by name
+	if (!variable && _nameOrIndex.index >= manager.GetStateVariablesNumber())				// try to access by index after scalar variables
+		variable = manager.GetArrayStateVariable(_nameOrIndex.index - manager.GetStateVariablesNumber());
+	return variable;																		// return pointer
+}
+
 const CPlot* CScriptRunner::GetPlotPtr(const CBaseUnit* _model, const SNameOrIndex& _nameOrIndex)
 {
 	if (!_model) return {};
@@ -888,8 +1374,19 @@ std::string CScriptRunner::GetModelKey(const std::string& _value) const
 	return {};
 }
 
-bool CScriptRunner::PrintMessage(const std::string& _message)
+bool CScriptRunner::PrintMessage(const std::string& _message) const
 {
-	std::cout << _message << std::endl;
+	// add the prefix to each line of the message
+	std::string message = m_logPrefix;
+	for (const char c : _message)
+	{
+		message += c;
+		if (c == '\n')
+			message += m_logPrefix;
+	}
+	// print the whole message at once, so that messages of several runners do not mix up
+	static std::mutex mutex;
+	std::lock_guard lock{ mutex };
+	std::cout << message << std::endl;
 	return false;
 }
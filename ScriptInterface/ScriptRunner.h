@@ -1,6 +1,7 @@
 /* Copyright (c) 2021, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #pragma once
+#include "BaseUnit.h"
 #include "Flowsheet.h"
 #include "MaterialsDatabase.h"
 #include "ModelsManager.h"
@@ -9,6 +10,7 @@
 class CBaseStream;
 class CBaseUnitParameter;
 class CScriptJob;
+enum class EExportFormat;
 namespace ScriptInterface
 {
 	enum class EScriptKeys;
@@ -22,10 +24,13 @@ class CScriptRunner
 	CModelsManager m_modelsManager{};									// Units and solvers manager.
 	CFlowsheet m_flowsheet{ &m_modelsManager, &m_materialsDatabase };	// Flowsheet.
 	CSimulator m_simulator{};											// Simulator.
+	std::string m_logPrefix{};											// Prefix of all printed messages.
 
 public:
 	// Executes the job. Returns success flag.
 	bool RunJob(const CScriptJob& _job);
+	// Sets a prefix for all printed messages, e.g. to distinguish several simultaneously running jobs.
+	void SetLogPrefix(const std::string& _prefix);
 
 private:
 	// Reads the simulation settings from the job and creates a flowsheet. Returns success flag.
@@ -64,8 +69,12 @@ private:
 	bool SaveFlowsheet(const CScriptJob& _job);
 	// Performs the simulation. Returns success flag.
 	bool RunSimulation(const CScriptJob& _job);
+	// Simulates all variants of the flowsheet defined in the job and writes their KPIs to the ensemble file. Returns success flag.
+	bool RunEnsemble(const CScriptJob& _job);
 	// Exports results from file.
 	bool ExportResults(const CScriptJob& _job);
+	// Exports results from file into a directory with one table per exported entry in CSV or NPY format.
+	bool ExportResultsColumnar(const CScriptJob& _job, EExportFormat _format);
 
 	// Clears current state of the runner.
 	void Clear();
@@ -73,7 +82,7 @@ private:
 	// Tries to obtain a pointer to a required unit. Prints error message and returns nullptr if the search fails.
 	CUnitContainer* TryGetUnitPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit);
 	// Tries to obtain a pointer to a required model. Prints error message and returns nullptr if the search fails.
-	static CBaseUnit* TryGetModelPtr(ScriptInterface::EScriptKeys _sk, CUnitContainer* _unit);
+	CBaseUnit* TryGetModelPtr(ScriptInterface::EScriptKeys _sk, CUnitContainer* _unit) const;
 	// Tries to obtain a pointer to a required model and unit. Prints error message and returns nullptr if the search fails.
 	std::tuple<CBaseUnit*, CUnitContainer*> TryGetUnitAndModelPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit);
 	// Tries to obtain a pointer to a required stream. Prints error message and returns nullptr if the search fails.
@@ -88,8 +97,8 @@ private:
 	CCompound* TryGetCompoundPtr(ScriptInterface::EScriptKeys _sk, const std::string& _compound);
 	// Tries to obtain a pointer to required port. Prints error message and returns nullptr if the search fails.
 	CUnitPort* TryGetPortPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _port);
-	// Tries to obtain a pointer to required state variable. Prints error message and returns nullptr if the search fails.
-	CStateVariable* TryGetStateVarPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _var);
+	// Tries to obtain a pointer to required scalar or array state variable. Only one of the returned pointers is set. Prints error message and returns nullptrs if the search fails.
+	std::tuple<CStateVariable*, CArrayStateVariable*> TryGetStateVarPtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _var);
 	// Tries to obtain a pointer to required curve. Prints error message and returns nullptr if the search fails.
 	std::tuple<const CPlot*, const CCurve*> TryGetCurvePtr(ScriptInterface::EScriptKeys _sk, const ScriptInterface::SNameOrIndex& _unit, const ScriptInterface::SNameOrIndex& _plot, const ScriptInterface::SNameOrIndex& _curve);
 	// Tries to obtain a unique key of a required model, trying to find it by its ID, name and file path. Prints error message and returns empty string if the search fails.
@@ -113,6 +122,8 @@ private:
 	static CUnitPort* GetPortPtr(CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
 	// Returns a pointer to a state variable by its name or index. Returns nullptr if the search fails.
 	static CStateVariable* GetStateVarPtr(CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
+	// Returns a pointer to an array state variable by its name or index, where array state variables are indexed after all scalar ones. Returns nullptr if the search fails.
+	static CArrayStateVariable* GetArrayStateVarPtr(CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
 	// Returns a pointer to a plot by its name or index. Returns nullptr if the search fails.
 	static const CPlot* GetPlotPtr(const CBaseUnit* _model, const ScriptInterface::SNameOrIndex& _nameOrIndex);
 	// Returns a pointer to a curve by its name or index. Returns nullptr if the search fails.
@@ -120,6 +131,6 @@ private:
 	// Returns a unique key of a model, trying to find it by its ID, name and file path. Returns empty string if the search fails.
 	std::string GetModelKey(const std::string& _value) const;
 
-	// Prints the message to the console and returns false.
-	static bool PrintMessage(const std::string& _message);
+	// Prints the message with the prefix to the console and returns false. Can be called from several threads.
+	bool PrintMessage(const std::string& _message) const;
 };
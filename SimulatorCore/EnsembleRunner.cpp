@@ -0,0 +1,288 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "EnsembleRunner.h"
+#include "Simulator.h"
+#include "BaseUnit.h"
+#include "DyssolStringConstants.h"
+#include "StringFunctions.h"
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace ch = std::chrono;
+
+CEnsembleRunner::CEnsembleRunner(const CFlowsheet* _base)
+	: m_base{ _base }
+{
+}
+
+void CEnsembleRunner::SetParameters(const std::vector<SParameter>& _parameters)
+{
+	m_parameters = _parameters;
+}
+
+void CEnsembleRunner::SetKPIs(const std::vector<SKPI>& _kpis)
+{
+	m_kpis = _kpis;
+}
+
+void CEnsembleRunner::SetThreadsNumber(size_t _threads)
+{
+	m_threads = _threads;
+}
+
+void CEnsembleRunner::SetProgressFunction(const ProgressFun& _fun)
+{
+	m_progress = _fun;
+}
+
+void CEnsembleRunner::SetConsoleFunction(const CSimulatorLog::ConsoleFun& _fun)
+{
+	m_console = _fun;
+}
+
+std::string CEnsembleRunner::Check(const std::vector<std::vector<std::string>>& _values) const
+{
+	for (const auto& p : m_parameters)
+	{
+		const auto* unit = m_base->GetUnitByName(p.unit);
+		if (!unit || !unit->GetModel())
+			return StrConst::Ens_ErrNoUnit(p.unit);
+		if (!unit->GetModel()->GetUnitParametersManager().GetParameter(p.parameter))
+			return StrConst::Ens_ErrNoParameter(p.unit, p.parameter);
+	}
+	for (const auto& k : m_kpis)
+	{
+		if (k.type != EKPIType::KPI_STATE_VARIABLE && k.holdup.empty())
+		{
+			if (!m_base->GetStreamByName(k.object))
+				return StrConst::Ens_ErrNoStream(k.object);
+		}
+		else if (!m_base->GetUnitByName(k.object))
+			return StrConst::Ens_ErrNoUnit(k.object);
+	}
+	for (size_t i = 0; i < _values.size(); ++i)
+		if (_values[i].size() != m_parameters.size())
+			return StrConst::Ens_ErrValuesNumber(i, _values[i].size(), m_parameters.size());
+	return {};
+}
+
+CEnsembleRunner::SResults CEnsembleRunner::Run(const std::vector<std::vector<std::string>>& _values)
+{
+	m_stop = false;
+
+	const size_t nVariants = _values.size();
+	SResults res;
+	for (const auto& k : m_kpis)
+		res.names.push_back(k.name);
+	res.columns.resize(m_kpis.size(), std::vector<double>(nVariants, std::numeric_limits<double>::quiet_NaN()));
+	res.errors.resize(nVariants);
+	res.durations.resize(nVariants, 0.0);
+
+	const std::string error = Check(_values);
+	if (!error.empty())
+	{
+		std::fill(res.errors.begin(), res.errors.end(), error);
+		return res;
+	}
+
+	// a copy without previous simulation results, so that they are not copied into each variant
+	CFlowsheet base{ *m_base };
+	base.ClearSimulationResults();
+
+	// each thread takes the next not yet simulated variant
+	std::atomic<size_t> next{ 0 };
+	std::atomic<size_t> finished{ 0 };
+	// exceptions must not leave worker threads, so the first one thrown by the progress function is rethrown after all threads are joined
+	std::exception_ptr exception;
+	std::mutex exceptionMutex;
+	const auto Worker = [&]
+	{
+		for (size_t i = next++; i < nVariants; i = next++)
+		{
+			if (m_stop)
+				res.errors[i] = StrConst::Ens_ErrStopped;
+			else
+			{
+				try
+				{
+					RunVariant(base, _values[i], i, res);
+				}
+				catch (const std::exception& e)
+				{
+					res.errors[i] = e.what();
+				}
+				catch (...)
+				{
+					res.errors[i] = StrConst::Ens_ErrUnknown;
+				}
+			}
+			const size_t done = ++finished;
+			if (!m_progress) continue;
+			try
+			{
+				m_progress(i, done);
+			}
+			catch (...)
+			{
+				std::lock_guard lock{ exceptionMutex };
+				if (!exception)
+					exception = std::current_exception();
+				m_stop = true; // skip the remaining variants
+			}
+		}
+	};
+
+	const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t nThreads = std::min(m_threads != 0 ? m_threads : hardware, nVariants);
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < nThreads; ++i)
+		threads.emplace_back(Worker);
+	Worker(); // the calling thread also simulates
+	for (auto& t : threads)
+		t.join();
+
+	if (exception)
+		std::rethrow_exception(exception);
+	return res;
+}
+
+void CEnsembleRunner::Stop()
+{
+	m_stop = true;
+	std::lock_guard lock{ m_mutex };
+	for (auto* simulator : m_simulators)
+		simulator->Stop();
+}
+
+CEnsembleRunner::EKPIType CEnsembleRunner::KPIType(const std::string& _name)
+{
+	const std::string name = StringFunctions::ToLowerCase(_name);
+	if (name == "mass")				return EKPIType::KPI_MASS;
+	if (name == "temperature")		return EKPIType::KPI_TEMPERATURE;
+	if (name == "pressure")			return EKPIType::KPI_PRESSURE;
+	if (name == "state_variable")	return EKPIType::KPI_STATE_VARIABLE;
+	throw std::invalid_argument(StrConst::Ens_ErrKPIType(_name));
+}
+
+void CEnsembleRunner::RunVariant(const CFlowsheet& _template, const std::vector<std::string>& _values, size_t _variant, SResults& _results)
+{
+	const auto tStart = ch::steady_clock::now();
+
+	// create own copy of the flowsheet
+	std::unique_ptr<CFlowsheet> flowsheet;
+	{
+		std::lock_guard lock{ m_mutex };
+		flowsheet = std::make_unique<CFlowsheet>(_template);
+	}
+
+	std::string error;
+	try
+	{
+		// set values of parameters
+		for (size_t i = 0; i < m_parameters.size(); ++i)
+		{
+			auto* param = flowsheet->GetUnitByName(m_parameters[i].unit)->GetModel()->GetUnitParametersManager().GetParameter(m_parameters[i].parameter);
+			std::stringstream ss{ _values[i] };	// create a stream with parameter values
+			param->ValueFromStream(ss);			// read unit parameter values
+		}
+
+		// simulate
+		error = flowsheet->Initialize();
+		if (error.empty())
+		{
+			CSimulator simulator;
+			simulator.SetFlowsheet(flowsheet.get());
+			simulator.SetConsoleFunction(m_console);
+			// so that Stop() also affects the simulator, which is registered but has not started yet
+			simulator.SetCurrentStatus(ESimulatorState::RUNNING);
+			{
+				std::lock_guard lock{ m_mutex };
+				m_simulators.push_back(&simulator);
+			}
+			if (!m_stop)
+			{
+				try
+				{
+					simulator.Simulate();
+				}
+				catch (const std::exception& e)
+				{
+					error = e.what();
+				}
+				catch (...)
+				{
+					error = StrConst::Ens_ErrUnknown;
+				}
+			}
+			{
+				std::lock_guard lock{ m_mutex };
+				m_simulators.erase(std::find(m_simulators.begin(), m_simulators.end(), &simulator));
+			}
+			if (error.empty() && simulator.HasError())
+				error = simulator.GetLastError();
+			if (error.empty() && m_stop)
+				error = StrConst::Ens_ErrStopped;
+		}
+
+		// gather results
+		if (error.empty())
+			for (size_t i = 0; i < m_kpis.size(); ++i)
+				_results.columns[i][_variant] = EvaluateKPI(*flowsheet, m_kpis[i]);
+	}
+	catch (const std::exception& e)
+	{
+		error = e.what();
+	}
+	catch (...)
+	{
+		error = StrConst::Ens_ErrUnknown;
+	}
+	if (!error.empty()) // KPIs may have been partially evaluated before the error
+		for (auto& column : _results.columns)
+			column[_variant] = std::numeric_limits<double>::quiet_NaN();
+	_results.errors[_variant] = error;
+
+	// remove the copy of the flowsheet
+	{
+		std::lock_guard lock{ m_mutex };
+		flowsheet.reset();
+	}
+
+	_results.durations[_variant] = ch::duration<double>(ch::steady_clock::now() - tStart).count();
+}
+
+double CEnsembleRunner::EvaluateKPI(const CFlowsheet& _flowsheet, const SKPI& _kpi)
+{
+	constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+	const double time = _kpi.time >= 0 ? _kpi.time : _flowsheet.GetParameters()->endSimulationTime;
+
+	// state variable of the unit
+	if (_kpi.type == EKPIType::KPI_STATE_VARIABLE)
+	{
+		const auto* unit = _flowsheet.GetUnitByName(_kpi.object);
+		const auto* model = unit ? unit->GetModel() : nullptr;
+		const auto* variable = model ? model->GetStateVariablesManager().GetStateVariable(_kpi.holdup) : nullptr;
+		if (!variable) return nan;
+		return _kpi.time >= 0 && !variable->GetHistory().empty() ? variable->GetHistoryValue(time) : variable->GetValue();
+	}
+
+	// flowsheet stream or unit holdup
+	const CBaseStream* stream{ nullptr };
+	if (_kpi.holdup.empty())
+		stream = _flowsheet.GetStreamByName(_kpi.object);
+	else if (const auto* unit = _flowsheet.GetUnitByName(_kpi.object); unit && unit->GetModel())
+		stream = unit->GetModel()->GetStreamsManager().GetObjectWork(_kpi.holdup);
+	if (!stream) return nan;
+	switch (_kpi.type)
+	{
+	case EKPIType::KPI_MASS:			return stream->GetMass(time);
+	case EKPIType::KPI_TEMPERATURE:		return stream->GetTemperature(time);
+	case EKPIType::KPI_PRESSURE:		return stream->GetPressure(time);
+	case EKPIType::KPI_STATE_VARIABLE:	break;
+	}
+	return nan;
+}
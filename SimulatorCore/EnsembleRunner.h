@@ -0,0 +1,149 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "Flowsheet.h"
+#include "SimulatorLog.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+class CSimulator;
+
+/*
+ * Simulates a set of variants of one flowsheet, e.g. for parameter sweeps or design-space studies.
+ * Each variant is an in-memory copy of the base flowsheet with some unit parameters overridden, so files, materials database and models are loaded only once.
+ * Variants are simulated in parallel, each on its own thread. At most as many copies of the flowsheet exist at a time as there are threads.
+ * After simulation of a variant, only the selected key performance indicators (KPI) are kept, and the copy is removed.
+ */
+class CEnsembleRunner
+{
+public:
+	/**
+	 * \brief Unit parameter, which value is overridden in each variant.
+	 * \details Parameters that change the structure of the unit (e.g. number of ports) are not supported.
+	 */
+	struct SParameter
+	{
+		std::string unit;		// Name of the unit.
+		std::string parameter;	// Name of the unit parameter.
+	};
+
+	// Types of key performance indicators.
+	enum class EKPIType
+	{
+		KPI_MASS,			// Mass flow of a stream or mass of a holdup.
+		KPI_TEMPERATURE,	// Temperature of a stream or holdup.
+		KPI_PRESSURE,		// Pressure of a stream or holdup.
+		KPI_STATE_VARIABLE,	// Value of a unit's state variable.
+	};
+
+	/**
+	 * \brief Key performance indicator evaluated after simulation of each variant.
+	 * \details For KPI_MASS, KPI_TEMPERATURE and KPI_PRESSURE: if holdup is empty, object is the name of a flowsheet stream; otherwise, it is the name of the unit with the holdup.
+	 * For KPI_STATE_VARIABLE, object is the name of the unit and holdup is the name of the state variable.
+	 */
+	struct SKPI
+	{
+		std::string name;				// Name of the KPI in results.
+		EKPIType type{ EKPIType::KPI_MASS };	// Type of the KPI.
+		std::string object;				// Name of the stream or unit.
+		std::string holdup;				// Name of the holdup or state variable of the unit.
+		double time{ -1 };				// Time point to evaluate the KPI. If negative, the end of the simulation is used.
+	};
+
+	/**
+	 * \brief Columnar table with results: one column per KPI, one row per variant.
+	 */
+	struct SResults
+	{
+		std::vector<std::string> names;				// Names of KPIs.
+		std::vector<std::vector<double>> columns;	// Values of KPIs [KPI][variant]. NaN for failed variants.
+		std::vector<std::string> errors;			// Error messages [variant]. Empty for successful variants.
+		std::vector<double> durations;				// Wall-clock time of each variant [variant], s.
+	};
+
+	// Function called after each finished variant with its index and the number of finished variants.
+	using ProgressFun = std::function<void(size_t _variant, size_t _finished)>;
+
+private:
+	const CFlowsheet* m_base{};				// Base flowsheet.
+	std::vector<SParameter> m_parameters;	// Overridden unit parameters.
+	std::vector<SKPI> m_kpis;				// KPIs to evaluate.
+	size_t m_threads{ 0 };					// Maximum number of simultaneously simulated variants. 0 for the number of hardware threads.
+	ProgressFun m_progress;					// Function to report progress.
+	CSimulatorLog::ConsoleFun m_console;	// Function to print console messages of simulators.
+	std::atomic<bool> m_stop{ false };		// Whether the run should be stopped.
+	std::mutex m_mutex;						// Guards creation of flowsheet copies and the list of running simulators.
+	std::vector<CSimulator*> m_simulators;	// Simulators of currently running variants.
+
+public:
+	/**
+	 * \brief Constructs the runner.
+	 * \details The base flowsheet must not be changed while the runner is running.
+	 * \param _base Base flowsheet.
+	 */
+	explicit CEnsembleRunner(const CFlowsheet* _base);
+
+	/**
+	 * \brief Sets unit parameters, which are overridden in each variant.
+	 * \param _parameters List of unit parameters.
+	 */
+	void SetParameters(const std::vector<SParameter>& _parameters);
+	/**
+	 * \brief Sets KPIs, which are evaluated after simulation of each variant.
+	 * \param _kpis List of KPIs.
+	 */
+	void SetKPIs(const std::vector<SKPI>& _kpis);
+	/**
+	 * \brief Sets the maximum number of simultaneously simulated variants, which also limits the number of existing flowsheet copies.
+	 * \param _threads Number of threads. 0 for the number of hardware threads.
+	 */
+	void SetThreadsNumber(size_t _threads);
+	/**
+	 * \brief Sets a function to report progress. It is called from worker threads.
+	 * \param _fun Progress function.
+	 */
+	void SetProgressFunction(const ProgressFun& _fun);
+	/**
+	 * \brief Sets a function to print console messages of all variants, such as warnings and errors. It is called from worker threads.
+	 * \param _fun Console function.
+	 */
+	void SetConsoleFunction(const CSimulatorLog::ConsoleFun& _fun);
+
+	/**
+	 * \brief Checks that all parameters and KPIs are defined in the base flowsheet and that values are given for all parameters.
+	 * \param _values Values of all overridden parameters [variant][parameter].
+	 * \return Error message or empty string.
+	 */
+	[[nodiscard]] std::string Check(const std::vector<std::vector<std::string>>& _values) const;
+	/**
+	 * \brief Simulates all variants.
+	 * \details Values of unit parameters are given as strings in the same format as in scripts.
+	 * If the check fails, no variant is simulated and all of them get the error message.
+	 * Exceptions thrown during simulation of a variant are reported as its error message.
+	 * The first exception thrown by the progress function stops the run and is rethrown after all threads have finished.
+	 * \param _values Values of all overridden parameters [variant][parameter].
+	 * \return Results table.
+	 */
+	SResults Run(const std::vector<std::vector<std::string>>& _values);
+	/**
+	 * \brief Requests to stop the run. Can be called from another thread.
+	 * \details Running variants are stopped, not yet started variants are skipped and get an error message.
+	 */
+	void Stop();
+
+	/**
+	 * \brief Converts a string to KPI type.
+	 * \param _name Name of the type: mass, temperature, pressure or state_variable.
+	 * \return KPI type. Throws std::invalid_argument if the name is unknown.
+	 */
+	static EKPIType KPIType(const std::string& _name);
+
+private:
+	// Simulates one variant and writes its KPIs into results.
+	void RunVariant(const CFlowsheet& _template, const std::vector<std::string>& _values, size_t _variant, SResults& _results);
+	// Evaluates the KPI in a simulated flowsheet.
+	static double EvaluateKPI(const CFlowsheet& _flowsheet, const SKPI& _kpi);
+};
@@ -27,12 +27,22 @@ CFlowsheet::CFlowsheet(const CFlowsheet& _other)
 	, m_cacheHoldups{ _other.m_cacheHoldups }
 	, m_tolerance{ _other.m_tolerance }
 	, m_thermodynamics{ _other.m_thermodynamics }
-	, m_units{ DeepCopy(_other.m_units) }
 	, m_streams{ DeepCopy(_other.m_streams) }
-	, m_streamsI{ DeepCopy(_other.m_streamsI) }
 	, m_calculationSequence{ _other.m_calculationSequence }
 	, m_topologyModified{ _other.m_topologyModified }
 {
+	// units refer to the structural data and settings of this flowsheet
+	m_units.reserve(_other.m_units.size());
+	for (const auto& unit : _other.m_units)
+		m_units.emplace_back(new CUnitContainer(unit->GetKey(), m_modelsManager, m_materialsDB, &m_mainGrid, &m_overall, &m_phases, &m_cacheHoldups, &m_tolerance, &m_thermodynamics))->CopyFrom(*unit);
+	// input streams either point to own main streams or are separate objects
+	m_streamsI.reserve(_other.m_streamsI.size());
+	for (const auto& stream : _other.m_streamsI)
+	{
+		const size_t index = VectorFind(_other.m_streams, stream);
+		m_streamsI.push_back(index < m_streams.size() ? m_streams[index] : std::make_shared<CStream>(*stream));
+	}
+	// synchronization states are not copied, since copied streams get new versions
 	m_calculationSequence.SetPointers(&m_units, &m_streams);
 }
 
@@ -71,6 +81,7 @@ void swap(CFlowsheet& _first, CFlowsheet& _second) noexcept
 	swap(_first.m_units              , _second.m_units);
 	swap(_first.m_streams            , _second.m_streams);
 	swap(_first.m_streamsI           , _second.m_streamsI);
+	swap(_first.m_streamsISync       , _second.m_streamsISync);
 	swap(_first.m_calculationSequence, _second.m_calculationSequence);
 	swap(_first.m_topologyModified   , _second.m_topologyModified);
 }
@@ -101,6 +112,7 @@ void CFlowsheet::Clear()
 	m_units.clear();
 	m_streams.clear();
 	m_streamsI.clear();
+	m_streamsISync.clear();
 	m_calculationSequence.Clear();
 	m_overall.clear();
 	m_phases.clear();
@@ -232,8 +244,14 @@ void CFlowsheet::PrepareInputStreams(const CUnitContainer* _unit, double _timeBe
 	{
 		auto* streamI = DoGetStream(port->GetStreamKey(), m_streamsI);
 		auto* streamO = DoGetStream(port->GetStreamKey(), m_streams);
-		if (streamI != streamO)
-			streamI->CopyFromStream(_timeBeg, _timeEnd, streamO);
+		if (streamI == streamO) continue;
+		// omit copying if nothing has changed since the last copy of the same interval
+		const auto it = m_streamsISync.find(streamI);
+		if (it != m_streamsISync.end() && it->second.timeBeg == _timeBeg && it->second.timeEnd == _timeEnd
+			&& it->second.versionO == streamO->GetDataVersion() && it->second.versionI == streamI->GetDataVersion())
+			continue;
+		streamI->CopyFromStream(_timeBeg, _timeEnd, streamO);
+		m_streamsISync[streamI] = SInputStreamSync{ streamO->GetDataVersion(), streamI->GetDataVersion(), _timeBeg, _timeEnd };
 	}
 }
 
@@ -732,6 +750,7 @@ void CFlowsheet::SetStreamsToPorts()
 
 	// create input streams with proper grids
 	m_streamsI = m_streams; // copy pointers to main (output) streams
+	m_streamsISync.clear();
 	for (const auto& unit : m_units)
 		for (const auto* port : unit->GetModel()->GetPortsManager().GetAllInputPorts())
 		{
@@ -787,6 +806,7 @@ void CFlowsheet::ClearSimulationResults()
 	for (auto& stream : m_streams)
 		stream->RemoveAllTimePoints();
 	m_streamsI.clear();
+	m_streamsISync.clear();
 	for (auto& unit : m_units)
 		if (auto* model = unit->GetModel())
 			model->ClearSimulationResults();
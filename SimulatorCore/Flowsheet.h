@@ -10,6 +10,7 @@
 #include "ParametersHolder.h"
 #include "Phase.h"
 #include "MultidimensionalGrid.h"
+#include <map>
 
 /*
  * Stores the whole information about the flowsheet.
@@ -51,6 +52,16 @@ class CFlowsheet
 
 	std::vector<std::shared_ptr<CStream>> m_streamsI;		// Input streams. Either point to streams from m_streams or to own objects.
 
+	// State of a separate input stream after the last copy from the output stream.
+	struct SInputStreamSync
+	{
+		uint64_t versionO{};	// Version of the output stream.
+		uint64_t versionI{};	// Version of the input stream.
+		double timeBeg{};		// Beginning of the copied time interval.
+		double timeEnd{};		// End of the copied time interval.
+	};
+	mutable std::map<const CStream*, SInputStreamSync> m_streamsISync;	// Last synchronization states of separate input streams, to omit copying of unchanged data.
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Topology
 	//
@@ -71,6 +82,12 @@ public:
 	 * \param _materialsDB Pointer to materials database.
 	 */
 	CFlowsheet(CModelsManager* _modelsManager, const CMaterialsDatabase* _materialsDB);
+	/**
+	 * \brief Copy constructor.
+	 * \details Creates a deep copy of the flowsheet with own instances of all models, which can be modified and simulated independently of the original.
+	 * Models manager and materials database are shared with the original.
+	 * \param _other Flowsheet to copy.
+	 */
 	CFlowsheet(const CFlowsheet& _other);
 	CFlowsheet(CFlowsheet&& _other) noexcept;
 	CFlowsheet& operator=(CFlowsheet _other);
@@ -133,7 +150,7 @@ public:
 	// Returns pointers to all defined units.
 	std::vector<CUnitContainer*> GetAllUnits();
 
-	// Copies output streams to input streams if necessary.
+	// Copies output streams to input streams if necessary. Copying is omitted if neither stream has changed since the last copy of the same time interval.
 	void PrepareInputStreams(const CUnitContainer* _unit, double _timeBeg, double _timeEnd) const;
 
 	////////////////////////////////////////////////////////////////////////////////
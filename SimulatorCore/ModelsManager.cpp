@@ -2,12 +2,18 @@
 
 #include "ModelsManager.h"
 #include "DynamicUnit.h"
+#include "AgglomerationSolver.h"
 #include "FileSystem.h"
 #include "DyssolStringConstants.h"
 #include "ContainerFunctions.h"
+#include <fstream>
+#include <iomanip>
+#include <thread>
 #ifdef _MSC_VER
+#include <process.h>
 #else
 #include <dlfcn.h>
+#include <unistd.h>
 #endif
 
 CModelsManager::SModelDir::SModelDir(std::filesystem::path _path, std::string _key, bool _active)
@@ -115,6 +121,22 @@ void CModelsManager::Clear()
 	m_availableSolvers.clear();
 }
 
+void CModelsManager::SetCacheFile(const std::filesystem::path& _file)
+{
+	m_cacheFile = _file;
+	m_cache.clear();
+	m_cacheModified = false;
+	LoadCache();
+}
+
+void CModelsManager::SetKernelCacheFile(const std::filesystem::path& _file)
+{
+	std::lock_guard lock{ m_loadedMutex };
+	m_kernelCacheFile = _file;
+	for (const auto& [solver, library] : m_loadedSolvers)
+		ApplyKernelCacheFile(solver);
+}
+
 std::vector<SUnitDescriptor> CModelsManager::GetAvailableUnits() const
 {
 	return m_availableUnits;
@@ -164,6 +186,7 @@ CBaseUnit* CModelsManager::InstantiateUnit(const std::string& _key)
 			}
 			pUnit->CreateBasicInfo();
 			// save created unit and its library
+			std::lock_guard lock{ m_loadedMutex };
 			m_loadedUnits[pUnit] = hLibrary;
 			// return instantiated unit
 			return pUnit;
@@ -195,6 +218,8 @@ CBaseSolver* CModelsManager::InstantiateSolver(const std::string& _key)
 			}
 			pSolver->CreateBasicInfo();
 			// save created solver and its library
+			std::lock_guard lock{ m_loadedMutex };
+			ApplyKernelCacheFile(pSolver);
 			m_loadedSolvers[pSolver] = hLibrary;
 			// return instantiated solver
 			return pSolver;
@@ -205,6 +230,7 @@ CBaseSolver* CModelsManager::InstantiateSolver(const std::string& _key)
 void CModelsManager::FreeUnit(CBaseUnit* _unit)
 {
 	if (!_unit) return;
+	std::lock_guard lock{ m_loadedMutex };
 	// test if such unit exists
 	if (m_loadedUnits.find(_unit) == m_loadedUnits.end()) return;
 	// copy entry
@@ -221,6 +247,7 @@ void CModelsManager::FreeUnit(CBaseUnit* _unit)
 void CModelsManager::FreeSolver(CBaseSolver* _solver)
 {
 	if (!_solver) return;
+	std::lock_guard lock{ m_loadedMutex };
 	// test if such solver exists
 	if (m_loadedSolvers.find(_solver) == m_loadedSolvers.end()) return;
 	// copy entry
@@ -234,6 +261,14 @@ void CModelsManager::FreeSolver(CBaseSolver* _solver)
 	//CloseDyssolLibrary(hLibrary);
 }
 
+void CModelsManager::ApplyKernelCacheFile(CBaseSolver* _solver) const
+{
+	// the type is checked instead of dynamic_cast, since type information may differ between libraries
+	const auto type = _solver->GetType();
+	if (type == ESolverTypes::SOLVER_AGGLOMERATION_1 || type == ESolverTypes::SOLVER_AGGLOMERATION_2)
+		static_cast<CAgglomerationSolver*>(_solver)->SetKernelCacheFile(m_kernelCacheFile);
+}
+
 std::vector<std::string> CModelsManager::AllDirsKeys() const
 {
 	std::vector<std::string> res;
@@ -285,6 +320,9 @@ void CModelsManager::UpdateAvailableModels()
 	}
 	std::sort(m_availableUnits.begin(), m_availableUnits.end());
 	std::sort(m_availableSolvers.begin(), m_availableSolvers.end());
+
+	// store descriptors of newly checked libraries
+	SaveCache();
 }
 
 std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> CModelsManager::GetModelsList(const std::filesystem::path& _dir)
@@ -306,18 +344,123 @@ std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> CModelsM
 	std::vector<SUnitDescriptor> resUnits;
 	std::vector<SSolverDescriptor> resSolvers;
 	for (const auto& f : FileSystem::FilesList(_dir, StrConst::MM_LibraryFileExtension))
+	{
+		// current state of the library file
+		std::error_code ec;
+		const uintmax_t size = std::filesystem::file_size(f, ec);
+		const int64_t time = std::filesystem::last_write_time(f, ec).time_since_epoch().count();
+		if (ec) continue;
+
+		// take descriptors from the cache if the library has not been changed
+		if (!m_cacheFile.empty())
+			if (const auto it = m_cache.find(f); it != m_cache.end() && it->second.size == size && it->second.time == time)
+			{
+				if (it->second.unit)
+					resUnits.push_back(it->second.unit);
+				else if (it->second.solver)
+					resSolvers.push_back(it->second.solver);
+				continue;
+			}
+
+		// load the library to get descriptors
 		if (const DYSSOL_LIBRARY_INSTANCE lib = LoadDyssolLibrary(f))
 		{
+			SCacheEntry entry;
+			entry.size = size;
+			entry.time = time;
 			if (const SUnitDescriptor unit = TryGetUnitDescriptor(f, lib))             // try to load unit from library
-				resUnits.push_back(unit);
+				resUnits.push_back(entry.unit = unit);
 			else if (const SSolverDescriptor solver = TryGetSolverDescriptor(f, lib)) // try to load solver from library
-				resSolvers.push_back(solver);
+				resSolvers.push_back(entry.solver = solver);
 			else
 				CloseDyssolLibrary(lib);
+			// libraries that cannot be loaded at all are not cached, since they may depend on missing files
+			if (!m_cacheFile.empty())
+			{
+				m_cache[f] = entry;
+				m_cacheModified = true;
+			}
 		}
+	}
 	return std::make_pair(resUnits, resSolvers);
 }
 
+void CModelsManager::LoadCache()
+{
+	if (m_cacheFile.empty()) return;
+	std::ifstream file{ m_cacheFile };
+	if (!file) return;
+	std::string signature;
+	file >> signature;
+	if (signature != StrConst::MM_CacheFileSignature) return;
+
+	// each line: path size time type [id name author version dynamic|solver_type]
+	std::string path;
+	while (file >> std::quoted(path))
+	{
+		SCacheEntry entry;
+		int type{};
+		file >> entry.size >> entry.time >> type;
+		SModelDescriptor descr;
+		if (type != 0)
+			file >> std::quoted(descr.uniqueID) >> std::quoted(descr.name) >> std::quoted(descr.author) >> descr.version;
+		descr.fileLocation = StringFunctions::UnifyPath(path);
+		if (type == 1)
+		{
+			static_cast<SModelDescriptor&>(entry.unit) = descr;
+			file >> entry.unit.isDynamic;
+		}
+		else if (type == 2)
+		{
+			unsigned solverType{};
+			file >> solverType;
+			static_cast<SModelDescriptor&>(entry.solver) = descr;
+			entry.solver.solverType = static_cast<ESolverTypes>(solverType);
+		}
+		if (!file) break; // broken file
+		m_cache[path] = entry;
+	}
+}
+
+void CModelsManager::SaveCache()
+{
+	if (m_cacheFile.empty() || !m_cacheModified) return;
+	std::error_code ec;
+	if (m_cacheFile.has_parent_path())
+		std::filesystem::create_directories(m_cacheFile.parent_path(), ec);
+	// write into a temporary file first, so that other processes never read a partially written cache;
+	// the file is unique for each process and thread, since several processes and managers within one process may share the same cache file
+#ifdef _MSC_VER
+	const auto pid = _getpid();
+#else
+	const auto pid = getpid();
+#endif
+	const std::filesystem::path tmpFile = m_cacheFile.string() + "." + std::to_string(pid) + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+	{
+		std::ofstream file{ tmpFile };
+		if (!file) return;
+		file << StrConst::MM_CacheFileSignature << std::endl;
+		for (const auto& [path, entry] : m_cache)
+		{
+			const int type = entry.unit ? 1 : entry.solver ? 2 : 0;
+			file << std::quoted(path.string()) << " " << entry.size << " " << entry.time << " " << type;
+			const SModelDescriptor& descr = entry.unit ? static_cast<const SModelDescriptor&>(entry.unit) : static_cast<const SModelDescriptor&>(entry.solver);
+			if (type != 0)
+				file << " " << std::quoted(descr.uniqueID) << " " << std::quoted(descr.name) << " " << std::quoted(descr.author) << " " << descr.version;
+			if (type == 1)
+				file << " " << entry.unit.isDynamic;
+			else if (type == 2)
+				file << " " << static_cast<unsigned>(entry.solver.solverType);
+			file << std::endl;
+		}
+	}
+	std::filesystem::rename(tmpFile, m_cacheFile, ec);
+	if (!ec)
+		m_cacheModified = false;
+	else
+		std::filesystem::remove(tmpFile, ec);
+}
+
 SUnitDescriptor CModelsManager::TryGetUnitDescriptor(const std::filesystem::path& _pathToUnit, DYSSOL_LIBRARY_INSTANCE _library)
 {
 	// try to get constructor
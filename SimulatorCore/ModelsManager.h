@@ -7,6 +7,7 @@
 #include "BaseSolver.h"
 #include "DyssolFilesystem.h"
 #include <map>
+#include <mutex>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -70,12 +71,28 @@ class CModelsManager
 		SModelDir(std::filesystem::path _path, std::string _key, bool _active);
 	};
 
+	/// Cached descriptor of a library, valid as long as the library file is not changed.
+	struct SCacheEntry
+	{
+		uintmax_t size{};			// Size of the library file.
+		int64_t time{};				// Last modification time of the library file.
+		SUnitDescriptor unit;		// Descriptor of the unit, if the library contains a unit.
+		SSolverDescriptor solver;	// Descriptor of the solver, if the library contains a solver.
+	};
+
 	std::vector<SModelDir> m_dirsList;                 // Directories to look for libraries with models.
 	std::vector<SUnitDescriptor> m_availableUnits;	   // List of available units.
 	std::vector<SSolverDescriptor> m_availableSolvers; // List of available solvers.
 
 	std::map<CBaseUnit*, DYSSOL_LIBRARY_INSTANCE> m_loadedUnits;		 // List of loaded units with their libraries. Used for proper resource management.
 	std::map<CBaseSolver*, DYSSOL_LIBRARY_INSTANCE> m_loadedSolvers; // List of loaded solvers with their libraries. Used for proper resource management.
+	std::mutex m_loadedMutex;										 // Guards lists of loaded models, so that several flowsheets can instantiate and free models in parallel.
+
+	std::filesystem::path m_cacheFile;						// File to store descriptors of models between runs.
+	std::map<std::filesystem::path, SCacheEntry> m_cache;	// Descriptors of all checked libraries by their paths.
+	bool m_cacheModified{ false };							// Whether the cache has been changed since it was read from the file.
+
+	std::filesystem::path m_kernelCacheFile;				// File to store tabulated kernels of agglomeration solvers between runs.
 
 public:
 	// Returns number of defined paths to look for models.
@@ -100,6 +117,12 @@ public:
 	void SetDirActivity(size_t _index, bool _active);
 	// Removes all paths and models.
 	void Clear();
+	// Sets a file to cache descriptors of models between runs, so that unchanged libraries are not loaded until a model is instantiated.
+	// Must be set before adding paths to take effect. An empty path disables caching.
+	void SetCacheFile(const std::filesystem::path& _file);
+	// Sets a file to store tabulated kernels of agglomeration solvers between runs. It is passed to all loaded and all further instantiated agglomeration solvers.
+	// Each solver library has its own cache, so only solvers from the same library share tables in memory, while the file is common. An empty path disables storing.
+	void SetKernelCacheFile(const std::filesystem::path& _file);
 
 	// Returns a list of descriptors for all available units.
 	std::vector<SUnitDescriptor> GetAvailableUnits() const;
@@ -121,6 +144,9 @@ public:
 	void FreeSolver(CBaseSolver* _solver);
 
 private:
+	// Passes the file for tabulated kernels to the solver, if it is an agglomeration solver.
+	void ApplyKernelCacheFile(CBaseSolver* _solver) const;
+
 	// Returns a vector of unique keys of all defined dirs.
 	std::vector<std::string> AllDirsKeys() const;
 
@@ -128,9 +154,14 @@ private:
 	void UpdateAvailableModels();
 
 	// Returns a list of models available in the specified directory, treating it as relative or absolute path.
-	static std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetModelsList(const std::filesystem::path& _dir);
-	// Returns a list of models available in the specified directory.
-	static std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetAllModelsInDir(const std::filesystem::path& _dir);
+	std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetModelsList(const std::filesystem::path& _dir);
+	// Returns a list of models available in the specified directory. Libraries are loaded only if they are not in the cache or have been changed.
+	std::pair<std::vector<SUnitDescriptor>, std::vector<SSolverDescriptor>> GetAllModelsInDir(const std::filesystem::path& _dir);
+
+	// Reads descriptors of models from the cache file.
+	void LoadCache();
+	// Writes descriptors of models to the cache file, if they have been changed.
+	void SaveCache();
 
 	// Tries to load unit from _library. If the model cannot be loaded, returns a structure with empty strings.
 	static SUnitDescriptor TryGetUnitDescriptor(const std::filesystem::path& _pathToUnit, DYSSOL_LIBRARY_INSTANCE _library);
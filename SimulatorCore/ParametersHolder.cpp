@@ -3,7 +3,7 @@
 #include "ParametersHolder.h"
 #include "DyssolStringConstants.h"
 
-const unsigned CParametersHolder::m_cnSaveVersion = 7;
+const unsigned CParametersHolder::m_cnSaveVersion = 8;
 
 CParametersHolder::CParametersHolder()
 {
@@ -33,6 +33,7 @@ void CParametersHolder::SetDefaultValues()
 	convergenceMethod = EConvergenceMethod::WEGSTEIN;
 	wegsteinAccelParam = DEFAULT_WEGSTEIN_ACCEL_PARAM;
 	relaxationParam = DEFAULT_RELAXATION_PARAM;
+	andersonDepth = DEFAULT_ANDERSON_DEPTH;
 
 	extrapolationMethod = EExtrapolationMethod::SPLINE;
 
@@ -87,6 +88,7 @@ void CParametersHolder::SaveToFile(CH5Handler& _h5File, const std::string& _sPat
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5ConvMethod, static_cast<uint32_t>(static_cast<EConvergenceMethod>(convergenceMethod)));
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5WegsteinParam, wegsteinAccelParam);
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5RelaxParam, relaxationParam);
+	_h5File.WriteData(_sPath, StrConst::FlPar_H5AndersonDepth, andersonDepth);
 	_h5File.WriteData(_sPath, StrConst::FlPar_H5ExtrapMethod, static_cast<uint32_t>(static_cast<EExtrapolationMethod>(extrapolationMethod)));
 
 	// save compression
@@ -149,6 +151,10 @@ void CParametersHolder::LoadFromFile(CH5Handler& _h5File, const std::string& _sP
 	convergenceMethod = static_cast<EConvergenceMethod>(nTemp);
 	_h5File.ReadData(_sPath, StrConst::FlPar_H5WegsteinParam, wegsteinAccelParam.data);
 	_h5File.ReadData(_sPath, StrConst::FlPar_H5RelaxParam, relaxationParam.data);
+	if (nVer < 8)
+		andersonDepth = DEFAULT_ANDERSON_DEPTH;
+	else
+		_h5File.ReadData(_sPath, StrConst::FlPar_H5AndersonDepth, andersonDepth.data);
 	_h5File.ReadData(_sPath, StrConst::FlPar_H5ExtrapMethod, nTemp);
 	extrapolationMethod = static_cast<EExtrapolationMethod>(nTemp);
 
@@ -290,6 +296,11 @@ void CParametersHolder::RelaxationParam(double val)
 		relaxationParam = val;
 }
 
+void CParametersHolder::AndersonDepth(uint32_t val)
+{
+	andersonDepth = val > 0 ? val : 1;
+}
+
 void CParametersHolder::ExtrapolationMethod(EExtrapolationMethod val)
 {
 	extrapolationMethod = val;
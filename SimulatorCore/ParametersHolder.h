@@ -73,6 +73,8 @@ public:
 	void WegsteinAccelParam(double val);
 	proxy<double> relaxationParam;			// relaxation parameter of Direct substitution with relaxation convergence method
 	void RelaxationParam(double val);
+	proxy<uint32_t> andersonDepth;			// number of previous iterations used by Anderson's convergence method
+	void AndersonDepth(uint32_t val);
 
 	// == Extrapolation methods
 	proxy<EExtrapolationMethod> extrapolationMethod;	// method for data extrapolation on each next time window
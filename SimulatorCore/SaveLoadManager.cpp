@@ -3,6 +3,7 @@
 #include "SaveLoadManager.h"
 #include "DyssolStringConstants.h"
 #include "Flowsheet.h"
+#include "Profiler.h"
 
 CSaveLoadManager::CSaveLoadManager(const SSaveLoadData& _data)
 	: m_data{ _data }
@@ -16,6 +17,7 @@ std::filesystem::path CSaveLoadManager::GetFileName() const
 
 bool CSaveLoadManager::SaveToFile(const std::filesystem::path& _fileName)
 {
+	PROFILE_SCOPE("Save file")
 	if (_fileName.empty()) return false;
 
 	// TODO: m_parameters.fileSingleFlag
@@ -45,6 +47,7 @@ bool CSaveLoadManager::SaveToFile(const std::filesystem::path& _fileName)
 
 bool CSaveLoadManager::LoadFromFile(const std::filesystem::path& _fileName)
 {
+	PROFILE_SCOPE("Load file")
 	if (_fileName.empty()) return false;
 
 	m_fileHandler.Open(_fileName);
@@ -10,6 +10,44 @@
 #include "DyssolStringConstants.h"
 #include "ContainerFunctions.h"
 #include "DyssolUtilities.h"
+#include "Profiler.h"
+#include "DenseKernels.h"
+#include "ThreadPool.h"
+
+namespace
+{
+	// Solves a small dense system of linear equations _A * x = _b with Gaussian elimination and partial pivoting. Returns an empty vector if the matrix is singular.
+	std::vector<double> SolveLinearSystem(std::vector<std::vector<double>> _A, std::vector<double> _b)
+	{
+		const size_t n = _b.size();
+		for (size_t k = 0; k < n; ++k)
+		{
+			size_t pivot = k;
+			for (size_t i = k + 1; i < n; ++i)
+				if (std::fabs(_A[i][k]) > std::fabs(_A[pivot][k]))
+					pivot = i;
+			if (_A[pivot][k] == 0. || !std::isfinite(_A[pivot][k])) return {};
+			std::swap(_A[k], _A[pivot]);
+			std::swap(_b[k], _b[pivot]);
+			for (size_t i = k + 1; i < n; ++i)
+			{
+				const double factor = _A[i][k] / _A[k][k];
+				for (size_t j = k; j < n; ++j)
+					_A[i][j] -= factor * _A[k][j];
+				_b[i] -= factor * _b[k];
+			}
+		}
+		std::vector<double> x(n);
+		for (size_t k = n; k-- > 0;)
+		{
+			double sum = _b[k];
+			for (size_t j = k + 1; j < n; ++j)
+				sum -= _A[k][j] * x[j];
+			x[k] = sum / _A[k][k];
+		}
+		return x;
+	}
+}
 
 CSimulator::CSimulator()
 {
@@ -27,6 +65,11 @@ void CSimulator::SetFlowsheet(CFlowsheet* _pFlowsheet)
 	m_hasError = false;
 }
 
+void CSimulator::SetConsoleFunction(const CSimulatorLog::ConsoleFun& _fun)
+{
+	m_log.SetConsoleFunction(_fun);
+}
+
 void CSimulator::SetCurrentStatus(ESimulatorState _nStatus)
 {
 	m_nCurrentStatus = _nStatus;
@@ -42,6 +85,34 @@ bool CSimulator::HasError() const
 	return m_hasError;
 }
 
+std::string CSimulator::GetLastError() const
+{
+	return m_lastError;
+}
+
+CSimulator::SProgress CSimulator::GetProgress() const
+{
+	std::lock_guard lock{ m_progressMutex };
+	SProgress progress = m_progress;
+	progress.time = m_simulatedTime.load(std::memory_order_relaxed);
+	return progress;
+}
+
+bool CSimulator::ReadLogEvent(CSimulatorLog::SEvent& _event)
+{
+	return m_log.Read(_event);
+}
+
+void CSimulator::ClearLogEvents()
+{
+	m_log.Clear();
+}
+
+size_t CSimulator::DroppedLogEventsNumber() const
+{
+	return m_log.DroppedNumber();
+}
+
 CSimulator::SPartitionStatus CSimulator::GetCurrentPartitionStatus() const
 {
 	if (m_iCurrentPartition >= m_partitionsStatus.size()) return {};
@@ -50,8 +121,17 @@ CSimulator::SPartitionStatus CSimulator::GetCurrentPartitionStatus() const
 
 void CSimulator::Simulate()
 {
-	m_nCurrentStatus = ESimulatorState::RUNNING;
+	PROFILE_SCOPE("Simulation")
+
+	// the status may have been set to running in advance, so that a stop requested before the start is not lost
+	auto expected = ESimulatorState::IDLE;
+	if (!m_nCurrentStatus.compare_exchange_strong(expected, ESimulatorState::RUNNING) && expected == ESimulatorState::TO_BE_STOPPED)
+	{
+		m_nCurrentStatus = ESimulatorState::IDLE;
+		return;
+	}
 	m_hasError = false;
+	m_lastError.clear();
 
 	// Prepare
 	SetupConvergenceMethod();
@@ -66,8 +146,8 @@ void CSimulator::Simulate()
 		for (const auto& model : partition.models)
 			m_vInitialized[model->GetKey()] = false;
 
-	// run logger updater
-	m_logUpdater.Run();
+	// pass messages of units directly to the log
+	RedirectUnitsMessages(true);
 
 	// set initial values to tear streams
 	m_pFlowsheet->GetCalculationSequence()->CopyInitToTearStreams(m_pParams->initTimeWindow);
@@ -88,6 +168,7 @@ void CSimulator::Simulate()
 		// Finalize all units within partition
 		for (auto& model : partitions[iPart].models)
 		{
+			PROFILE_SCOPE(model->GetName())
 			m_log.WriteInfo(StrConst::Sim_InfoUnitFinalization(model->GetName(), model->GetModel()->GetUnitName()));
 			model->GetModel()->DoFinalizeUnit();
 		}
@@ -110,15 +191,15 @@ void CSimulator::Simulate()
 
 	m_log.WriteInfo("");
 
-	// stop logger updater
-	m_logUpdater.Stop();
+	RedirectUnitsMessages(false);
 	m_nCurrentStatus = ESimulatorState::IDLE;
 }
 
 void CSimulator::Stop()
 {
-	if (GetCurrentStatus() != ESimulatorState::IDLE)
-		SetCurrentStatus(ESimulatorState::TO_BE_STOPPED);
+	// only a running simulation can be stopped, to not interfere with its finalization in another thread
+	auto expected = ESimulatorState::RUNNING;
+	m_nCurrentStatus.compare_exchange_strong(expected, ESimulatorState::TO_BE_STOPPED);
 }
 
 void CSimulator::InitializePartitionsStatus()
@@ -210,6 +291,7 @@ void CSimulator::SimulateUnitsWithRecycles(size_t _iPartition, const CCalculatio
 				for (auto& stream : vRecycles)					stream->RemoveAllTimePoints();			// clear recycle streams
 				for (auto& stream : partVars.vRecyclesPrev)		stream->RemoveAllTimePoints();			// clear previous state of recycles
 				for (auto& stream : partVars.vRecyclesPrevPrev)	stream->RemoveAllTimePoints();			// clear pre-previous state of recycles
+				partVars.andersonHistory = SAndersonHistory{};									// clear history of iterations
 				for (auto& stream : vRecycles)													// make sure, there is at least one time point in the stream
 					if (stream->GetAllTimePoints().empty())
 						stream->AddTimePoint(0.0);
@@ -221,7 +303,7 @@ void CSimulator::SimulateUnitsWithRecycles(size_t _iPartition, const CCalculatio
 
 			// apply chosen convergence method
 			if (partVars.iTWIterationFull > 2)
-				ApplyConvergenceMethod(vRecycles, partVars.vRecyclesPrev, partVars.vRecyclesPrevPrev, partVars.dTWStart, partVars.dTWEnd);
+				ApplyConvergenceMethod(vRecycles, partVars.vRecyclesPrev, partVars.vRecyclesPrevPrev, partVars.dTWStart, partVars.dTWEnd, partVars.andersonHistory);
 
 			// reduce time window if necessary
 			if (((partVars.dTWStart == 0) && (partVars.iTWIterationCurr > m_pParams->iters1stUpperLimit)) ||	// for the first window
@@ -259,6 +341,7 @@ void CSimulator::SimulateUnitsWithRecycles(size_t _iPartition, const CCalculatio
 			partVars.iTWIterationCurr = 0;
 			partVars.iTWIterationFull = 0;
 			partVars.iWindowNumber++;
+			partVars.andersonHistory = SAndersonHistory{};
 			partVars.dTWStartPrev = partVars.dTWStart;
 			partVars.dTWStart = partVars.dTWEnd;
 			partVars.dTWEnd = std::min(partVars.dTWEnd + partVars.dTWLength, _t2);
@@ -280,9 +363,25 @@ void CSimulator::SimulateUnits(const CCalculationSequence::SPartition& _partitio
 	{
 		// current model
 		m_unitName = model->GetName();
+		PROFILE_SCOPE(m_unitName)
+		{
+			std::lock_guard lock{ m_progressMutex };
+			m_progress.unitName = m_unitName;
+			m_progress.iPartition = m_iCurrentPartition;
+			m_progress.partitionsNumber = m_partitionsStatus.size();
+			m_progress.dTWStart = _t1;
+			m_progress.dTWEnd = _t2;
+			m_progress.iWindowNumber = m_partitionsStatus[m_iCurrentPartition].iWindowNumber;
+			m_progress.iIteration = m_partitionsStatus[m_iCurrentPartition].iTWIterationFull;
+			m_progress.time = m_simulatedTime.load(std::memory_order_relaxed);
+			m_log.WriteProgress(m_progress);
+		}
 
 		// copy output streams to input streams and convert grids if necessary
-		m_pFlowsheet->PrepareInputStreams(model, _t1, _t2);
+		{
+			PROFILE_SCOPE("Prepare input streams")
+			m_pFlowsheet->PrepareInputStreams(model, _t1, _t2);
+		}
 
 		// initialize unit if not yet initialized
 		if (!m_vInitialized[model->GetKey()])
@@ -330,10 +429,9 @@ void CSimulator::SimulateUnits(const CCalculationSequence::SPartition& _partitio
 
 void CSimulator::SimulateUnit(CUnitContainer& _unit, double _t1, double _t2 /*= -1*/)
 {
+	PROFILE_SCOPE("Simulate")
 	auto* model = _unit.GetModel();
 
-	m_logUpdater.SetModel(model);
-
 	// simulate
 	try {
 		if(dynamic_cast<CDynamicUnit*>(model))
@@ -345,7 +443,7 @@ void CSimulator::SimulateUnit(CUnitContainer& _unit, double _t1, double _t2 /*=
 		RaiseError(e.what());
 	}
 
-	m_logUpdater.ReleaseModel();
+	m_simulatedTime.store(_t2 < 0 ? _t1 : _t2, std::memory_order_relaxed);
 
 	// check for errors
 	if (model->HasError())
@@ -358,14 +456,12 @@ void CSimulator::InitializeUnit(CUnitContainer& _unit, double _t)
 
 	// write log
 	m_log.WriteInfo(StrConst::Sim_InfoUnitInitialization(m_unitName, model->GetUnitName()));
-	//CLogUpdater logUpdater{ &m_log, model };
 	try {
 		model->DoInitializeUnit();
 	}
 	catch (const std::logic_error& e) {
 		RaiseError(e.what());
 	}
-	//logUpdater.Release();
 
 	if (model->HasError())
 		RaiseError(model->GetErrorMessage());
@@ -378,6 +474,7 @@ void CSimulator::InitializeUnit(CUnitContainer& _unit, double _t)
 
 bool CSimulator::CheckConvergence(const std::vector<CStream*>& _vStreams1, const std::vector<CStream*>& _vStreams2, double _t1, double _t2) const
 {
+	PROFILE_SCOPE("Check convergence")
 	for (size_t i = 0; i < _vStreams1.size(); ++i)
 	{
 		if (!CompareStreams(*_vStreams1[i], *_vStreams2[i], _t1, _t2))
@@ -409,6 +506,7 @@ bool CSimulator::CompareStreams(const CStream& _str1, const CStream& _str2, doub
 void CSimulator::RaiseError(const std::string& _sError)
 {
 	m_log.WriteError(_sError);
+	m_lastError = _sError;
 	m_nCurrentStatus = ESimulatorState::TO_BE_STOPPED;
 	m_hasError = true;
 }
@@ -416,11 +514,39 @@ void CSimulator::RaiseError(const std::string& _sError)
 void CSimulator::ClearLogState()
 {
 	m_unitName.clear();
-	m_log.Clear();
+	{
+		std::lock_guard lock{ m_progressMutex };
+		m_progress = SProgress{};
+	}
+	m_simulatedTime = 0;
+}
+
+void CSimulator::RedirectUnitsMessages(bool _redirect)
+{
+	for (const auto& partition : m_pSequence->Partitions())
+		for (const auto& unit : partition.models)
+		{
+			CBaseUnit* model = unit->GetModel();
+			if (!_redirect)
+			{
+				model->SetMessageHandler({});
+				continue;
+			}
+			// messages generated before the simulation
+			if (model->HasWarning())	m_log.WriteWarning(model->PopWarningMessage());
+			if (model->HasInfo())		m_log.WriteInfo(model->PopInfoMessage());
+			// while a unit is running, the simulator does not write to the log, so the log always has a single writer
+			model->SetMessageHandler([this](CBaseUnit::EMessageType _type, const std::string& _message)
+			{
+				if (_type == CBaseUnit::EMessageType::WARNING)	m_log.WriteWarning(_message);
+				else											m_log.WriteInfo(_message);
+			});
+		}
 }
 
 void CSimulator::ApplyExtrapolationMethod(const std::vector<CStream*>& _streams, double _t1, double _t2, double _tExtra) const
 {
+	PROFILE_SCOPE("Extrapolation")
 	switch (static_cast<EExtrapolationMethod>(m_pParams->extrapolationMethod))
 	{
 	case EExtrapolationMethod::LINEAR:	for (auto& str : _streams) str->Extrapolate(_tExtra, _t1, _t2);						break;
@@ -434,55 +560,70 @@ void CSimulator::SetupConvergenceMethod()
 	m_bSteffensenTrigger = true;
 }
 
-void CSimulator::ApplyConvergenceMethod(const std::vector<CStream*>& _s3, std::vector<CStream*>& _s2, std::vector<CStream*>& _s1, double _t1, double _t2)
+void CSimulator::ApplyConvergenceMethod(const std::vector<CStream*>& _s3, std::vector<CStream*>& _s2, std::vector<CStream*>& _s1, double _t1, double _t2, SAndersonHistory& _history)
 {
-	if (static_cast<EConvergenceMethod>(m_pParams->convergenceMethod) == EConvergenceMethod::DIRECT_SUBSTITUTION && m_pParams->relaxationParam == 1.)
+	PROFILE_SCOPE("Convergence method")
+	const auto method = static_cast<EConvergenceMethod>(m_pParams->convergenceMethod);
+	if (method == EConvergenceMethod::DIRECT_SUBSTITUTION && m_pParams->relaxationParam == 1.)
 		return;
-	if (static_cast<EConvergenceMethod>(m_pParams->convergenceMethod) == EConvergenceMethod::STEFFENSEN)
+	if (method == EConvergenceMethod::STEFFENSEN)
 	{
 		m_bSteffensenTrigger = !m_bSteffensenTrigger;
 		if (m_bSteffensenTrigger)
 			return;
 	}
 
-	for (size_t i = 0; i < _s3.size(); ++i)
-		for (auto time : _s3[i]->GetTimePoints(_t1, _t2))
-		{
-			// TODO: go over all defined properties
-			_s3[i]->SetOverallProperty(time, EOverall::OVERALL_MASS, PredictValues(_s3[i]->GetOverallProperty(time, EOverall::OVERALL_MASS), _s2[i]->GetOverallProperty(time, EOverall::OVERALL_MASS), _s1[i]->GetOverallProperty(time, EOverall::OVERALL_MASS)));
-			_s3[i]->SetOverallProperty(time, EOverall::OVERALL_TEMPERATURE, PredictValues(_s3[i]->GetOverallProperty(time, EOverall::OVERALL_TEMPERATURE), _s2[i]->GetOverallProperty(time, EOverall::OVERALL_TEMPERATURE), _s1[i]->GetOverallProperty(time, EOverall::OVERALL_TEMPERATURE)));
-			_s3[i]->SetOverallProperty(time, EOverall::OVERALL_PRESSURE, PredictValues(_s3[i]->GetOverallProperty(time, EOverall::OVERALL_PRESSURE), _s2[i]->GetOverallProperty(time, EOverall::OVERALL_PRESSURE), _s1[i]->GetOverallProperty(time, EOverall::OVERALL_PRESSURE)));
-			for (const auto& phase : m_pFlowsheet->GetPhases())
-			{
-				_s3[i]->SetPhaseFraction(time, phase.state, PredictValues(_s3[i]->GetPhaseFraction(time, phase.state), _s2[i]->GetPhaseFraction(time, phase.state), _s1[i]->GetPhaseFraction(time, phase.state)));
-				if (phase.state == EPhase::SOLID) // all distributed parameters
-					_s3[i]->SetDistribution(time, PredictValues(_s3[i]->GetDistribution(time, _s3[i]->GetGrid().GetDimensionsTypes()), _s2[i]->GetDistribution(time, _s2[i]->GetGrid().GetDimensionsTypes()), _s1[i]->GetDistribution(time, _s1[i]->GetGrid().GetDimensionsTypes())));
-				else				// only distribution by compounds
-					_s3[i]->SetCompoundsFractions(time, phase.state, PredictValues(_s3[i]->GetCompoundsFractions(time, phase.state), _s2[i]->GetCompoundsFractions(time, phase.state), _s1[i]->GetCompoundsFractions(time, phase.state)));
-			}
-		}
-}
-
-double CSimulator::PredictValues(double _d3, double _d2, double _d1) const
-{
-	double res;
-	PredictValues(1, &_d3, &_d2, &_d1, &res);
-	return res;
+	// layout of packed data of all streams
+	const size_t count = _s3.size();
+	std::vector<std::vector<double>> times(count);
+	std::vector<size_t> offsets(count + 1, 0);
+	for (size_t i = 0; i < count; ++i)
+	{
+		times[i] = _s3[i]->GetTimePoints(_t1, _t2);
+		offsets[i + 1] = offsets[i] + times[i].size() * _s3[i]->GetPackedDataSize();
+	}
+	const size_t len = offsets.back();
+	if (len == 0) return;
 
-}
+	// gather all data of all streams on all time points into contiguous arrays
+	std::vector<double> v3(len), v2(len), v1(len);
+	const auto Gather = [&](const CStream* _stream, size_t _i, std::vector<double>& _dst)
+	{
+		const auto data = _stream->GetPackedData(times[_i]);
+		std::copy_n(data.begin(), std::min(data.size(), offsets[_i + 1] - offsets[_i]), _dst.begin() + offsets[_i]);
+	};
+	ParallelFor(count, [&](size_t i)
+	{
+		Gather(_s3[i], i, v3);
+		Gather(_s2[i], i, v2);
+		if (method != EConvergenceMethod::ANDERSON)
+			Gather(_s1[i], i, v1);
+	});
 
-std::vector<double> CSimulator::PredictValues(const std::vector<double>& _v3, const std::vector<double>& _v2, const std::vector<double>& _v1) const
-{
-	std::vector<double> res(_v3.size());
-	PredictValues(_v3.size(), _v3.data(), _v2.data(), _v1.data(), res.data());
-	return res;
-}
+	// calculate new values for all streams at once
+	std::vector<double> res(len);
+	if (method == EConvergenceMethod::ANDERSON)
+	{
+		if (_history.times != times || _history.values.empty() || _history.values.front().size() != len)
+		{
+			// new time window or new structure of streams: start a new history, using the previous iteration if it is available
+			_history = SAndersonHistory{ times };
+			ParallelFor(count, [&](size_t i) { Gather(_s1[i], i, v1); });
+			std::vector<double> residual(len);
+			DenseKernels::Mix(len, 1., v2.data(), -1., v1.data(), residual.data());
+			_history.values.push_back(v2);
+			_history.residuals.push_back(std::move(residual));
+		}
+		PredictAnderson(v3, v2, _history, res.data());
+	}
+	else
+		PredictValues(len, v3.data(), v2.data(), v1.data(), res.data());
 
-CDenseMDMatrix CSimulator::PredictValues(const CDenseMDMatrix& _m3, const CDenseMDMatrix& _m2, const CDenseMDMatrix& _m1) const
-{
-	CDenseMDMatrix res(_m3.GetDimensions(), _m3.GetClasses());
-	PredictValues(_m3.GetDataLength(), _m3.GetDataPtr(), _m2.GetDataPtr(), _m1.GetDataPtr(), res.GetDataPtr());
-	return res;
+	// scatter new values back to streams
+	ParallelFor(count, [&](size_t i)
+	{
+		_s3[i]->SetPackedData(times[i], std::vector<double>(res.begin() + offsets[i], res.begin() + offsets[i + 1]));
+	});
 }
 
 void CSimulator::PredictValues(size_t _len, const double* _v3, const double* _v2, const double* _v1, double* _res) const
@@ -490,48 +631,85 @@ void CSimulator::PredictValues(size_t _len, const double* _v3, const double* _v2
 	switch (static_cast<EConvergenceMethod>(m_pParams->convergenceMethod))
 	{
 	case EConvergenceMethod::DIRECT_SUBSTITUTION:
-		for (size_t i = 0; i < _len; ++i)
-			_res[i] = PredictRelaxation(_v3[i], _v2[i]);
+		DenseKernels::Mix(_len, m_pParams->relaxationParam, _v3, 1 - m_pParams->relaxationParam, _v2, _res);
 		break;
 	case EConvergenceMethod::WEGSTEIN:
-		for (size_t i = 0; i < _len; ++i)
-			_res[i] = PredictWegstein(_v3[i], _v2[i], _v2[i], _v1[i]);
+		DenseKernels::Wegstein(_len, _v3, _v2, _v2, _v1, -5, m_pParams->wegsteinAccelParam, m_pParams->absTol, m_pParams->relTol, _res);
 		break;
 	case EConvergenceMethod::STEFFENSEN:
-		for (size_t i = 0; i < _len; ++i)
-			_res[i] = PredictSteffensen(_v3[i], _v2[i], _v1[i]);
+		DenseKernels::Steffensen(_len, _v3, _v2, _v1, m_pParams->absTol, m_pParams->relTol, _res);
+		break;
+	case EConvergenceMethod::ANDERSON:
+		std::copy_n(_v3, _len, _res);
 		break;
 	}
 }
 
-double CSimulator::PredictRelaxation(double F2, double F1) const
+void CSimulator::PredictAnderson(const std::vector<double>& _v3, const std::vector<double>& _v2, SAndersonHistory& _history, double* _res) const
 {
-	return (1 - m_pParams->relaxationParam)*F1 + m_pParams->relaxationParam*F2;
-}
+	const size_t len = _v3.size();
+
+	// add the last iteration to the history
+	std::vector<double> residual(len);
+	DenseKernels::Mix(len, 1., _v3.data(), -1., _v2.data(), residual.data());
+	_history.values.push_back(_v3);
+	_history.residuals.push_back(std::move(residual));
+	while (_history.values.size() > static_cast<size_t>(m_pParams->andersonDepth) + 1)
+	{
+		_history.values.pop_front();
+		_history.residuals.pop_front();
+	}
 
-double CSimulator::PredictWegstein(double F2, double F1, double X2, double X1) const
-{
-	if (std::fabs(X2 - X1) <= (std::fabs(X2)*m_pParams->relTol + m_pParams->absTol))
-		return F2;
-	const double s = ( F2 - F1 ) / ( X2 - X1 );
-	double q = s / ( s - 1 );
-	if (q < -5)
-		q = -5;
-	else if (q > m_pParams->wegsteinAccelParam)
-		q = m_pParams->wegsteinAccelParam;
-	return q*X2 + (1 - q)*F2;
-}
+	const auto& g = _history.values;
+	const auto& f = _history.residuals;
+	const size_t m = g.size() - 1;
+	std::copy_n(g.back().data(), len, _res);
+	if (m == 0) return;
 
-double CSimulator::PredictSteffensen(double F3, double F2, double F1) const
-{
-	const double tmp = F3 - 2 * F2 + F1;
-	if (std::fabs(tmp) <= (std::fabs(tmp)*m_pParams->relTol + m_pParams->absTol))
-		return F3;
-	return F1 - std::pow((F2 - F1), 2.) / tmp;
+	// weights scale residuals of all values with their tolerances, so that properties with different units are comparable
+	std::vector<double> weights(len);
+	for (size_t i = 0; i < len; ++i)
+	{
+		const double scale = std::fabs(_v3[i]) * m_pParams->relTol + m_pParams->absTol;
+		weights[i] = 1. / (scale * scale);
+	}
+
+	// differences of residuals between consecutive iterations
+	std::vector<std::vector<double>> df(m, std::vector<double>(len));
+	for (size_t j = 0; j < m; ++j)
+		DenseKernels::Mix(len, 1., f[j + 1].data(), -1., f[j].data(), df[j].data());
+
+	// least squares problem min|f_k - dF * gamma| in the form of normal equations
+	std::vector<std::vector<double>> A(m, std::vector<double>(m));
+	std::vector<double> b(m);
+	for (size_t j = 0; j < m; ++j)
+	{
+		for (size_t l = j; l < m; ++l)
+			A[j][l] = A[l][j] = DenseKernels::Dot(len, df[j].data(), df[l].data(), weights.data());
+		b[j] = DenseKernels::Dot(len, df[j].data(), f.back().data(), weights.data());
+	}
+	// regularization to keep the system solvable if differences are nearly linearly dependent
+	double trace = 0;
+	for (size_t j = 0; j < m; ++j)
+		trace += A[j][j];
+	if (trace == 0. || !std::isfinite(trace)) return;
+	for (size_t j = 0; j < m; ++j)
+		A[j][j] += trace * 1e-12;
+
+	const std::vector<double> gamma = SolveLinearSystem(A, b);
+	if (gamma.empty()) return;
+
+	// new values: g_k - sum(gamma_j * (g_{j+1} - g_j))
+	for (size_t j = 0; j < m; ++j)
+	{
+		DenseKernels::Axpy(len, -gamma[j], g[j + 1].data(), _res);
+		DenseKernels::Axpy(len, gamma[j], g[j].data(), _res);
+	}
 }
 
 void CSimulator::ReduceData(const CCalculationSequence::SPartition& _partition, double _t1, double _t2) const
 {
+	PROFILE_SCOPE("Reduce data")
 	if (m_pParams->saveTimeStep > 0.)
 	{
 		const double dStart = std::max(std::min(_t1, _t2 - 2 * m_pParams->saveTimeStep), 0.0);
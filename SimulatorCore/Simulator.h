@@ -5,8 +5,10 @@
 #include "SimulatorLog.h"
 #include "CalculationSequence.h"
 #include "DenseMDMatrix.h"
-#include "LogUpdater.h"
+#include <deque>
 #include <map>
+#include <atomic>
+#include <mutex>
 
 class CFlowsheet;
 class CParametersHolder;
@@ -24,7 +26,19 @@ class CSimulator
 {
 	friend class CSimulatorTab;
 
+public:
+	// Thread-safe snapshot of the simulation progress.
+	using SProgress = SSimulationProgress;
+
 private:
+	// Values and residuals of tear streams from previous iterations on the current time window, used by Anderson's convergence method.
+	struct SAndersonHistory
+	{
+		std::vector<std::vector<double>> times{};	// Time points of each tear stream, for which the history was collected.
+		std::deque<std::vector<double>> values{};	// Packed data of all tear streams after each iteration.
+		std::deque<std::vector<double>> residuals{};	// Differences between packed data after and before each iteration.
+	};
+
 	struct SPartitionStatus
 	{
 		double dTWStart{ 0 };				// Current time window start.
@@ -38,31 +52,37 @@ private:
 
 		std::vector<CStream*> vRecyclesPrev{};			// previous state of recycles
 		std::vector<CStream*> vRecyclesPrevPrev{};		// pre-previous state of recycles
+		SAndersonHistory andersonHistory{};				// history of iterations for Anderson's convergence method
 	};
 
 	CFlowsheet* m_pFlowsheet;
 	const CCalculationSequence* m_pSequence; // Calculation sequence.
 	CParametersHolder* m_pParams;
-	ESimulatorState m_nCurrentStatus;
+	std::atomic<ESimulatorState> m_nCurrentStatus;	// Current status, may be changed from another thread to stop the simulation.
 	std::map<std::string, bool> m_vInitialized;
 
 	/// Data for logging
 	CSimulatorLog m_log;				// Log itself.
-	CLogUpdater m_logUpdater{ &m_log };	// Log updater.
 	// TODO: join m_partitionsStatus, m_iCurrentPartition, m_unitName into a simulation status variable
 	std::vector<SPartitionStatus> m_partitionsStatus{};
 	size_t m_iCurrentPartition{};
 	std::string m_unitName;				// Name of the currently calculated unit.
+	SProgress m_progress;				// Progress of the simulation, available from other threads.
+	mutable std::mutex m_progressMutex;	// Guards access to m_progress.
+	std::atomic<double> m_simulatedTime{ 0 };	// The last simulated time point, updated after each call of a unit.
 
 	//// parameters of convergence methods
 	bool m_bSteffensenTrigger;
-	bool m_hasError{ false }; // Current simulation finished with error.
+	std::atomic<bool> m_hasError{ false }; // Current simulation finished with error.
+	std::string m_lastError;			// Text of the last error of the current simulation.
 
 public:
 	CSimulator();
 
 	/// Sets pointer to a flowsheet.
 	void SetFlowsheet(CFlowsheet* _pFlowsheet);
+	/// Sets a function to print important messages of the simulation, such as warnings and errors, to a console. If not set, they are only written to the log.
+	void SetConsoleFunction(const CSimulatorLog::ConsoleFun& _fun);
 
 	// Change status of simulator.
 	void SetCurrentStatus(ESimulatorState _nStatus);
@@ -73,14 +93,39 @@ public:
 	 * \return Whether current simulation finished with error.
 	 */
 	[[nodiscard]] bool HasError() const;
+	/**
+	 * Returns the text of the last error of the current simulation. Must not be called while simulation is running.
+	 * \return Error message or empty string if no error occurred.
+	 */
+	[[nodiscard]] std::string GetLastError() const;
+	/**
+	 * Returns progress of the current simulation. Can be called from another thread while simulation is running.
+	 * \return Progress of the current simulation.
+	 */
+	[[nodiscard]] SProgress GetProgress() const;
+	/**
+	 * Moves the oldest unread event of the simulation log into _event. Can be called from one other thread while simulation is running.
+	 * \param _event Read event.
+	 * \return Whether an event was read.
+	 */
+	bool ReadLogEvent(CSimulatorLog::SEvent& _event);
+	/**
+	 * Removes all unread events of the simulation log. Must be called from the thread, which reads the events.
+	 */
+	void ClearLogEvents();
+	/**
+	 * Returns the number of messages of the simulation log, which were dropped because they had not been read in time. Can be called from another thread while simulation is running.
+	 * \return Number of dropped messages.
+	 */
+	[[nodiscard]] size_t DroppedLogEventsNumber() const;
 
 	// Returns information about currently calculated partition.
 	SPartitionStatus GetCurrentPartitionStatus() const;
 
-	/// Perform simulation.
+	/// Perform simulation. Returns at once, if the status was set to RUNNING in advance and the simulation has been stopped since then.
 	void Simulate();
 
-	/// Stop Simulation
+	/// Stop Simulation. Can be called from another thread.
 	void Stop();
 
 private:
@@ -106,6 +151,8 @@ private:
 	void RaiseError(const std::string& _sError);
 	/// clears log information about current state (TimeStart, TimeEnd, WindowNumber, etc.)
 	void ClearLogState();
+	/// Redirects warnings and infos of all units into the log as soon as they are generated. If _redirect is false, restores storing them in units.
+	void RedirectUnitsMessages(bool _redirect);
 
 	/// Calculates and sets estimated values to initialize tear _streams up to the _tExtra time point, applying selected extrapolation method on the time interval [_t1, _t2].
 	void ApplyExtrapolationMethod(const std::vector<CStream*>& _streams, double _t1, double _t2, double _tExtra) const;
@@ -113,14 +160,12 @@ private:
 	/// Setup chosen convergence method.
 	void SetupConvergenceMethod();
 	/// Applies selected convergence method to calculate new values _s3 using previous values _s2 and _s1 on the specified time interval.
-	void ApplyConvergenceMethod(const std::vector<CStream*>& _s3, std::vector<CStream*>& _s2, std::vector<CStream*>& _s1, double _t1, double _t2);
-	double PredictValues(double _d3, double _d2, double _d1) const;
-	std::vector<double> PredictValues( const std::vector<double>& _v3, const std::vector<double>& _v2, const std::vector<double>& _v1) const;
-	CDenseMDMatrix PredictValues(const CDenseMDMatrix& _m3, const CDenseMDMatrix& _m2, const CDenseMDMatrix& _m1) const;
+	/// Data of all streams and time points are packed into contiguous arrays and processed at once.
+	void ApplyConvergenceMethod(const std::vector<CStream*>& _s3, std::vector<CStream*>& _s2, std::vector<CStream*>& _s1, double _t1, double _t2, SAndersonHistory& _history);
+	/// Calculates new values _res of the length _len with the selected element-wise convergence method from the last three values _v3, _v2 and _v1.
 	void PredictValues(size_t _len, const double* _v3, const double* _v2, const double* _v1, double* _res) const;
-	double PredictRelaxation(double F2, double F1) const;
-	double PredictWegstein(double F2, double F1, double X2, double X1) const;
-	double PredictSteffensen(double F3, double F2, double F1) const;
+	/// Calculates new values _res with Anderson's method from the values after (_v3) and before (_v2) the last iteration and the _history of previous iterations.
+	void PredictAnderson(const std::vector<double>& _v3, const std::vector<double>& _v2, SAndersonHistory& _history, double* _res) const;
 
 	// Removes excessive data from streams of the selected partition on the time interval.
 	void ReduceData(const CCalculationSequence::SPartition& _partition, double _t1, double _t2) const;
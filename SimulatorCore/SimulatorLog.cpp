@@ -1,38 +1,30 @@
 /* Copyright (c) 2020, Dyssol Development Team. All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
 
 #include "SimulatorLog.h"
-#include <iostream>
 
 CSimulatorLog::CSimulatorLog()
 {
+	static_assert((MAX_LOG_SIZE & (MAX_LOG_SIZE - 1)) == 0, "Size of the log must be a power of 2");
 	m_log.resize(MAX_LOG_SIZE);
-	m_iReadPos = 0;
-	m_iWritePos = 0;
 }
 
-CSimulatorLog::~CSimulatorLog()
+void CSimulatorLog::Clear()
 {
+	m_iReadPos.store(m_iWritePos.load(std::memory_order_acquire), std::memory_order_release);
+	m_dropped.store(0, std::memory_order_relaxed);
+	m_hasProgress.store(false, std::memory_order_relaxed);
 }
 
-void CSimulatorLog::Clear()
+void CSimulatorLog::SetConsoleFunction(const ConsoleFun& _fun)
 {
-	for(auto l : m_log)
-	{
-		l.color = ELogColor::DEFAULT;
-		l.text.clear();
-	}
-	m_iReadPos = m_iWritePos = 0;
+	m_console = _fun;
 }
 
 void CSimulatorLog::Write(const std::string& _text, ELogColor _color, bool _console)
 {
-	const size_t iPos = m_iWritePos % MAX_LOG_SIZE; // up to MAX_LOG_SIZE and then again cyclic from 0
-	m_log[iPos].text = _text;
-	m_log[iPos].color = _color;
-
-	m_iWritePos++;
-	if(_console)
-		std::cout << _text << std::endl;
+	Push(SEvent{ EEventType::MESSAGE, _color, _text, {} });
+	if (_console && m_console)
+		m_console(_text);
 }
 
 void CSimulatorLog::WriteInfo(const std::string& _text, bool _console /*= false*/)
@@ -50,53 +42,49 @@ void CSimulatorLog::WriteError(const std::string& _text, bool _console /*= true*
 	Write("Error! " + _text, ELogColor::RED, _console);
 }
 
-std::string CSimulatorLog::Read()
+void CSimulatorLog::WriteProgress(const SSimulationProgress& _progress)
 {
-	if (EndOfLog()) return "";
-	const size_t iPos = m_iReadPos % MAX_LOG_SIZE; // up to MAX_LOG_SIZE and then again cyclic from 0
-	m_iReadPos++;
-	return m_log[iPos].text;
+	std::lock_guard lock{ m_progressMutex };
+	m_progress = _progress;
+	m_hasProgress.store(true, std::memory_order_relaxed);
 }
 
-std::string CSimulatorLog::GetFullLog() const
+bool CSimulatorLog::Read(SEvent& _event)
 {
-	std::string result;
-
-	// Iterate through all valid entries up to write position
-	for (size_t i = 0; i < m_iWritePos && i < MAX_LOG_SIZE; ++i)
+	const size_t iRead = m_iReadPos.load(std::memory_order_relaxed);
+	if (iRead != m_iWritePos.load(std::memory_order_acquire))
 	{
-		const size_t iPos = i % MAX_LOG_SIZE;
-		if (!m_log[iPos].text.empty())
-		{
-			if (!result.empty())
-				result += "\n";
-
-			// Add color-specific prefix
-			switch (m_log[iPos].color)
-			{
-			case ELogColor::RED:
-				result += "Error! ";
-				break;
-			case ELogColor::ORANGE:
-				result += "Warning! ";
-				break;
-			case ELogColor::DEFAULT:
-			default:
-				break;
-			}
-			result += m_log[iPos].text;
-		}
+		_event = std::move(m_log[iRead & (MAX_LOG_SIZE - 1)]);
+		// release the slot to the producer only after the event has been taken
+		m_iReadPos.store(iRead + 1, std::memory_order_release);
+		return true;
 	}
+	if (!m_hasProgress.load(std::memory_order_relaxed)) return false;
+	std::lock_guard lock{ m_progressMutex };
+	_event = SEvent{ EEventType::PROGRESS, ELogColor::DEFAULT, {}, m_progress };
+	m_hasProgress.store(false, std::memory_order_relaxed);
+	return true;
+}
 
-	return result;
+bool CSimulatorLog::EndOfLog() const
+{
+	return m_iReadPos.load(std::memory_order_acquire) == m_iWritePos.load(std::memory_order_acquire) && !m_hasProgress.load(std::memory_order_relaxed);
 }
 
-CSimulatorLog::ELogColor CSimulatorLog::GetReadColor() const
+size_t CSimulatorLog::DroppedNumber() const
 {
-	return m_log[m_iReadPos % MAX_LOG_SIZE].color;
+	return m_dropped.load(std::memory_order_relaxed);
 }
 
-bool CSimulatorLog::EndOfLog() const
+void CSimulatorLog::Push(SEvent&& _event)
 {
-	return m_iReadPos == m_iWritePos;
+	const size_t iWrite = m_iWritePos.load(std::memory_order_relaxed);
+	if (iWrite - m_iReadPos.load(std::memory_order_acquire) >= MAX_LOG_SIZE)
+	{
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	m_log[iWrite & (MAX_LOG_SIZE - 1)] = std::move(_event);
+	// publish the event to the consumer
+	m_iWritePos.store(iWrite + 1, std::memory_order_release);
 }
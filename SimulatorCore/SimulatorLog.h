@@ -2,11 +2,29 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
-/** Describes simulation log. Implements circular storage of messages by maintaining separate read and write positions for message buffering.
- *	Assumes that the distance between read and write positions never will be larger as MAX_LOG_SIZE. */
+// Progress of the simulation.
+struct SSimulationProgress
+{
+	std::string unitName;			// Name of the currently calculated unit.
+	size_t iPartition{ 0 };			// Index of the currently calculated partition.
+	size_t partitionsNumber{ 0 };	// Total number of partitions.
+	double dTWStart{ 0 };			// Start of the currently calculated time interval.
+	double dTWEnd{ 0 };				// End of the currently calculated time interval.
+	unsigned iWindowNumber{ 0 };	// Number of the current time window within a partition.
+	unsigned iIteration{ 0 };		// Iteration number within the current time window.
+	double time{ 0 };				// The last simulated time point.
+};
+
+/** Describes simulation log as a stream of events: messages and progress updates.
+ *	Events are written by the simulation and read by a consumer (GUI, Python interface, etc.) at its own pace from another thread.
+ *	Messages are stored in a lock-free single-producer single-consumer ring buffer. If the consumer does not keep up and the buffer is full, new messages are dropped and counted.
+ *	Progress updates are coalesced: only the latest one is kept and returned after all unread messages, so that they never displace messages. */
 class CSimulatorLog
 {
 public:
@@ -17,43 +35,67 @@ public:
 		ORANGE = 2
 	};
 
-private:
-	struct SColorLog
+	// Function to print messages, which are additionally written to the console.
+	using ConsoleFun = std::function<void(const std::string&)>;
+
+	enum class EEventType
 	{
-		ELogColor color;
-		std::string text;
+		MESSAGE  = 0,
+		PROGRESS = 1
 	};
 
-	const size_t MAX_LOG_SIZE = 500;
+	// Event of the simulation log.
+	struct SEvent
+	{
+		EEventType type{ EEventType::MESSAGE };	// Type of the event.
+		ELogColor color{ ELogColor::DEFAULT };	// Color of the message.
+		std::string text;						// Text of the message.
+		SSimulationProgress progress;			// Progress, for progress events.
+	};
 
-	std::vector<SColorLog> m_log;
-	size_t m_iReadPos;
-	size_t m_iWritePos;
+private:
+	static constexpr size_t MAX_LOG_SIZE = 4096; // Must be a power of 2.
+
+	std::vector<SEvent> m_log;
+	alignas(64) std::atomic<size_t> m_iWritePos{ 0 };	// Modified only by the producer.
+	alignas(64) std::atomic<size_t> m_iReadPos{ 0 };	// Modified only by the consumer.
+	std::atomic<size_t> m_dropped{ 0 };				// Number of messages dropped because of a full buffer.
+
+	SSimulationProgress m_progress;					// The latest unread progress update.
+	std::atomic<bool> m_hasProgress{ false };		// Whether m_progress has not been read yet.
+	std::mutex m_progressMutex;						// Guards access to m_progress.
+
+	ConsoleFun m_console;							// Function to print console messages. If not set, they are only written to the log.
 
 public:
 	CSimulatorLog();
-	~CSimulatorLog();
 
-	// Removes all messages and resets read and write positions.
+	// Removes all unread events. Must be called by the consumer or while no events are being written.
 	void Clear();
 
-	// Writes a message with the specified color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
+	// Sets a function to print console messages. It is called from the simulation thread. Must not be called while events are being written.
+	void SetConsoleFunction(const ConsoleFun& _fun);
+
+	// Writes a message with the specified color. If _console is set, the message will be additionally passed to the console function.
 	void Write(const std::string& _text, ELogColor _color, bool _console);
-	// Writes an info message with the pre-defined color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
+	// Writes an info message with the pre-defined color. If _console is set, the message will be additionally passed to the console function.
 	void WriteInfo(const std::string& _text, bool _console = false);
-	// Writes a warning message with the pre-defined color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
+	// Writes a warning message with the pre-defined color. If _console is set, the message will be additionally passed to the console function.
 	void WriteWarning(const std::string& _text, bool _console = true);
-	// Writes an error message with the pre-defined color to the current write position and advances this position. If _console is set, the message will be additionally written into std::out.
+	// Writes an error message with the pre-defined color. If _console is set, the message will be additionally passed to the console function.
 	void WriteError(const std::string& _text, bool _console = true);
+	// Writes a progress event, replacing the previous one, if it has not been read yet.
+	void WriteProgress(const SSimulationProgress& _progress);
 
-	// Returns message from the current read position and advances this position. Returns empty string if the end of log is reached.
-	std::string Read();
-	// Returns the complete log as a single string, containing all valid messages from start to current write position
-	std::string GetFullLog() const;
-	// Returns color from the current read position.
-	ELogColor GetReadColor() const;
+	// Moves the oldest unread message or, if there are none, the latest unread progress update into _event. Returns false if there are no unread events.
+	bool Read(SEvent& _event);
 
-	// Returns true if the end of the log file is reached (the read position is equal to the write position).
+	// Returns true if the end of the log is reached (all written events are read).
 	bool EndOfLog() const;
-};
+	// Returns the number of messages dropped because the consumer did not keep up.
+	size_t DroppedNumber() const;
 
+private:
+	// Puts the message into the buffer, if it is not full.
+	void Push(SEvent&& _event);
+};
@@ -33,12 +33,7 @@ CUnitContainer::CUnitContainer(const CUnitContainer& _other)
 	, m_tolerance{ _other.m_tolerance }
 	, m_thermodynamics{ _other.m_thermodynamics }
 {
-	if (_other.m_model)
-	{
-		SetModel(_other.m_model->GetUniqueID());
-		if (m_model)
-			*m_model = *_other.m_model;
-	}
+	CopyFrom(_other);
 }
 
 CUnitContainer::CUnitContainer(CUnitContainer&& _other) noexcept
@@ -124,6 +119,24 @@ CBaseUnit* CUnitContainer::GetModel()
 	return m_model;
 }
 
+void CUnitContainer::CopyFrom(const CUnitContainer& _other)
+{
+	m_name = _other.m_name;
+	m_uniqueID = _other.m_uniqueID;
+	if (!_other.m_model)
+	{
+		ClearExternalSolvers();
+		m_modelsManager->FreeUnit(m_model);
+		m_model = nullptr;
+		return;
+	}
+	// create an own instance of the model with its structure and fill it with values,
+	// since the model may keep pointers to its own parameters and holdups
+	SetModel(_other.m_model->GetUniqueID());
+	if (m_model)
+		m_model->CopyUserData(*_other.m_model);
+}
+
 void CUnitContainer::SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB)
 {
 	m_materialsDB = _materialsDB;
@@ -75,6 +75,8 @@ public:
 	const CBaseUnit* GetModel() const;
 	// Returns a pointer to a contained model.
 	CBaseUnit* GetModel();
+	// Copies the name, the key, the model and all its user-defined data from another unit. References to flowsheet structural data are kept.
+	void CopyFrom(const CUnitContainer& _other);
 
 	// Sets pointer to a global materials database.
 	void SetMaterialsDatabase(const CMaterialsDatabase* _materialsDB);
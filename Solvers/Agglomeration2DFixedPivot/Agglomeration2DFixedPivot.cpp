@@ -0,0 +1,177 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "Agglomeration2DFixedPivot.h"
+#include "DyssolDefines.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// Number of size classes processed by one parallel task.
+	constexpr size_t BLOCK_SIZE = 16;
+}
+
+extern "C" DECLDIR CAgglomeration2DSolver* CREATE_SOLVER_FUN_AGG2()
+{
+	return new CAgglomeration2DFixedPivot();
+}
+
+void CAgglomeration2DFixedPivot::CreateBasicInfo()
+{
+	SetName("Fixed Pivot 2D");
+	SetAuthorName("DyssolTEC");
+	SetUniqueID("2A6F0C9E41D84B6F9E3B57C1D08A4E62");
+	SetVersion(1);
+	SetHelpLink("003_models/solver_fixedpivot2d.html");
+}
+
+void CAgglomeration2DFixedPivot::Initialize()
+{
+	n1 = GetClassesNumber();
+	n2 = GetClassesNumber2();
+
+	// size pivots as in the one-dimensional fixed pivot solver, with an extra point to catch all too large agglomerates
+	pivots1.resize(n1 + 1);
+	for (size_t i = 0; i <= n1; ++i)
+		pivots1[i] = MATH_PI / 6. * std::pow(m_grid[i], 3);
+	pivots1.push_back(pivots1.back() + pivots1[1] * 0.5);
+
+	// property pivots in the middle of classes
+	pivots2.resize(n2);
+	for (size_t j = 0; j < n2; ++j)
+		pivots2[j] = (m_grid2[j] + m_grid2[j + 1]) / 2.;
+
+	const d_vect_t volumes(pivots1.begin() + 1, pivots1.begin() + 1 + n1);
+	beta = TabulateKernel(volumes, volumes);
+
+	// size targets: class t of the agglomerate of classes i and k is shifted by one, as in the one-dimensional solver
+	target1.assign(n1, std::vector<STarget>(n1));
+	ParallelFor(n1, [&](size_t i)
+	{
+		for (size_t k = 0; k <= i; ++k)
+		{
+			const double v = pivots1[i + 1] + pivots1[k + 1];
+			const size_t t = std::lower_bound(pivots1.begin(), pivots1.end(), v) - pivots1.begin() - 1;
+			auto& res = target1[i][k];
+			res.i = t;
+			if (t + 1 < pivots1.size())
+			{
+				res.w1 = (pivots1[t + 1] - v) / (pivots1[t + 1] - pivots1[t]);
+				res.w2 = (v - pivots1[t]) / (pivots1[t + 1] - pivots1[t]);
+			}
+		}
+	});
+
+	// property targets do not depend on sizes for additive property
+	target2.clear();
+	if (m_propertyType == EPropertyType::ADDITIVE)
+	{
+		target2.assign(n2, std::vector<STarget>(n2));
+		for (size_t j = 0; j < n2; ++j)
+			for (size_t l = 0; l < n2; ++l)
+				target2[j][l] = PropertyTarget(pivots2[j] + pivots2[l]);
+	}
+
+	buffers.assign((n1 + BLOCK_SIZE - 1) / BLOCK_SIZE, d_vect_t(n1 * n2));
+}
+
+void CAgglomeration2DFixedPivot::Calculate(size_t _count, const double* _n, double* _rateB, double* _rateD)
+{
+	const size_t len = n1 * n2;
+	std::fill(_rateB, _rateB + _count * len, 0.0);
+	std::fill(_rateD, _rateD + _count * len, 0.0);
+	if (len == 0) return;
+
+	for (size_t c = 0; c < _count; ++c)
+	{
+		ApplyFixedPivot(_n + c * len, _rateB + c * len, _rateD + c * len);
+		for (size_t i = 0; i < len; ++i)
+		{
+			_rateB[c * len + i] *= m_beta0;
+			_rateD[c * len + i] *= m_beta0;
+		}
+	}
+}
+
+void CAgglomeration2DFixedPivot::ApplyFixedPivot(const double* _n, double* _rateB, double* _rateD)
+{
+	const d_matr_t& beta = *this->beta;
+
+	// sink: depends only on the total number of particles in each size class
+	d_vect_t total(n1, 0.0);
+	for (size_t j = 0; j < n2; ++j)
+		for (size_t i = 0; i < n1; ++i)
+			total[i] += _n[j * n1 + i];
+	ParallelFor(n1, [&](size_t i)
+	{
+		double sum = 0;
+		for (size_t k = 0; k < n1; ++k)
+			sum += beta[i][k] * total[k];
+		for (size_t j = 0; j < n2; ++j)
+			_rateD[j * n1 + i] = _n[j * n1 + i] * sum;
+	});
+
+	// source: each block of size classes is written to its own buffer to avoid synchronization
+	ParallelFor(buffers.size(), [&](size_t b)
+	{
+		std::fill(buffers[b].begin(), buffers[b].end(), 0.0);
+		ApplyBirth(_n, b * BLOCK_SIZE, std::min((b + 1) * BLOCK_SIZE, n1), buffers[b].data());
+	});
+	for (const auto& buffer : buffers)
+		for (size_t i = 0; i < n1 * n2; ++i)
+			_rateB[i] += buffer[i];
+}
+
+void CAgglomeration2DFixedPivot::ApplyBirth(const double* _n, size_t _beg, size_t _end, double* _rateB) const
+{
+	const d_matr_t& beta = *this->beta;
+	const bool additive = m_propertyType == EPropertyType::ADDITIVE;
+	for (size_t i = _beg; i < _end; ++i)
+		for (size_t k = 0; k <= i; ++k)
+		{
+			const STarget& t1 = target1[i][k];
+			// too large agglomerates are ignored
+			if (t1.i > n1) continue;
+			const double b = beta[i][k] * (i == k ? 0.5 : 1.0);
+			// weight of the first particle for averaged property
+			const double w = pivots1[i + 1] / (pivots1[i + 1] + pivots1[k + 1]);
+			for (size_t j = 0; j < n2; ++j)
+			{
+				const double nij = _n[j * n1 + i];
+				if (nij == 0.0) continue;
+				for (size_t l = 0; l < n2; ++l)
+				{
+					const double val = nij * _n[l * n1 + k] * b;
+					if (val == 0.0) continue;
+					const STarget t2 = additive ? target2[j][l] : PropertyTarget(w * pivots2[j] + (1 - w) * pivots2[l]);
+					// distribute between up to four neighboring pivots
+					double* row1 = _rateB + t2.i * n1;
+					double* row2 = t2.i + 1 < n2 ? row1 + n1 : nullptr;
+					if (t1.i - 1 < n1)
+					{
+						row1[t1.i - 1] += t1.w1 * t2.w1 * val;
+						if (row2) row2[t1.i - 1] += t1.w1 * t2.w2 * val;
+					}
+					if (t1.i < n1)
+					{
+						row1[t1.i] += t1.w2 * t2.w1 * val;
+						if (row2) row2[t1.i] += t1.w2 * t2.w2 * val;
+					}
+				}
+			}
+		}
+}
+
+CAgglomeration2DFixedPivot::STarget CAgglomeration2DFixedPivot::PropertyTarget(double _y) const
+{
+	// values outside the range of pivots are assigned to the boundary classes
+	if (_y <= pivots2.front())
+		return { 0, 1.0, 0.0 };
+	if (_y >= pivots2.back())
+		return { n2 - 1, 1.0, 0.0 };
+	const size_t s = std::upper_bound(pivots2.begin(), pivots2.end(), _y) - pivots2.begin() - 1;
+	const double w2 = (_y - pivots2[s]) / (pivots2[s + 1] - pivots2[s]);
+	return { s, 1.0 - w2, w2 };
+}
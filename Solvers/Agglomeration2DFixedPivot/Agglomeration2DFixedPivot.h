@@ -0,0 +1,39 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "Agglomeration2DSolver.h"
+#include "ThreadPool.h"
+
+class CAgglomeration2DFixedPivot : public CAgglomeration2DSolver
+{
+	// Target of an agglomerate in one dimension: two neighboring pivots with weights.
+	struct STarget
+	{
+		size_t i{};		// Index of the left pivot.
+		double w1{};	// Weight of the left pivot.
+		double w2{};	// Weight of the right pivot (i + 1).
+	};
+
+	size_t n1{};							// Number of size classes.
+	size_t n2{};							// Number of classes of the second property.
+	std::shared_ptr<const d_matr_t> beta;	// Precalculated kernel, shared between solvers with identical settings.
+	d_vect_t pivots1;						// Volume pivots of size classes.
+	d_vect_t pivots2;						// Pivots of the second property.
+	std::vector<std::vector<STarget>> target1;	// Size targets for all pairs of size classes.
+	std::vector<std::vector<STarget>> target2;	// Property targets for all pairs of property classes, only for additive property.
+	std::vector<d_vect_t> buffers;			// Birth rates calculated in parallel for each block of size classes.
+
+public:
+	void CreateBasicInfo() override;
+	void Initialize() override;
+	void Calculate(size_t _count, const double* _n, double* _rateB, double* _rateD) override;
+
+private:
+	void ApplyFixedPivot(const double* _n, double* _rateB, double* _rateD);
+	// Calculates births from all pairs of size classes (i, k), k <= i, for i in [_beg; _end).
+	void ApplyBirth(const double* _n, size_t _beg, size_t _end, double* _rateB) const;
+	// Returns the target for the given value of the second property.
+	[[nodiscard]] STarget PropertyTarget(double _y) const;
+};
@@ -25,12 +25,10 @@ void CAgglomerationCellAverage::Initialize()
 	const double h = 1.0 / static_cast<double>(n);					// size of interval
 	const double Vmax = MATH_PI / 6. * std::pow(m_grid.back(), 3);	// max volume
 
-	beta.resize(n, d_vect_t(n));
-	ParallelFor(n, [&](size_t i)
-	{
-		for (size_t j = 0; j < n; ++j)
-			beta[i][j] = Kernel(Vmax * (h * i + h / 2.0), Vmax * (h * j + h / 2.0));
-	});
+	d_vect_t volumes(n);
+	for (size_t i = 0; i < n; ++i)
+		volumes[i] = Vmax * (h * i + h / 2.0);
+	beta = TabulateKernel(volumes, volumes);
 }
 
 void CAgglomerationCellAverage::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
@@ -52,6 +50,7 @@ void CAgglomerationCellAverage::ApplyCellAverage(const d_vect_t& _f, d_vect_t& _
 {
 	d_vect_t avg(n, 0.0);
 	d_vect_t b(n, 0.0);
+	const d_matr_t& beta = *this->beta;
 
 	ParallelFor(n, [&](size_t i)
 	{
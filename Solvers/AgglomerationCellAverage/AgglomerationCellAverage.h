@@ -8,7 +8,7 @@
 class CAgglomerationCellAverage : public CAgglomerationSolver
 {
 	size_t n{};								// Number of size-intervals.
-	std::vector<std::vector<double>> beta;	// Precalculated kernel.
+	std::shared_ptr<const d_matr_t> beta;	// Precalculated kernel, shared between solvers with identical settings.
 
 public:
 	void CreateBasicInfo() override;
@@ -4,6 +4,7 @@
 #include "AgglomerationFFT.h"
 #include "DyssolDefines.h"
 #include "ThreadPool.h"
+#include <algorithm>
 
 extern "C" DECLDIR CAgglomerationSolver * CREATE_SOLVER_FUN_AGG1()
 {
@@ -15,7 +16,7 @@ void CAgglomerationFFT::CreateBasicInfo()
 	SetName("FFT");
 	SetAuthorName("Lusine Shahmuradyan / Robin Ahrens");
 	SetUniqueID("5547D68E93E844F8A55A36CB957A253B");
-	SetVersion(4);
+	SetVersion(5);
 	SetHelpLink("003_models/solver_fft.html");
 }
 
@@ -40,11 +41,38 @@ void CAgglomerationFFT::Initialize()
 	const double Vmax = MATH_PI / 6. * std::pow(m_grid.back(), 3.); // max volume
 	const double h = 1.0 / n;
 
-	for (size_t i = 0; i < rank; ++i)
+	// volume grid
+	d_vect_t edges(m_grid.size());
+	for (size_t i = 0; i < m_grid.size(); ++i)
+		edges[i] = MATH_PI / 6. * std::pow(m_grid[i], 3.);
+	uniform = IsUniformVolumeGrid(edges);
+
+	// mean volumes of size-intervals
+	volumes.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		volumes[i] = uniform ? Vmax * h * (i + 0.5) : (edges[i] + edges[i + 1]) / 2.;
+
+	ClearLevels();
+	if (uniform)
 	{
-		fftConfigF.push_back(kiss_fftr_alloc(static_cast<int>(n), 0, nullptr, nullptr));
-		fftConfigB.push_back(kiss_fftr_alloc(static_cast<int>(n), 1, nullptr, nullptr));
+		for (size_t i = 0; i < rank; ++i)
+		{
+			fftConfigF.push_back(kiss_fftr_alloc(static_cast<int>(n), 0, nullptr, nullptr));
+			fftConfigB.push_back(kiss_fftr_alloc(static_cast<int>(n), 1, nullptr, nullptr));
+		}
+		// buffers are owned by the solver, so that several solvers can run concurrently
+		phi.assign(rank, d_vect_t(n));
+		psi.assign(rank, d_vect_t(n));
+		omega.assign(rank, d_vect_t(n));
+		sink_proj.assign(rank, d_vect_t(n));
+		source.assign(rank, d_vect_t(n + 1));
+		source_proj.assign(rank, d_vect_t(n));
+		PHI.assign(rank, std::vector<std::complex<double>>(n / 2 + 1));
+		PSI.assign(rank, std::vector<std::complex<double>>(n / 2 + 1));
+		OMEGA.assign(rank, std::vector<std::complex<double>>(n / 2 + 1));
 	}
+	else
+		InitializeLevels(edges);
 
 	alpha.clear();
 	beta.clear();
@@ -56,26 +84,26 @@ void CAgglomerationFFT::Initialize()
 	case EKernels::CONSTANT:
 		for (size_t j = 0; j < n; ++j)
 		{
-			alpha[0][j] = Vmax * h * (j + 0.5);
+			alpha[0][j] = volumes[j];
 			beta[0][j] = 1;
 		}
 		break;
 	case EKernels::SUM:
 		for (size_t j = 0; j < n; ++j)
 		{
-			alpha[0][j] = Vmax * h * (j + 0.5);
+			alpha[0][j] = volumes[j];
 			beta[0][j] = 1;
 			alpha[1][j] = 1;
-			beta[1][j] = Vmax * h * (j + 0.5);
+			beta[1][j] = volumes[j];
 		}
 		break;
 	case EKernels::BROWNIAN:
 		for (size_t j = 0; j < n; ++j)
 		{
-			alpha[0][j] = std::pow(Vmax * h * (j + 0.5), 1. / 3.);
-			beta[0][j] = std::pow(Vmax * h * (j + 0.5), -1. / 3.);
-			alpha[1][j] = std::pow(Vmax * h * (j + 0.5), -1. / 3.);
-			beta[1][j] = std::pow(Vmax * h * (j + 0.5), 1. / 3.);
+			alpha[0][j] = std::pow(volumes[j], 1. / 3.);
+			beta[0][j] = std::pow(volumes[j], -1. / 3.);
+			alpha[1][j] = std::pow(volumes[j], -1. / 3.);
+			beta[1][j] = std::pow(volumes[j], 1. / 3.);
 			alpha[2][j] = std::sqrt(2.);
 			beta[2][j] = std::sqrt(2.);
 		}
@@ -88,10 +116,12 @@ void CAgglomerationFFT::Initialize()
 		// EZ contains values with both parameters at Chebyshev-Points
 		std::vector<d_matr_t> EZ(rank, d_matr_t(rank));
 
+		// Chebyshev points are distributed linearly on equidistant grids and logarithmically otherwise
 		d_vect_t ChebPoints(rank);
 		ParallelFor(rank, [&](size_t r)
 		{
-			ChebPoints[r] = 0.5 + 0.5 * std::cos((2 * r + 1) * MATH_PI / (2 * rank));
+			const double point = 0.5 + 0.5 * std::cos((2 * r + 1) * MATH_PI / (2 * rank));
+			ChebPoints[r] = uniform ? Vmax * point : volumes.front() * std::pow(volumes.back() / volumes.front(), point);
 		});
 
 
@@ -99,10 +129,10 @@ void CAgglomerationFFT::Initialize()
 		ParallelFor(rank, [&](size_t r)
 		{
 			for (size_t i = 0; i < n; ++i)
-				E[0][r][i] = Kernel(Vmax * h * (i + 0.5), Vmax * ChebPoints[r]);
+				E[0][r][i] = Kernel(volumes[i], ChebPoints[r]);
 			EZ[0][r].resize(rank);
 			for (size_t r2 = 0; r2 < rank; ++r2)
-				EZ[0][r][r2] = Kernel(Vmax * ChebPoints[r], Vmax * ChebPoints[r2]);
+				EZ[0][r][r2] = Kernel(ChebPoints[r], ChebPoints[r2]);
 		});
 
 		for (size_t i = 0; i < n; ++i)
@@ -158,6 +188,12 @@ void CAgglomerationFFT::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t
 	_rateD.assign(_n.size(), 0);
 	if (_n.empty()) return;
 
+	if (!uniform)
+	{
+		ApplyMultiLevelFFT(_n, _rateB, _rateD);
+		return;
+	}
+
 	// initial distribution
 	d_vect_t f(n);
 	for (size_t i = 0; i < n; ++i)
@@ -182,6 +218,7 @@ void CAgglomerationFFT::Finalize()
 		}
 	fftConfigF.clear();
 	fftConfigB.clear();
+	ClearLevels();
 }
 
 double CAgglomerationFFT::BrownianAlpha(size_t _nu, double _v) const
@@ -202,26 +239,6 @@ double CAgglomerationFFT::BrownianBeta(size_t _nu, double _v) const
 
 void CAgglomerationFFT::ApplyFFT(const d_vect_t& _f, d_vect_t& _rateB, d_vect_t& _rateD)
 {
-	// Distribution and Kernel-Alpha
-	DEFINE_AND_CHECK_STATIC_VECTOR(phi, double, rank, n);
-	DEFINE_AND_CHECK_STATIC_VECTOR(PHI, std::complex<double>, rank, n / 2 + 1);
-
-	// Distribution and Kernel-Beta
-	DEFINE_AND_CHECK_STATIC_VECTOR(psi, double, rank, n);
-	DEFINE_AND_CHECK_STATIC_VECTOR(PSI, std::complex<double>, rank, n / 2 + 1);
-
-	// Pointwise Product of Fourier-Transform
-	DEFINE_AND_CHECK_STATIC_VECTOR(omega, double, rank, n);
-	DEFINE_AND_CHECK_STATIC_VECTOR(OMEGA, std::complex<double>, rank, n / 2 + 1);
-
-	// Sink Term and Projection
-	//DEFINE_AND_CHECK_STATIC_VECTOR(sink, double, m_rank, n + 1);
-	DEFINE_AND_CHECK_STATIC_VECTOR(sink_proj, double, rank, n);
-
-	// Source Term and projection
-	DEFINE_AND_CHECK_STATIC_VECTOR(source, double, rank, n + 1);
-	DEFINE_AND_CHECK_STATIC_VECTOR(source_proj, double, rank, n);
-
 	ParallelFor(rank, [&](size_t nu)
 	{
 		for (size_t i = 0; i < n; ++i)
@@ -289,3 +306,173 @@ void CAgglomerationFFT::FFT(size_t _rank, d_vect_t& _rData, std::vector<std::com
 	else
 		kiss_fftri(fftConfigB[_rank], reinterpret_cast<kiss_fft_cpx*>(_cData.data()), _rData.data());
 }
+
+void CAgglomerationFFT::ApplyMultiLevelFFT(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD)
+{
+	// Sink term does not require convolution, so it is calculated directly on the original grid
+	for (size_t nu = 0; nu < rank; ++nu)
+	{
+		double integral = 0;
+		for (size_t i = 0; i < n; ++i)
+			integral += beta[nu][i] * _n[i];
+		for (size_t i = 0; i < n; ++i)
+			_rateD[i] += alpha[nu][i] * _n[i] * integral;
+	}
+
+	/* Source term is split by levels. On each level, only pairs where the larger partner belongs to the upper part of the level are considered:
+	 * psi_upper * (phi_upper + phi_lower) + psi_lower * phi_upper.
+	 * Thus, each pair of particles is taken into account exactly once on the level with the finest resolution for the larger partner. */
+	ParallelFor(levels.size(), [&](size_t l)
+	{
+		auto& level = levels[l];
+		std::fill(level.OMEGA.begin(), level.OMEGA.end(), std::complex<double>(0.0, 0.0));
+		for (size_t nu = 0; nu < rank; ++nu)
+		{
+			std::fill(level.psiU.begin(), level.psiU.end(), 0.0);
+			std::fill(level.psiL.begin(), level.psiL.end(), 0.0);
+			std::fill(level.phiU.begin(), level.phiU.end(), 0.0);
+			std::fill(level.phiA.begin(), level.phiA.end(), 0.0);
+			for (const auto& o : level.upper)
+			{
+				level.psiU[o.iCell] += o.weight * alpha[nu][o.iClass] * _n[o.iClass];
+				level.phiU[o.iCell] += o.weight * beta[nu][o.iClass] * _n[o.iClass];
+			}
+			for (const auto& o : level.lower)
+			{
+				level.psiL[o.iCell] += o.weight * alpha[nu][o.iClass] * _n[o.iClass];
+				level.phiA[o.iCell] += o.weight * beta[nu][o.iClass] * _n[o.iClass];
+			}
+			for (size_t i = 0; i < level.cells; ++i)
+				level.phiA[i] += level.phiU[i];
+
+			kiss_fftr(level.configF, level.psiU.data(), reinterpret_cast<kiss_fft_cpx*>(level.PSIU.data()));
+			kiss_fftr(level.configF, level.psiL.data(), reinterpret_cast<kiss_fft_cpx*>(level.PSIL.data()));
+			kiss_fftr(level.configF, level.phiU.data(), reinterpret_cast<kiss_fft_cpx*>(level.PHIU.data()));
+			kiss_fftr(level.configF, level.phiA.data(), reinterpret_cast<kiss_fft_cpx*>(level.PHIA.data()));
+
+			for (size_t i = 0; i < level.OMEGA.size(); ++i)
+				level.OMEGA[i] += level.PSIU[i] * level.PHIA[i] + level.PSIL[i] * level.PHIU[i];
+		}
+		kiss_fftri(level.configB, reinterpret_cast<kiss_fft_cpx*>(level.OMEGA.data()), level.omega.data());
+	});
+
+	// gather results of all levels
+	for (const auto& level : levels)
+	{
+		const double factor = 0.5 / static_cast<double>(level.omega.size());
+		for (const auto& o : level.back)
+			_rateB[o.iClass] += factor * o.weight * level.omega[o.iCell];
+	}
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		_rateB[i] *= m_beta0;
+		_rateD[i] *= m_beta0;
+	}
+}
+
+bool CAgglomerationFFT::IsUniformVolumeGrid(const d_vect_t& _edges)
+{
+	if (_edges.size() < 2 || _edges.front() != 0.0) return false;
+	const double width = (_edges.back() - _edges.front()) / static_cast<double>(_edges.size() - 1);
+	for (size_t i = 1; i < _edges.size(); ++i)
+		if (std::fabs(_edges[i] - _edges[i - 1] - width) > 1e-6 * width)
+			return false;
+	return true;
+}
+
+void CAgglomerationFFT::InitializeLevels(const d_vect_t& _edges)
+{
+	const size_t minCells = 8;				// Minimum number of cells on each level.
+	const size_t maxCells = size_t{ 1 } << 16;	// Maximum number of cells on each level.
+	const size_t maxLevels = 128;			// Maximum number of levels.
+
+	double top = _edges.back();
+	while (levels.size() < maxLevels)
+	{
+		const double half = top / 2.;
+		// the last level covers the whole rest of the grid
+		const bool last = half <= _edges[1] || levels.size() == maxLevels - 1;
+		const double beg = last ? 0.0 : half;
+
+		// the resolution of the level must be fine enough to resolve all size-intervals in its upper part
+		double width = top;
+		for (size_t i = 0; i < n; ++i)
+			if (_edges[i + 1] > beg && _edges[i] < top && _edges[i + 1] > _edges[i])
+				width = std::min(width, _edges[i + 1] - _edges[i]);
+		size_t cells = minCells;
+		while (cells < maxCells && static_cast<double>(cells) * width < 2. * top)
+			cells *= 2;
+		const double h = top / static_cast<double>(cells);
+
+		SLevel level;
+		level.cells = cells;
+		AddOverlaps(_edges, h, cells, beg, top, level.upper);
+		if (!last)
+			AddOverlaps(_edges, h, cells, 0.0, beg, level.lower);
+
+		// pairs from cells j and k have the mean volume (j + k + 1) * h and are spread over a cell of width h around it
+		for (size_t m = 0; m < 2 * cells - 1; ++m)
+		{
+			const double l = (static_cast<double>(m) + 0.5) * h;
+			const double r = (static_cast<double>(m) + 1.5) * h;
+			// particles smaller than the grid are put into the first size-interval, particles larger than the grid are lost
+			if (l < _edges.front())
+				level.back.push_back({ 0, m, (std::min(r, _edges.front()) - l) / h });
+			const auto first = static_cast<size_t>(std::upper_bound(_edges.begin(), _edges.end() - 1, l) - _edges.begin());
+			for (size_t i = std::max<size_t>(first, 1); i <= n && _edges[i - 1] < r; ++i)
+			{
+				const double overlap = std::min(r, _edges[i]) - std::max(l, _edges[i - 1]);
+				if (overlap > 0)
+					level.back.push_back({ i - 1, m, overlap / h });
+			}
+		}
+
+		// convolution is calculated without periodic wrapping
+		const size_t size = 2 * cells;
+		level.configF = kiss_fftr_alloc(static_cast<int>(size), 0, nullptr, nullptr);
+		level.configB = kiss_fftr_alloc(static_cast<int>(size), 1, nullptr, nullptr);
+		level.psiU.resize(size);
+		level.psiL.resize(size);
+		level.phiU.resize(size);
+		level.phiA.resize(size);
+		level.omega.resize(size);
+		level.PSIU.resize(size / 2 + 1);
+		level.PSIL.resize(size / 2 + 1);
+		level.PHIU.resize(size / 2 + 1);
+		level.PHIA.resize(size / 2 + 1);
+		level.OMEGA.resize(size / 2 + 1);
+		levels.push_back(std::move(level));
+
+		if (last) break;
+		top = half;
+	}
+}
+
+void CAgglomerationFFT::ClearLevels()
+{
+	for (auto& level : levels)
+	{
+		kiss_fftr_free(level.configF);
+		kiss_fftr_free(level.configB);
+	}
+	levels.clear();
+}
+
+void CAgglomerationFFT::AddOverlaps(const d_vect_t& _edges, double _h, size_t _cells, double _beg, double _end, std::vector<SOverlap>& _overlaps)
+{
+	for (size_t i = 0; i + 1 < _edges.size(); ++i)
+	{
+		const double width = _edges[i + 1] - _edges[i];
+		const double l = std::max(_edges[i], _beg);
+		const double r = std::min(_edges[i + 1], _end);
+		if (width <= 0 || r <= l) continue;
+		const auto first = static_cast<size_t>(l / _h);
+		for (size_t k = first; k < _cells && static_cast<double>(k) * _h < r; ++k)
+		{
+			const double overlap = std::min(r, (k + 1) * _h) - std::max(l, k * _h);
+			if (overlap > 0)
+				_overlaps.push_back({ i, k, overlap / width });
+		}
+	}
+}
@@ -6,26 +6,50 @@
 #include <complex>
 #include "kiss_fftr.h"
 
-#define DEFINE_AND_CHECK_STATIC_VECTOR(name, type, dim1, dim2) \
-static std::vector<std::vector<type>> name; \
-if (name.empty() || name.size() != dim1 || name.front().size() != dim2) { \
-	name.clear(); \
-	name.resize(dim1, std::vector<type>(dim2)); \
-}
-
 class CAgglomerationFFT : public CAgglomerationSolver
 {
+	// Overlap of a size-interval of the original grid with a cell of a uniform level grid.
+	struct SOverlap
+	{
+		size_t iClass;	// Index of size-interval on the original grid.
+		size_t iCell;	// Index of cell on the level grid.
+		double weight;	// Fraction of the value transferred between the interval and the cell.
+	};
+
+	// Uniform level of the piecewise-uniform scheme, used for non-equidistant grids.
+	// The level covers volumes [0, V] with equidistant cells, the upper part (V/2, V] is resolved by this level, the lower part [0, V/2] by the next ones.
+	struct SLevel
+	{
+		size_t cells{};					// Number of cells on the level.
+		std::vector<SOverlap> upper;	// Projection of size-intervals onto cells in (V/2, V].
+		std::vector<SOverlap> lower;	// Projection of size-intervals onto cells in [0, V/2].
+		std::vector<SOverlap> back;		// Projection of convolution results onto size-intervals.
+		kiss_fftr_cfg configF{};		// FFT solver configuration in forward direction.
+		kiss_fftr_cfg configB{};		// FFT solver configuration in backward direction.
+		d_vect_t psiU, psiL, phiU, phiA, omega;									// Buffers for projected distributions and result.
+		std::vector<std::complex<double>> PSIU, PSIL, PHIU, PHIA, OMEGA;	// Buffers for Fourier-transforms.
+	};
+
 	size_t n{};					// Number of size-intervals.
 	size_t rank{ 3 };			// Separation rank.
 	double resizeFactor{};		// Scaling factor.
 	double transformFactor{};	// Scaling factor.
+	bool uniform{ true };		// Whether the volume grid is equidistant and starts from 0.
 
 	d_matr_t alpha, beta;
 	d_vect_t temp1, temp2;	// For precalculations.
+	d_vect_t volumes;		// Mean volumes of size-intervals.
 
 	std::vector<kiss_fftr_cfg> fftConfigF; // FFT solver configuration for each rank in forward direction.
 	std::vector<kiss_fftr_cfg> fftConfigB; // FFT solver configuration for each rank in backward direction.
 
+	d_matr_t phi, psi, omega;		// Buffers for distribution multiplied with kernel functions and their convolution, for each rank.
+	d_matr_t sink_proj;				// Buffer for projected sink term, for each rank.
+	d_matr_t source, source_proj;	// Buffers for source term and its projection, for each rank.
+	std::vector<std::vector<std::complex<double>>> PHI, PSI, OMEGA;	// Buffers for Fourier-transforms, for each rank.
+
+	std::vector<SLevel> levels; // Levels of the piecewise-uniform scheme for non-equidistant grids.
+
 public:
 	void CreateBasicInfo() override;
 	void Initialize() override;
@@ -37,6 +61,17 @@ private:
 	double BrownianBeta(size_t _nu, double _v) const;
 
 	void ApplyFFT(const d_vect_t& _f, d_vect_t& _rateB, d_vect_t& _rateD);
+	// Calculates rates on a non-equidistant grid using the piecewise-uniform multi-level scheme.
+	void ApplyMultiLevelFFT(const d_vect_t& _n, d_vect_t& _rateB, d_vect_t& _rateD);
+
+	// Checks whether the volume grid is equidistant and starts from 0.
+	static bool IsUniformVolumeGrid(const d_vect_t& _edges);
+	// Builds levels of the piecewise-uniform scheme for the given volume grid.
+	void InitializeLevels(const d_vect_t& _edges);
+	// Releases all levels of the piecewise-uniform scheme.
+	void ClearLevels();
+	// Adds overlaps of size-intervals with _cells cells of width _h within the volume range [_beg, _end].
+	static void AddOverlaps(const d_vect_t& _edges, double _h, size_t _cells, double _beg, double _end, std::vector<SOverlap>& _overlaps);
 
 	// Performs Fast Fourier Transformation (_bDirect = true) or Inverse Fast Fourier Transformation (_bDirect = false) on _data.
 	void FFT(size_t _rank, d_vect_t& _rData, std::vector<std::complex<double>>& _cData, bool _direct) const;
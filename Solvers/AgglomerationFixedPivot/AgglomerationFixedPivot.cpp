@@ -31,15 +31,14 @@ void CAgglomerationFixedPivot::Initialize()
 	pivotPoints.push_back(pivotPoints.back() + pivotPoints[1] * 0.5);
 	pivotPoints.push_back(pivotPoints.back() * 2);
 
-	beta.resize(n, d_vect_t(n));
+	const d_vect_t volumes(pivotPoints.begin() + 1, pivotPoints.begin() + 1 + n);
+	beta = TabulateKernel(volumes, volumes);
+
 	target.resize(n, u_vect_t(n));
 	ParallelFor(n, [&](size_t i)
 	{
 		for (size_t j = 0; j < n; ++j)
-		{
-			beta[i][j] = Kernel(pivotPoints[i + 1], pivotPoints[j + 1]);
 			target[i][j] = std::lower_bound(pivotPoints.begin(), pivotPoints.end(), pivotPoints[i + 1] + pivotPoints[j + 1]) - pivotPoints.begin() - 1;
-		}
 	});
 }
 
@@ -60,6 +59,7 @@ void CAgglomerationFixedPivot::Calculate(const d_vect_t& _n, d_vect_t& _rateB, d
 
 void CAgglomerationFixedPivot::ApplyFixedPivot(const d_vect_t& _f, d_vect_t& _rateB, d_vect_t& _rateD)
 {
+	const d_matr_t& beta = *this->beta;
 	for (size_t i = 0; i < n; ++i)
 		for (size_t j = 0; j <= i; ++j)
 		{
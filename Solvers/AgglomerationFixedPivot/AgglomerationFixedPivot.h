@@ -8,7 +8,7 @@
 class CAgglomerationFixedPivot : public CAgglomerationSolver
 {
 	size_t n{};				// Number of size-intervals.
-	d_matr_t beta;			// Precalculated kernel.
+	std::shared_ptr<const d_matr_t> beta;	// Precalculated kernel, shared between solvers with identical settings.
 	u_matr_t target;
 	d_vect_t pivotPoints;
 
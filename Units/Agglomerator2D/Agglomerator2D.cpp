@@ -0,0 +1,195 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#define DLL_EXPORT
+#include "Agglomerator2D.h"
+#include "DistributionsFunctions.h"
+#include "DyssolUtilities.h"
+#include "ContainerFunctions.h"
+
+extern "C" DECLDIR CBaseUnit* DYSSOL_CREATE_MODEL_FUN()
+{
+	return new CAgglomerator2D();
+}
+
+void CAgglomerator2D::CreateBasicInfo()
+{
+	/// Set basic unit info ///
+	SetUnitName("Agglomerator 2D");
+	SetAuthorName("DyssolTEC");
+	SetUniqueID("5A3F0C7D9E2B4E8A9C61D4B27F08E3A5");
+	SetHelpLink("003_models/unit_agglomerator2d.html");
+}
+
+void CAgglomerator2D::CreateStructure()
+{
+	/// Add ports ///
+	AddPort("Input" , EUnitPort::INPUT);
+	AddPort("Output", EUnitPort::OUTPUT);
+
+	/// Add unit parameters ///
+	AddConstRealParameter("Beta0", 1, "-", "Rate factor", 0);
+	AddConstRealParameter("Step", 0, "s", "Max time step in DAE solver", 0);
+	/// Add possibility to choose external agglomeration calculator ///
+	AddSolverAgglomeration2D("Solver", "Two-dimensional agglomeration solver");
+	AddComboParameter("Kernel", E2I(CAgglomerationSolver::EKernels::BROWNIAN),
+		E2I({ CAgglomerationSolver::EKernels::CONSTANT, CAgglomerationSolver::EKernels::SUM, CAgglomerationSolver::EKernels::PRODUCT, CAgglomerationSolver::EKernels::BROWNIAN, CAgglomerationSolver::EKernels::SHEAR, CAgglomerationSolver::EKernels::PEGLOW, CAgglomerationSolver::EKernels::COAGULATION, CAgglomerationSolver::EKernels::GRAVITATIONAL, CAgglomerationSolver::EKernels::EKE, CAgglomerationSolver::EKernels::THOMPSON }),
+		{ "Constant","Sum","Product","Brownian","Shear","Peglow","Coagulation","Gravitational","Kinetic energy","Thompson" },
+		"Agglomeration kernel");
+	AddComboParameter("Property type", E2I(CAgglomeration2DSolver::EPropertyType::AVERAGED),
+		E2I({ CAgglomeration2DSolver::EPropertyType::ADDITIVE, CAgglomeration2DSolver::EPropertyType::AVERAGED }),
+		{ "Additive", "Averaged" },
+		"How the second distributed property of an agglomerate is obtained from the agglomerating particles");
+	AddConstRealParameter("Relative tolerance", 0.0, "-", "Solver relative tolerance. Set to 0 to use flowsheet-wide value", 0.0);
+	AddConstRealParameter("Absolute tolerance", 0.0, "-", "Solver absolute tolerance. Set to 0 to use flowsheet-wide value", 0.0);
+
+	/// Add holdups ///
+	AddHoldup("Holdup");
+
+	/// Set this unit as user data of model ///
+	m_model.SetUserData(this);
+}
+
+void CAgglomerator2D::Initialize(double _time)
+{
+	/// Check flowsheet parameters ///
+	if (!IsPhaseDefined(EPhase::SOLID))		RaiseError("Solid phase has not been defined.");
+	if (!IsDistributionDefined(DISTR_SIZE))	RaiseError("Size distribution has not been defined.");
+	/// The first distributed property except compounds and size is used as the second property ///
+	const auto distributions = GetDistributionsTypes();
+	const auto property = std::find_if(distributions.begin(), distributions.end(), [](EDistrTypes _type) { return _type != DISTR_COMPOUNDS && _type != DISTR_SIZE; });
+	if (property == distributions.end())
+		RaiseError("Second distributed property has not been defined.");
+	m_property = *property;
+
+	/// Get pointers to streams and holdups ///
+	m_holdup = GetHoldup("Holdup");
+	m_inStream = GetPortStream("Input");
+	m_outStream = GetPortStream("Output");
+
+	/// Get number of classes ///
+	m_classesNum = GetClassesNumber(DISTR_SIZE);
+	m_classesNum2 = GetClassesNumber(m_property);
+	/// Get grid of PSD ///
+	m_sizeGrid = GetNumericGrid(DISTR_SIZE);
+
+	/// Clear all state variables in model ///
+	m_model.ClearVariables();
+
+	/// Add state variables to a model ///
+	m_model.m_iN = m_model.AddDAEVariables(true, GetNumbers(m_holdup, _time), 0); // Initial number distribution
+
+	/// Set tolerances to model ///
+	const auto rtol = GetConstRealParameterValue("Relative tolerance");
+	const auto atol = GetConstRealParameterValue("Absolute tolerance");
+	m_model.SetTolerance(rtol != 0.0 ? rtol : GetRelTolerance(), atol != 0.0 ? atol : GetAbsTolerance());
+
+	/// Set model to a solver ///
+	const double maxStep = GetConstRealParameterValue("Step");
+	if (maxStep != 0.0)
+		m_solver.SetMaxStep(maxStep);
+	if (!m_solver.SetModel(&m_model))
+		RaiseError(m_solver.GetError());
+
+	/// Initialize agglomeration calculator ///
+	m_aggSolver = GetSolverAgglomeration2D("Solver");
+	if (!m_aggSolver)
+	{
+		RaiseError("Cannot load Solver");
+		return;
+	}
+	/// Set parameters ///
+	m_aggSolver->Initialize(m_sizeGrid, GetNumericGrid(m_property),
+		V2E<CAgglomeration2DSolver::EPropertyType>(GetComboParameterValue("Property type")),
+		GetConstRealParameterValue("Beta0"),
+		V2E<CAgglomerationSolver::EKernels>(GetComboParameterValue("Kernel")));
+}
+
+void CAgglomerator2D::SaveState()
+{
+	m_solver.SaveState();
+}
+
+void CAgglomerator2D::LoadState()
+{
+	m_solver.LoadState();
+}
+
+void CAgglomerator2D::Simulate(double _timeBeg, double _timeEnd)
+{
+	if (!m_solver.Calculate(_timeBeg, _timeEnd))
+		RaiseError(m_solver.GetError());
+}
+
+std::vector<double> CAgglomerator2D::GetNumbers(const CBaseStream* _stream, double _time) const
+{
+	// all particles in a size class have the same mass, so numbers are split between property classes as their masses
+	const std::vector<double> numbers = _stream->GetPSD(_time, PSD_Number);
+	const CMatrix2D fractions = _stream->GetDistribution(_time, DISTR_SIZE, m_property);
+	std::vector<double> res(m_classesNum * m_classesNum2, 0.0);
+	for (size_t i = 0; i < m_classesNum; ++i)
+	{
+		const double sum = VectorSum(fractions[i]);
+		if (sum <= 0.0) continue;
+		for (size_t j = 0; j < m_classesNum2; ++j)
+			res[j * m_classesNum + i] = numbers[i] * fractions[i][j] / sum;
+	}
+	return res;
+}
+
+void CAgglomerator2D::SetNumbers(CBaseStream* _stream, double _time, const double* _numbers) const
+{
+	std::vector<double> numbers(m_classesNum, 0.0);
+	for (size_t j = 0; j < m_classesNum2; ++j)
+		for (size_t i = 0; i < m_classesNum; ++i)
+			numbers[i] += _numbers[j * m_classesNum + i];
+	const std::vector<double> masses = ConvertNumbersToMassFractions(m_sizeGrid, numbers);
+	CMatrix2D fractions(m_classesNum, m_classesNum2);
+	for (size_t i = 0; i < m_classesNum; ++i)
+	{
+		if (numbers[i] <= 0.0) continue;
+		for (size_t j = 0; j < m_classesNum2; ++j)
+			fractions[i][j] = masses[i] * _numbers[j * m_classesNum + i] / numbers[i];
+	}
+	_stream->SetDistribution(_time, DISTR_SIZE, m_property, fractions);
+}
+
+void CUnitDAEModel::ResultsHandler(double _time, double* _vars, double* _ders, void* _unit)
+{
+	auto* unit = static_cast<CAgglomerator2D*>(_unit);
+
+	unit->m_holdup->AddTimePoint(_time);
+
+	const double holdupMass = unit->m_holdup->GetMass(_time);
+	unit->m_holdup->AddStream(std::max(unit->m_inStream->GetPreviousTimePoint(_time), unit->m_holdup->GetPreviousTimePoint(_time)), _time, unit->m_inStream);
+	unit->m_holdup->RemoveTimePointsAfter(_time);
+	unit->m_holdup->SetMass(_time, holdupMass);
+
+	unit->SetNumbers(unit->m_holdup, _time, _vars + m_iN.front());
+
+	const double outMass = unit->m_inStream->GetMassFlow(_time); // equal to in mass flow
+	unit->m_outStream->CopyFromHoldup(_time, unit->m_holdup, outMass);
+}
+
+void CUnitDAEModel::CalculateResiduals(double _time, double* _vars, double* _ders, double* _res, void* _unit)
+{
+	const auto* unit = static_cast<CAgglomerator2D*>(_unit);
+
+	const double inMass = unit->m_inStream->GetMassFlow(_time);
+	const double holdupMass = unit->m_holdup->GetMass(_time);
+	const double outMass = inMass;
+
+	const std::vector<double> Ninlet = unit->GetNumbers(unit->m_inStream, _time);
+
+	// Call agglomeration function
+	const size_t len = m_iN.size();
+	std::vector<double> BRate, DRate;
+	unit->m_aggSolver->Calculate(std::vector<double>(_vars + m_iN.front(), _vars + m_iN.front() + len), BRate, DRate);
+
+	// Calculate derivatives
+	for (size_t i = 0; i < len; ++i)
+	{
+		const double der = BRate[i] - DRate[i] + Ninlet[i] - _vars[m_iN[i]] / holdupMass * outMass;
+		_res[m_iN[i]] = _ders[m_iN[i]] - der;
+	}
+}
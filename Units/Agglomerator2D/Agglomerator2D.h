@@ -0,0 +1,51 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "DynamicUnit.h"
+#include "DAESolver.h"
+#include "Stream.h"
+
+class CUnitDAEModel : public CDAEModel
+{
+public:
+	/// Indexes of state variables for solver ///
+	std::vector<size_t> m_iN{}; // Two-dimensional number distribution
+
+public:
+	void CalculateResiduals(double _time, double* _vars, double* _ders, double* _res, void* _unit) override;
+	void ResultsHandler(double _time, double* _vars, double* _ders, void* _unit) override;
+};
+
+class CAgglomerator2D : public CDynamicUnit
+{
+private:
+	CUnitDAEModel m_model{};
+	CDAESolver m_solver{};
+
+public:
+	CAgglomeration2DSolver* m_aggSolver{};	// External agglomeration calculator
+
+	CHoldup* m_holdup{};					// Internal holdup
+	CMaterialStream* m_inStream{};			// Inlet
+	CMaterialStream* m_outStream{};			// Outlet
+
+	EDistrTypes m_property{};				// Second distributed property
+	size_t m_classesNum{};					// Number of classes for PSD
+	size_t m_classesNum2{};					// Number of classes of the second property
+	std::vector<double> m_sizeGrid;			// Size grid for PSD
+
+public:
+	void CreateBasicInfo() override;
+	void CreateStructure() override;
+	void Initialize(double _time) override;
+	void SaveState() override;
+	void LoadState() override;
+	void Simulate(double _timeBeg, double _timeEnd) override;
+
+	// Returns the two-dimensional number distribution of the stream as a plain array [property x size].
+	std::vector<double> GetNumbers(const CBaseStream* _stream, double _time) const;
+	// Sets the two-dimensional distribution of the stream from a plain array of numbers [property x size].
+	void SetNumbers(CBaseStream* _stream, double _time, const double* _numbers) const;
+};
@@ -2,6 +2,7 @@
 
 #define DLL_EXPORT
 #include "Crusher.h"
+#include "GridTransfer.h"
 
 extern "C" DECLDIR CBaseUnit* DYSSOL_CREATE_MODEL_FUN()
 {
@@ -162,12 +163,19 @@ void CCrusher::SimulateBondNormal(double _time)
 
 void CCrusher::InitializeBondBimodal(double _time)
 {
-	// add internal material stream
-	m_internal = AddStream("TempStream");
-
 	// configure transformation matrix
 	m_transform.Clear();
 	m_transform.SetDimensions(DISTR_SIZE, static_cast<unsigned>(m_classesNumber));
+
+	// redistribution of each class if all material is crushed: particles are halved by volume, so the grid shrinks by 2^(1/3)
+	std::vector<double> halved(m_grid.size());
+	std::transform(m_grid.begin(), m_grid.end(), halved.begin(), [](double _d) { return _d / std::pow(2, 1. / 3.); });
+	const auto transfer = CDimensionTransfer::Get(halved, m_grid);
+	m_breakage.assign(m_classesNumber, {});
+	for (size_t i = 0; i < m_classesNumber; ++i)
+		for (const auto& [j, fraction] : transfer->GetWeights(i))
+			if (j != i && j != 0) // the own class only keeps the uncrushed material, material crushed into the first class is discarded
+				m_breakage[i].emplace_back(j, fraction);
 }
 
 void CCrusher::SimulateBondBimodal(double _time)
@@ -206,69 +214,69 @@ void CCrusher::SimulateBondBimodal(double _time)
 
 		const double bondIndex = m_inlet->GetCompoundProperty(compound, BOND_WORK_INDEX);
 		const double x80Out = 1. / std::pow(workInput / (10 * bondIndex) + 1. / std::sqrt(x80In * 1000), 2) / 1000;
-		double x80New = x80In;
+		const double tolerance = 1e-4 * x80Out; // allowed deviation between d80's is 0.01%
+		if (std::fabs(x80In - x80Out) <= tolerance) continue;
+
+		// search for suitable transformation only on PSD: all material is crushed several times, and then a part of it once more
+		size_t fullCrushes = 0;				// number of crushes of all material
+		double currentFraction = 1;			// mass fraction of material, which is crushed once more
+		std::vector<double> psd = psdIn;	// PSD after all full crushes
+		std::vector<double> psdNew = CrushBondBimodal(psd, 1);
+		double x80New = CalculateX80(psdNew);
+		while (x80New > x80Out + tolerance)
+		{
+			if (++fullCrushes == 100)
+				RaiseError("Cannot reach x80 = " + StringFunctions::Double2String(x80Out) + ". Current value " + StringFunctions::Double2String(x80New));
+			if (HasError()) return;
+			psd = std::move(psdNew);
+			psdNew = CrushBondBimodal(psd, 1);
+			x80New = CalculateX80(psdNew);
+		}
 
-		// iterative search for suitable transformation
-		size_t iteration = 0;
-		double currentFraction = 1;                        // currently assumed mass fraction of material which will be crushed
-		double stepFactor = 1;                             // initial factor for increase/decrease
-		while (std::fabs(x80New - x80Out) > 1e-4 * x80Out) // allowed deviation between d80's is 0.01%
+		// bracketed search for the crushed fraction with the Illinois method
+		if (std::fabs(x80New - x80Out) > tolerance)
 		{
-			m_transform.ClearData();
-			m_internal->CopyFromStream(_time, m_outlet);
-			ParallelFor(m_classesNumber, [&](size_t i)
+			double lFraction = 0, lValue = CalculateX80(psd) - x80Out;
+			double rFraction = 1, rValue = x80New - x80Out;
+			for (size_t iteration = 0;; ++iteration)
 			{
-				// get left and right diameters of initial class on new grid
-				const double lDiameter = m_grid[i] / std::pow(2, 1. / 3.);
-				double rDiameter = m_grid[i + 1] / std::pow(2, 1. / 3.);
-				const double totalLength = rDiameter - lDiameter;
-
-				// redistribute between classes on new grid
-				unsigned iRClass = (unsigned)i + 1;
-				while (iRClass > 0 && m_grid[iRClass] > rDiameter)
-					iRClass--;
-				while (iRClass > 0 && m_grid[iRClass] >= lDiameter)
+				currentFraction = (lFraction * rValue - rFraction * lValue) / (rValue - lValue);
+				const double value = CalculateX80(CrushBondBimodal(psd, currentFraction)) - x80Out;
+				if (std::fabs(value) <= tolerance) break;
+				if (iteration == 100)
+					RaiseError("Cannot reach x80 = " + StringFunctions::Double2String(x80Out) + ". Current value " + StringFunctions::Double2String(value + x80Out));
+				if (HasError()) return;
+				if ((value > 0) == (lValue > 0))
 				{
-					const double fraction = (rDiameter - m_grid[iRClass]) / totalLength;
-					rDiameter = m_grid[iRClass];
-					m_transform.SetValue((unsigned)i, iRClass, currentFraction * fraction);
-					iRClass--;
+					lFraction = currentFraction;
+					lValue = value;
+					rValue /= 2;
 				}
-				if (iRClass != 0)
-				{
-					const double fraction = std::min(1., (m_grid[iRClass + 1] - lDiameter) / totalLength);
-					m_transform.SetValue((unsigned)i, iRClass, currentFraction * fraction);
-				}
-				m_transform.SetValue((unsigned)i, (unsigned)i, 1 - currentFraction);
-			});
-			m_internal->ApplyTM(_time, compound, m_transform);
-			x80New = GetDistributionValue(m_grid, m_internal->GetPSD(_time, PSD_Q3, compound), 0.8);
-			if (x80New > x80Out)
-			{
-				if (currentFraction == 1) // directly perform total transformation
-					m_outlet->ApplyTM(_time, compound, m_transform);
 				else
 				{
-					if (stepFactor < 0)
-						stepFactor *= -0.5; // change magnitude and direction of search
-					currentFraction += stepFactor;
+					rFraction = currentFraction;
+					rValue = value;
+					lValue /= 2;
 				}
 			}
-			else
-			{
-				if (stepFactor > 0)
-					stepFactor *= -0.5; // change magnitude and direction of search
-				currentFraction += stepFactor;
-			}
+		}
 
-			if (iteration == 100)
-				RaiseError("Cannot reach x80 = " + StringFunctions::Double2String(x80Out) + ". Current value " + StringFunctions::Double2String(x80New));
-			iteration++;
+		// combine all crushes into one transformation matrix
+		m_transform.ClearData();
+		ParallelFor(m_classesNumber, [&](size_t i)
+		{
+			std::vector<double> row(m_classesNumber, 0);
+			row[i] = 1;
+			for (size_t k = 0; k < fullCrushes; ++k)
+				row = CrushBondBimodal(row, 1);
+			row = CrushBondBimodal(row, currentFraction);
+			for (size_t j = 0; j <= i; ++j)
+				if (row[j] != 0)
+					m_transform.SetValue(static_cast<unsigned>(i), static_cast<unsigned>(j), row[j]);
+		});
 
-			if (HasError()) return;
-		}
 		// set result to output
-		m_outlet->ApplyTM(_time, compound, m_transform); // apply rest
+		m_outlet->ApplyTM(_time, compound, m_transform);
 	}
 
 	// component-wise correction of compounds fractions
@@ -276,6 +284,24 @@ void CCrusher::SimulateBondBimodal(double _time)
 		m_outlet->SetCompoundFraction(_time, compound, EPhase::SOLID, m_inlet->GetCompoundFraction(_time, compound, EPhase::SOLID));
 }
 
+std::vector<double> CCrusher::CrushBondBimodal(const std::vector<double>& _psd, double _fraction) const
+{
+	std::vector<double> res(m_classesNumber, 0);
+	for (size_t i = 0; i < m_classesNumber; ++i)
+	{
+		if (_psd[i] == 0) continue;
+		res[i] += (1 - _fraction) * _psd[i];
+		for (const auto& [j, fraction] : m_breakage[i])
+			res[j] += _fraction * fraction * _psd[i];
+	}
+	return res;
+}
+
+double CCrusher::CalculateX80(const std::vector<double>& _psd) const
+{
+	return GetDistributionValue(m_grid, ConvertMassFractionsToQ3(Normalized(_psd)), 0.8);
+}
+
 void CCrusher::InitializeCone(double _time)
 {
 	// get unit parameters
@@ -13,13 +13,13 @@ class CCrusher : public CSteadyStateUnit
 
 	CMaterialStream* m_inlet{ nullptr };	// Pointer to inlet stream.
 	CMaterialStream* m_outlet{ nullptr };	// Pointer to outlet stream.
-	CMaterialStream* m_internal{ nullptr };	// Pointer to internal stream.
 	CTransformMatrix m_transform;			// Transformation matrix.
 	size_t m_classesNumber{};				// Number of PSD classes.
 	std::vector<double> m_grid;				// Diameter grid for PSD.
 	std::vector<double> m_diameters;		// Mean diameters for each grid class.
 	std::vector<std::string> m_compounds;	// List of keys for defined compounds.
 	EModels m_model{ EModels::Const };		// Chosen crusher model.
+	std::vector<std::vector<std::pair<size_t, double>>> m_breakage;	// Redistribution of each class into smaller classes if all material is crushed, for bimodal Bond model.
 
 public:
 	void CreateBasicInfo() override;
@@ -32,6 +32,10 @@ public:
 
 	void InitializeBondBimodal(double _time);
 	void SimulateBondBimodal(double _time);
+	// Returns mass fractions after crushing of the given fraction of material with the bimodal Bond model.
+	std::vector<double> CrushBondBimodal(const std::vector<double>& _psd, double _fraction) const;
+	// Returns x80 of the given mass fractions.
+	double CalculateX80(const std::vector<double>& _psd) const;
 
 	void InitializeCone(double _time);
 	void SimulateCone(double _time);
@@ -2,6 +2,67 @@
 
 #define DLL_EXPORT
 #include "CrusherPBMTM.h"
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+	// Breakage tables calculated for a specific grid and breakage parameters.
+	struct SBreakageTables
+	{
+		std::vector<std::vector<double>> B;
+		std::vector<double> nu;
+	};
+
+	// Breakage tables shared by all units with identical grid and breakage parameters.
+	std::map<std::vector<double>, std::shared_ptr<const SBreakageTables>> breakageTablesCache;
+	std::mutex breakageTablesMutex;
+
+	// Multiplies two square matrices, skipping zero entries of the first matrix. Effective for triangular matrices.
+	CMatrix2D Multiply(const CMatrix2D& _a, const CMatrix2D& _b)
+	{
+		const size_t n = _a.Rows();
+		CMatrix2D res(n, n);
+		ParallelFor(n, [&](size_t i)
+		{
+			auto& row = res[i];
+			for (size_t k = 0; k < n; ++k)
+			{
+				const double a = _a[i][k];
+				if (a == 0.0) continue;
+				const auto& b = _b[k];
+				for (size_t j = 0; j < n; ++j)
+					row[j] += a * b[j];
+			}
+		});
+		return res;
+	}
+
+	// Returns transposed square matrix.
+	CMatrix2D Transpose(const CMatrix2D& _m)
+	{
+		const size_t n = _m.Rows();
+		CMatrix2D res(n, n);
+		for (size_t i = 0; i < n; ++i)
+			for (size_t j = 0; j < n; ++j)
+				res[j][i] = _m[i][j];
+		return res;
+	}
+
+	// Calculates maximum absolute row sum of the matrix.
+	double NormInf(const CMatrix2D& _m)
+	{
+		double res = 0;
+		for (size_t i = 0; i < _m.Rows(); ++i)
+		{
+			double sum = 0;
+			for (const double v : _m[i])
+				sum += std::fabs(v);
+			res = std::max(res, sum);
+		}
+		return res;
+	}
+}
 
 extern "C" DECLDIR CBaseUnit* DYSSOL_CREATE_MODEL_FUN()
 {
@@ -42,7 +103,7 @@ void CCrusherPBMTM::CreateStructure()
 	AddConstRealParameter("B3"     , 5   , "-", "Parameter of Breakage function"              );
 	AddConstRealParameter("dt_min" , 0   , "s", "Minimum time step for integration"  , 0, 1e+9);
 	AddConstRealParameter("dt_max" , 1e+9, "s", "Maximum time step for integration"  , 0, 1e+9);
-	AddComboParameter("Method", E2I(EMethod::NEWTON), { E2I(EMethod::NEWTON), E2I(EMethod::KR2) }, { "Newton", "Runge-Kutta" },	"Method for calculating transformation matrices");
+	AddComboParameter("Method", E2I(EMethod::NEWTON), { E2I(EMethod::NEWTON), E2I(EMethod::KR2), E2I(EMethod::EXPONENTIAL) }, { "Newton", "Runge-Kutta", "Exponential" },	"Method for calculating transformation matrices");
 
 	AddParametersToGroup("Selection", "Constant",    { "S1" });
 	AddParametersToGroup("Selection", "Linear",      { });
@@ -102,12 +163,14 @@ void CCrusherPBMTM::Initialize(double _time)
 
 	/// Precalculate values
 	m_S = CalculateSelectionFunction(m_means);
-	m_B = CalculateBreakageFunction(m_means);
-	m_nu = CalculateNu(m_means);
+	CalculateBreakageTables(m_means);
 	m_WB = CalculateBirthWeights(m_means);
 	m_WD = CalculateDeathWeights(m_means);
 	m_PT = CalculateBaseTransformationMatrix();
+	m_PTT = Transpose(m_PT);
+	m_PT2 = m_method == EMethod::KR2 ? Multiply(m_PT, m_PT) : CMatrix2D{};
 	m_I = CMatrix2D::Identity(m_classesNum);
+	m_TMCache.clear();
 }
 
 void CCrusherPBMTM::Simulate(double _timeBeg, double _timeEnd)
@@ -115,20 +178,29 @@ void CCrusherPBMTM::Simulate(double _timeBeg, double _timeEnd)
 	if (_timeBeg == 0)
 		m_outStream->CopyFromHoldup(0, m_holdup, m_inStream->GetMassFlow(0));
 
+	// matrix exponential is stable for any time step, so its steps are only limited to resolve changes of the inlet
+	const std::vector<double> inletTimes = m_method == EMethod::EXPONENTIAL ? m_inStream->GetTimePoints(_timeBeg, _timeEnd) : std::vector<double>{};
+
 	double t1 = _timeBeg;
 	while (t1 < _timeEnd)
 	{
-		const double dtCalc = m_dtMin == m_dtMax ? m_dtMin : MaxTimeStep(_timeEnd - t1, m_holdup->GetPSD(t1, PSD_q0, EPSDGridType::VOLUME));
-		const double dtTemp = std::min(m_dtMax, std::max(m_dtMin, dtCalc));
+		double dtTemp;
+		if (m_method == EMethod::EXPONENTIAL)
+		{
+			dtTemp = m_dtMax;
+			if (const auto next = std::upper_bound(inletTimes.begin(), inletTimes.end(), t1); next != inletTimes.end())
+				dtTemp = std::min(dtTemp, *next - t1);
+		}
+		else
+		{
+			const double dtCalc = m_dtMin == m_dtMax ? m_dtMin : MaxTimeStep(_timeEnd - t1, m_holdup->GetPSD(t1, PSD_q0, EPSDGridType::VOLUME));
+			dtTemp = std::min(m_dtMax, std::max(m_dtMin, dtCalc));
+		}
 		const double dt = t1 + dtTemp < _timeEnd ? dtTemp : _timeEnd - t1;
 		const double t2 = t1 + dt;
 
 		m_holdup->AddStream(t1, t2, m_inStream);
-		switch (m_method)
-		{
-		case EMethod::NEWTON:	CalculateTransformationMatrixNewton(dt);	break;
-		case EMethod::KR2:		CalculateTransformationMatrixRK2(dt);		break;
-		}
+		CalculateTransformationMatrix(dt);
 		m_holdup->ApplyTM(t2, m_TM);
 		m_holdup->SetMass(t2, m_holdupMass);
 		m_outStream->CopyFromHoldup(t2, m_holdup, m_inStream->GetMassFlow(_timeEnd));
@@ -150,7 +222,7 @@ std::vector<double> CCrusherPBMTM::CalculateSelectionFunction(const std::vector<
 	return res;
 }
 
-std::vector<std::vector<double>> CCrusherPBMTM::CalculateBreakageFunction(const std::vector<double>& _x)
+std::vector<std::vector<double>> CCrusherPBMTM::CalculateBreakageFunction(const std::vector<double>& _x) const
 {
 	std::vector<std::vector<double>> res(m_classesNum, std::vector<double>(m_classesNum, 0));
 	ParallelFor(m_classesNum, [&](size_t i)
@@ -164,65 +236,142 @@ std::vector<std::vector<double>> CCrusherPBMTM::CalculateBreakageFunction(const
 	return res;
 }
 
+void CCrusherPBMTM::CalculateBreakageTables(const std::vector<double>& _x)
+{
+	// tables depend only on the grid and breakage parameters
+	std::vector<double> key{ static_cast<double>(E2I(m_breakageFun)), m_b1, m_b2, m_b3 };
+	key.insert(key.end(), m_grid.begin(), m_grid.end());
+	key.insert(key.end(), _x.begin(), _x.end());
+
+	std::shared_ptr<const SBreakageTables> tables;
+	{
+		std::lock_guard lock{ breakageTablesMutex };
+		if (const auto it = breakageTablesCache.find(key); it != breakageTablesCache.end())
+			tables = it->second;
+	}
+	if (!tables)
+	{
+		auto calculated = std::make_shared<SBreakageTables>();
+		calculated->B = CalculateBreakageFunction(_x);
+		calculated->nu = CalculateNu(_x);
+		tables = calculated;
+		std::lock_guard lock{ breakageTablesMutex };
+		if (breakageTablesCache.size() >= 16)
+			breakageTablesCache.clear();
+		breakageTablesCache[key] = tables;
+	}
+
+	m_B = tables->B;
+	m_nu = tables->nu;
+}
+
 std::vector<double> CCrusherPBMTM::CalculateNu(const std::vector<double>& _x) const
 {
 	std::vector<double> res(m_classesNum, 0);
-	for (size_t i = 0; i < m_classesNum; ++i)
+	ParallelFor(m_classesNum, [&](size_t i)
+	{
 		res[i] = AdaptiveSimpsons(0, _x[i], _x[i], 1.e-15, 10);
+	});
 	return res;
 }
 
 std::vector<double> CCrusherPBMTM::CalculateBirthWeights(const std::vector<double>& _x) const
 {
 	std::vector<double> res(m_classesNum, 0);
-	for (size_t i = 0; i < m_classesNum; ++i)
+	ParallelFor(m_classesNum, [&](size_t i)
 	{
 		double sum = 0.;
 		for (size_t j = 0; j < i; ++j)
 			sum += (_x[i] - _x[j]) * m_B[j][i];
 		if (sum != 0)
 			res[i] = _x[i] * (m_nu[i] - 1) / sum;
-	}
+	});
 	return res;
 }
 
 std::vector<double> CCrusherPBMTM::CalculateDeathWeights(const std::vector<double>& _x) const
 {
 	std::vector<double> res(m_classesNum, 0);
-	for (size_t i = 0; i < m_classesNum; ++i)
+	ParallelFor(m_classesNum, [&](size_t i)
 	{
 		double sum = 0.;
 		for (size_t j = 0; j <= i; ++j)
 			sum += _x[j] * m_B[j][i];
 		res[i] = m_WB[i] / _x[i] * sum;
-	}
+	});
 	return res;
 }
 
 CMatrix2D CCrusherPBMTM::CalculateBaseTransformationMatrix() const
 {
 	CMatrix2D res(m_classesNum, m_classesNum);
-	for (size_t i = 0; i < m_classesNum; ++i)
+	ParallelFor(m_classesNum, [&](size_t i)
+	{
 		res[i][i] = (m_WB[i] * m_B[i][i] - m_WD[i]) * m_S[i];
-	for (size_t i = 1; i < m_classesNum; ++i)
 		for (size_t j = 0; j < i; ++j)
 			res[i][j] = m_WB[i] * m_B[j][i] * m_S[i] / (m_means[i] / m_means[j]) / (m_sizes[i] / m_sizes[j]); // scaling from numbers to mass fractions;
+	});
 	return res;
 }
 
-void CCrusherPBMTM::CalculateTransformationMatrixNewton(double _dt)
+void CCrusherPBMTM::CalculateTransformationMatrix(double _dt)
 {
-	const CMatrix2D tm = m_PT * _dt + m_I;
-	m_TM.SetMatrix(tm);
+	// the matrix depends only on the time step, so it is calculated once for each time step
+	auto it = m_TMCache.find(_dt);
+	if (it == m_TMCache.end())
+	{
+		if (m_TMCache.size() >= m_TMCacheSize)
+			m_TMCache.clear();
+		switch (m_method)
+		{
+		case EMethod::NEWTON:		it = m_TMCache.emplace(_dt, CalculateTransformationMatrixNewton(_dt)).first;		break;
+		case EMethod::KR2:			it = m_TMCache.emplace(_dt, CalculateTransformationMatrixRK2(_dt)).first;			break;
+		case EMethod::EXPONENTIAL:	it = m_TMCache.emplace(_dt, CalculateTransformationMatrixExponential(_dt)).first;	break;
+		}
+	}
+	m_TM.SetMatrix(it->second);
 }
 
-void CCrusherPBMTM::CalculateTransformationMatrixRK2(double _dt)
+CMatrix2D CCrusherPBMTM::CalculateTransformationMatrixNewton(double _dt) const
 {
-	const CMatrix2D M1 = m_PT * _dt + m_I;
-	const CMatrix2D A2 = m_PT * _dt / 2;
-	const CMatrix2D M2 = A2 + m_I;
-	const CMatrix2D tm = M1 * M2 - A2;
-	m_TM.SetMatrix(tm);
+	return m_PT * _dt + m_I;
+}
+
+CMatrix2D CCrusherPBMTM::CalculateTransformationMatrixRK2(double _dt) const
+{
+	// (I + A) * (I + A/2) - A/2 = I + A + A^2/2, with A = PT * dt
+	CMatrix2D tm(m_classesNum, m_classesNum);
+	ParallelFor(m_classesNum, [&](size_t i)
+	{
+		for (size_t j = 0; j < m_classesNum; ++j)
+			tm[i][j] = m_I[i][j] + m_PT[i][j] * _dt + m_PT2[i][j] * _dt * _dt / 2;
+	});
+	return tm;
+}
+
+CMatrix2D CCrusherPBMTM::CalculateTransformationMatrixExponential(double _dt) const
+{
+	// exp(A) with A = PT * dt, calculated using scaling and squaring with Taylor series
+	CMatrix2D A = m_PT * _dt;
+	const double norm = NormInf(A);
+	const int squarings = norm > 0.5 ? static_cast<int>(std::ceil(std::log2(norm / 0.5))) : 0;
+	A *= std::pow(2., -squarings);
+
+	// Taylor series up to machine precision
+	CMatrix2D res = m_I + A;
+	CMatrix2D term = A;
+	for (size_t k = 2; k < 30; ++k)
+	{
+		term = Multiply(term, A) * (1. / static_cast<double>(k));
+		res += term;
+		if (NormInf(term) <= std::numeric_limits<double>::epsilon() * NormInf(res))
+			break;
+	}
+
+	for (int i = 0; i < squarings; ++i)
+		res = Multiply(res, res);
+
+	return res;
 }
 
 double CCrusherPBMTM::Selection(double _x) const
@@ -260,10 +409,15 @@ double CCrusherPBMTM::Breakage(double _x, double _y) const
 
 double CCrusherPBMTM::MaxTimeStep(double _dt, const std::vector<double>& _q0) const
 {
-	static CMatrix2D T1;
-	T1.Resize(1, m_classesNum);
-	T1.SetRow(0, _q0);
-	const std::vector<double> newq0 = (T1 * (m_PT * _dt + m_I)).GetRow(0);
+	// newq0 = q0 * (PT * dt + I), using transposed PT for sequential memory access
+	std::vector<double> newq0(m_classesNum);
+	ParallelFor(m_classesNum, [&](size_t j)
+	{
+		double sum = 0;
+		for (size_t i = j; i < m_classesNum; ++i)
+			sum += _q0[i] * m_PTT[j][i];
+		newq0[j] = _q0[j] + sum * _dt;
+	});
 
 	std::vector<double> FC(m_classesNum);
 	ParallelFor(m_classesNum, [&](size_t i)
@@ -3,12 +3,13 @@
 #pragma once
 
 #include "UnitDevelopmentDefines.h"
+#include <map>
 
 class CCrusherPBMTM : public CDynamicUnit
 {
 	enum class ESelection : size_t { CONSTANT = 0, LINEAR, QUADRATIC, POWER, EXPONENTIAL, KING, AUSTIN };
 	enum class EBreakage : size_t { BINARY = 0, DIEMER, VOGEL, AUSTIN };
-	enum class EMethod : size_t { NEWTON = 0, KR2 };
+	enum class EMethod : size_t { NEWTON = 0, KR2, EXPONENTIAL };
 
 	CMaterialStream* m_inStream{ nullptr };				// Pointer to input stream.
 	CMaterialStream* m_outStream{ nullptr };			// Pointer to output stream.
@@ -25,8 +26,12 @@ class CCrusherPBMTM : public CDynamicUnit
 	std::vector<double> m_WB;							// Weighted parameters for birth rate.
 	std::vector<double> m_WD;							// Weighted parameters for death rate.
 	CMatrix2D m_PT;										// Precalculated matrix to calculate transformation.
+	CMatrix2D m_PTT;									// Transposed m_PT.
+	CMatrix2D m_PT2;									// Squared m_PT.
 	CMatrix2D m_I;										// Identity matrix.
 	CTransformMatrix m_TM;								// Transformation matrix.
+	static constexpr size_t m_TMCacheSize{ 16 };		// Maximum number of cached transformation matrices.
+	std::map<double, CMatrix2D> m_TMCache;				// Already calculated transformation matrices for each time step. Cleared on initialization and when full.
 	double m_dtMin{};									// Minimum allowable time step for integration.
 	double m_dtMax{};									// Maximum allowable time step for integration.
 	ESelection m_selectionFun{ ESelection::CONSTANT };	// Chosen Selection function.
@@ -54,7 +59,10 @@ private:
 	/** \brief Calculates breakage function.
 	*  \param _x Volumes of particles.
 	*  \return Values of the breakage function for all _x. */
-	std::vector<std::vector<double>> CalculateBreakageFunction(const std::vector<double>& _x);
+	std::vector<std::vector<double>> CalculateBreakageFunction(const std::vector<double>& _x) const;
+	/** \brief Calculates breakage function and nu or takes them from the tables calculated for the same grid and parameters.
+	*  \param _x Volumes of particles. */
+	void CalculateBreakageTables(const std::vector<double>& _x);
 	/** \brief Calculates nu.
 	*  \param _x Volumes of particles. */
 	std::vector<double> CalculateNu(const std::vector<double>& _x) const;
@@ -67,10 +75,14 @@ private:
 	/** \brief Calculates base of the transformation matrix to use for further calculations. */
 	CMatrix2D CalculateBaseTransformationMatrix() const;
 
+	/** \brief Sets transformation matrix for the given time interval to m_TM, using already calculated matrices if possible.
+	*  \param _dt Time interval. */
+	void CalculateTransformationMatrix(double _dt);
 	/** \brief Calculates transformation matrix.
 	*  \param _dt Time interval. */
-	void CalculateTransformationMatrixNewton(double _dt);
-	void CalculateTransformationMatrixRK2(double _dt);
+	CMatrix2D CalculateTransformationMatrixNewton(double _dt) const;
+	CMatrix2D CalculateTransformationMatrixRK2(double _dt) const;
+	CMatrix2D CalculateTransformationMatrixExponential(double _dt) const;
 
 	/** \brief Calculates selection function for the given particle size.
 	*  \param _x Volume of particle.
@@ -86,13 +86,16 @@ void CSimpleGranulator::Initialize(double _time)
 	m_model.m_iG = m_model.AddDAEVariable(false, 1e-8, 0, 0);							// Growth rate
 	m_model.m_iq3 = m_model.AddDAEVariables(true, vPSD, 0, 1.0);						// Initial PSD
 
-	AddStateVariable("Atot", 1);
-	AddStateVariable("Mtot", m_holdup->GetMass(_time));
-	AddStateVariable("Mout", 0);
-	AddStateVariable("Mdust", 0);
-	AddStateVariable("G", 1e-8);
-	for (size_t i = 0; i < m_classesNum; ++i)
-		AddStateVariable("PSD" + std::to_string(i), vPSD[i]);
+	m_svAtot  = CStateVariableHandle{ AddStateVariable("Atot", 1) };
+	m_svMtot  = CStateVariableHandle{ AddStateVariable("Mtot", m_holdup->GetMass(_time)) };
+	m_svMout  = CStateVariableHandle{ AddStateVariable("Mout", 0) };
+	m_svMdust = CStateVariableHandle{ AddStateVariable("Mdust", 0) };
+	m_svG     = CStateVariableHandle{ AddStateVariable("G", 1e-8) };
+	m_svPSD   = CArrayStateVariableHandle{ AddArrayStateVariable("PSD", vPSD) };
+
+	/// Get handles to time-dependent parameters ///
+	m_Kos = GetTDParameterHandle("Kos");
+	m_moistureContent = GetTDParameterHandle("Granules moisture content");
 
 	/// Set tolerances to model ///
 	const auto rtol = GetConstRealParameterValue("Relative tolerance");
@@ -125,8 +128,8 @@ void CUnitDAEModel::ResultsHandler(double _time, double* _vars, double* _ders, v
 	auto* unit = static_cast<CSimpleGranulator*>(_unit);
 
 	const double mSolut = unit->m_inSolutStream->GetPhaseMassFlow(_time, EPhase::SOLID);	// Mass flow of solid phase in solution for current time
-	const double Kos = unit->GetTDParameterValue("Kos", _time);								// Overspray part in solution for current time
-	const double moistureContent = unit->GetTDParameterValue("Granules moisture content", _time);	// Moisture content of output granules [kg(liq)/kg(sol)]
+	const double Kos = unit->m_Kos(_time);													// Overspray part in solution for current time
+	const double moistureContent = unit->m_moistureContent(_time);							// Moisture content of output granules [kg(liq)/kg(sol)]
 	const double me = mSolut * (1 - Kos);													// Effective mass stream of the injected solution for current time
 	const double totLiqMass = (1 - Kos) * unit->m_inSolutStream->GetPhaseMassFlow(_time, EPhase::LIQUID) + unit->m_inNuclStream->GetPhaseMassFlow(_time, EPhase::LIQUID) + unit->m_inGasStream->GetPhaseMassFlow(_time, EPhase::LIQUID);
 	const double mInNucl = unit->m_inNuclStream->GetPhaseMassFlow(_time, EPhase::SOLID);	// Mass of input nuclei - solid part
@@ -171,13 +174,13 @@ void CUnitDAEModel::ResultsHandler(double _time, double* _vars, double* _ders, v
 	unit->m_outDustStream->SetPhaseFraction(_time, EPhase::LIQUID, 0);
 	unit->m_outDustStream->SetPhaseFraction(_time, EPhase::VAPOR, 1);
 
-	unit->SetStateVariable("Atot" , _vars[m_iAtot] , _time);
-	unit->SetStateVariable("Mtot" , _vars[m_iMtot] , _time);
-	unit->SetStateVariable("Mout" , _vars[m_iMout] , _time);
-	unit->SetStateVariable("Mdust", _vars[m_iMdust], _time);
-	unit->SetStateVariable("G"    , _vars[m_iG]    , _time);
-	for (size_t i = 0; i < unit->m_classesNum; ++i)
-		unit->SetStateVariable("PSD" + std::to_string(i), _vars[m_iq3[i]], _time);
+	unit->m_svAtot .SetValue(_vars[m_iAtot] , _time);
+	unit->m_svMtot .SetValue(_vars[m_iMtot] , _time);
+	unit->m_svMout .SetValue(_vars[m_iMout] , _time);
+	unit->m_svMdust.SetValue(_vars[m_iMdust], _time);
+	unit->m_svG    .SetValue(_vars[m_iG]    , _time);
+	if (!m_iq3.empty())
+		unit->m_svPSD.SetValues(&_vars[m_iq3.front()], _time);
 }
 
 void CUnitDAEModel::CalculateResiduals(double _time, double* _vars, double* _ders, double* _res, void* _unit)
@@ -193,8 +196,8 @@ void CUnitDAEModel::CalculateResiduals(double _time, double* _vars, double* _der
 	const double totGasMass = unit->m_inGasStream->GetMassFlow(_time);
 	const double mSusp = unit->m_inSolutStream->GetPhaseMassFlow(_time, EPhase::SOLID);					// Mass flow of solid phase in solution for current time
 	const double mNotSol = unit->m_inSolutStream->GetMassFlow(_time) - mSusp;							// Mass flow of all phases except solid in solution for current time
-	const double Kos = unit->GetTDParameterValue("Kos", _time);											// Overspray part in solution for current time
-	const double moistureContent = unit->GetTDParameterValue("Granules moisture content", _time);		// Moisture content of output granules [kg(liq)/kg(sol)]
+	const double Kos = unit->m_Kos(_time);																// Overspray part in solution for current time
+	const double moistureContent = unit->m_moistureContent(_time);										// Moisture content of output granules [kg(liq)/kg(sol)]
 	const double me = mSusp * (1 - Kos);																// Effective mass stream of the injected solution for current time
 	const double totLiqMass = (1 - Kos) * unit->m_inSolutStream->GetPhaseMassFlow(_time, EPhase::LIQUID) + unit->m_inNuclStream->GetPhaseMassFlow(_time, EPhase::LIQUID) + unit->m_inGasStream->GetPhaseMassFlow(_time, EPhase::LIQUID);
 	const double solutSolDens = unit->m_inSolutStream->GetPhaseProperty(_time, EPhase::SOLID, DENSITY);	// Density of the solid in the solution
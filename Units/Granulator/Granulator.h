@@ -41,6 +41,16 @@ public:
 	double m_initMass{};				// Initial mass in the Granulator
 	std::vector<double> m_preCalc;		// Vector of precalculated values
 
+	CTDParameterHandle m_Kos;				// Overspray part in solution
+	CTDParameterHandle m_moistureContent;	// Moisture content of output granules
+
+	CStateVariableHandle m_svAtot;		// Total surface of all particles in the Granulator
+	CStateVariableHandle m_svMtot;		// Total mass of all particles in the Granulator
+	CStateVariableHandle m_svMout;		// Output mass flow of nuclei
+	CStateVariableHandle m_svMdust;		// Output dust
+	CStateVariableHandle m_svG;			// Growth rate
+	CArrayStateVariableHandle m_svPSD;	// PSD
+
 public:
 	void CreateBasicInfo() override;
 	void CreateStructure() override;
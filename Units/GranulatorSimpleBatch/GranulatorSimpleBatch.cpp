@@ -102,10 +102,8 @@ void CGranulatorSimpleBatch::Initialize(double _time)
 	AddStateVariable("Mtot"       , initMass);
 	AddStateVariable("MExhaustGas", 0);
 	AddStateVariable("G"          , 1e-8);
-	for (size_t i = 0; i < m_classesNum; ++i)
-		AddStateVariable("q3 of " + std::to_string(m_avgDiam[i] * 1e6) + " mu", q3[i]);
-	for (size_t i = 0; i < m_classesNum; ++i)
-		AddStateVariable("Mass fraction of " + std::to_string(m_avgDiam[i] * 1e6) + " mu", PSD[i]);
+	m_svq3       = CArrayStateVariableHandle{ AddArrayStateVariable("q3"           , q3) };
+	m_svMassFrac = CArrayStateVariableHandle{ AddArrayStateVariable("Mass fraction", PSD) };
 
 	/// Set tolerances to model ///
 	const auto rtol = GetConstRealParameterValue("Relative tolerance");
@@ -211,9 +209,6 @@ void CUnitDAEModel::ResultsHandler(double _time, double* _vars, double* _ders, v
 	unit->SetStateVariable("Mtot"       , _vars[m_iMtot]    , _time);
 	unit->SetStateVariable("MExhaustGas", _vars[m_iMFlowExh], _time);
 	unit->SetStateVariable("G"          , _vars[m_iG]       , _time);
-	for (size_t i = 0; i < unit->m_classesNum; ++i)
-	{
-		unit->SetStateVariable("q3 of " + std::to_string(unit->m_avgDiam[i] * 1e6) + " mu", q3[i], _time);
-		unit->SetStateVariable("Mass fraction of " + std::to_string(unit->m_avgDiam[i] * 1e6) + " mu", PSD[i], _time);
-	}
+	unit->m_svq3      .SetValues(q3.data() , _time);
+	unit->m_svMassFrac.SetValues(PSD.data(), _time);
 }
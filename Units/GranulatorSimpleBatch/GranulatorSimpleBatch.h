@@ -37,6 +37,9 @@ public:
 	std::vector<double> m_classSize;	// Class sizes of size grid for PSD.
 	std::vector<double> m_diamRatio;	// Vector: stores ratio of two adjacent diameter values, for calculating G.
 
+	CArrayStateVariableHandle m_svq3;		// q3 distribution.
+	CArrayStateVariableHandle m_svMassFrac;	// PSD as mass fractions.
+
 public:
 	void CreateBasicInfo() override;
 	void CreateStructure() override;
@@ -248,13 +248,12 @@ void CMyDAEModel::CalculateResiduals(double _time, double* _vars, double* _ders,
 	std::vector<double> normDistr_update(unit->m_distrsNum);
 	for (size_t i = 0; i < unit->m_distrsNum; ++i)
 	{
-		// Distribution vector at previous time point
-		const std::vector<double> distrPrev = unit->m_inlet->GetDistribution(timePrev, unit->m_distributions[i]);
-		// Distribution vector at current time point
-		const std::vector<double> distr = unit->m_inlet->GetDistribution(_time, unit->m_distributions[i]);
+		// Distribution vectors at previous and current time points
+		const std::vector<double> distrs = unit->m_inlet->GetDistributions({ timePrev, _time }, unit->m_distributions[i]);
+		const size_t nClasses = distrs.size() / 2;
 		// Calculate squared sum of differences between distribution vectors
-		for (size_t j = 0; j < distr.size(); ++j)
-			normDistr_update[i] += std::pow(distr[j] - distrPrev[j], 2);
+		for (size_t j = 0; j < nClasses; ++j)
+			normDistr_update[i] += std::pow(distrs[nClasses + j] - distrs[j], 2);
 		// Root of sum for 2-norm calculation for distributions
 		normDistr_update[i] = std::sqrt(normDistr_update[i]);
 	}
@@ -28,6 +28,7 @@
 #define DEFAULT_WINDOW_MAGNIFICATION_RATIO	1.2		///< Default value.
 #define	DEFAULT_WEGSTEIN_ACCEL_PARAM		-0.5	///< Default value.
 #define DEFAULT_RELAXATION_PARAM			1		///< Default value.
+#define DEFAULT_ANDERSON_DEPTH				5		///< Default value.
 
 // Initial tolerances
 #define DEFAULT_A_TOL	1e-6                        ///< Default value.
@@ -55,7 +56,8 @@ enum class EConvergenceMethod : uint32_t
 {
 	DIRECT_SUBSTITUTION	= 0,
 	WEGSTEIN			= 1,
-	STEFFENSEN			= 2
+	STEFFENSEN			= 2,
+	ANDERSON			= 3
 };
 
 /**
@@ -73,6 +73,10 @@ namespace StrConst
 		return "Loading materials database file: \n\t" + s; }
 	inline std::string DyssolC_LoadModels(const std::string& s) {
 		return "Loading models from: \n\t" + s; }
+	inline std::string DyssolC_ModelsCache(const std::string& s) {
+		return "Using models cache file: \n\t" + s; }
+	inline std::string DyssolC_KernelCache(const std::string& s) {
+		return "Using agglomeration kernels cache file: \n\t" + s; }
 	inline std::string DyssolC_LoadFlowsheet(const std::string& s) {
 		return "Loading flowsheet file: \n\t" + s; }
 	inline std::string DyssolC_SaveFlowsheet(const std::string& s) {
@@ -81,6 +85,18 @@ namespace StrConst
 		return "Initializing flowsheet"; }
 	inline std::string DyssolC_Start() {
 		return "Starting simulation"; }
+	inline std::string DyssolC_StartEnsemble(size_t n) {
+		return "Starting simulation of " + std::to_string(n) + " flowsheet variants"; }
+	inline std::string DyssolC_EnsembleProgress(size_t i, size_t n) {
+		return "\tFinished " + std::to_string(i) + " of " + std::to_string(n) + " variants"; }
+	inline std::string DyssolC_EnsembleVariantTime(size_t i, double t) {
+		return "\tVariant " + std::to_string(i + 1) + " simulated in " + StringFunctions::Double2String(t) + " [s]"; }
+	inline std::string DyssolC_ExportEnsemble(const std::string& s) {
+		return "Exporting ensemble results to: \n\t" + s; }
+	inline std::string DyssolC_ProfilingReport(const std::string& s) {
+		return "Profiling results: \n" + s; }
+	inline std::string DyssolC_ProfilingTrace(const std::string& s) {
+		return "Writing profiling trace to: \n\t" + s; }
 	inline std::string DyssolC_ExportResults(const std::string& s)	{
 		return "Exporting results to: \n\t" + s; }
 	inline std::string DyssolC_ScriptFinished(const int64_t& time_s, const int64_t& time_ms) {
@@ -99,6 +115,12 @@ namespace StrConst
 		return "Error: Unable to load flowsheet file"; }
 	inline std::string DyssolC_ErrorExportFile() {
 		return "Error: Unable to open text file for export"; }
+	inline std::string DyssolC_ErrorProfilingTrace() {
+		return "Error: Unable to write profiling trace file"; }
+	inline std::string DyssolC_ErrorExportDir() {
+		return "Error: Unable to create directory for export"; }
+	inline std::string DyssolC_ErrorExportTable(const std::string& s) {
+		return "Error: Unable to write file for export: \n\t" + s; }
 	inline std::string DyssolC_ErrorNoUnit(const std::string& p, const std::string& n, size_t i) {
 		return "Error while applying " + p + ": \n\tCannot find a unit neither by its name " + StringFunctions::Quote(n) + " nor by its index " + std::to_string(i + 1); }
 	inline std::string DyssolC_ErrorLoadModel(const std::string& p, const std::string& s) {
@@ -137,6 +159,8 @@ namespace StrConst
 		return "Error while applying " + p + ": \n\tCannot find a curve in plot " + StringFunctions::Quote(d) + " in unit " + StringFunctions::Quote(u) + " neither by its name " + StringFunctions::Quote(n) + " nor by its index " + std::to_string(i + 1); }
 	inline std::string DyssolC_ErrorInit(const std::string& s) {
 		return "Error during initialization: " + s; }
+	inline std::string DyssolC_ErrorEnsemble(size_t i, const std::string& s) {
+		return "Error during simulation of variant " + std::to_string(i + 1) + ": " + s; }
 	inline std::string DyssolC_ErrorSave() {
 		return "Error during saving to results file"; }
 	inline std::string DyssolC_ErrorFinish() {
@@ -180,6 +204,14 @@ namespace StrConst
 	const char* const SVar_H5Value   = "Value";
 	const char* const SVar_H5History = "History";
 
+//////////////////////////////////////////////////////////////////////////
+/// CArrayStateVariable
+//////////////////////////////////////////////////////////////////////////
+	const char* const ASVar_H5Name          = "Name";
+	const char* const ASVar_H5Values        = "Values";
+	const char* const ASVar_H5HistoryTimes  = "HistoryTimes";
+	const char* const ASVar_H5HistoryValues = "HistoryValues";
+
 
 //////////////////////////////////////////////////////////////////////////
 /// CStreamManager
@@ -222,6 +254,8 @@ namespace StrConst
 //////////////////////////////////////////////////////////////////////////
 	const char* const SVMngr_H5AttrStateVarsNum  = "StateVarsNumber";
 	const char* const SVMngr_H5GroupStateVarName = "StateVariable";
+	const char* const SVMngr_H5AttrArrayStateVarsNum  = "ArrayStateVarsNumber";
+	const char* const SVMngr_H5GroupArrayStateVarName = "ArrayStateVariable";
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -327,6 +361,8 @@ namespace StrConst
 		return BUnit_Err1(s1, s3, s2) + "State variable '" + s2 + "' has duplicates. State variables names must be unique within the unit."; }
 	inline std::string BUnit_ErrGetSV(const std::string& s1, const std::string& s2, const std::string& s3) {
 		return BUnit_Err1(s1, s3, s2) + "A state variable with such name does not exist in this unit.";}
+	inline std::string BUnit_ErrSetASV(const std::string& s1, const std::string& s2, const std::string& s3) {
+		return BUnit_Err1(s1, s3, s2) + "The number of values does not match the size of the array state variable.";}
 	inline std::string BUnit_ErrAddPlot(const std::string& s1, const std::string& s2, const std::string& s3) {
 		return BUnit_Err1(s1, s3, s2) + ("Plot '" + s2 + "' has duplicates. Plots names must be unique within the unit."); }
 	inline std::string BUnit_ErrAddCurve2D(const std::string& s1, const std::string& s2, const std::string& s3, const std::string& s4) {
@@ -485,6 +521,23 @@ namespace StrConst
 	inline std::string Seq_ErrMissingUnit(const std::string& s1) { return std::string("Unit '" + s1 + "' is not in calculation sequence."); }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// CEnsembleRunner
+//////////////////////////////////////////////////////////////////////////
+	const char* const  Ens_ErrStopped = "Simulation of the variant has been stopped.";
+	const char* const  Ens_ErrUnknown = "Unknown error during simulation of the variant.";
+	inline std::string Ens_ErrNoUnit(const std::string& u) {
+		return std::string("Cannot find unit '" + u + "' in the flowsheet."); }
+	inline std::string Ens_ErrNoParameter(const std::string& u, const std::string& p) {
+		return std::string("Cannot find parameter '" + p + "' in unit '" + u + "'."); }
+	inline std::string Ens_ErrNoStream(const std::string& s) {
+		return std::string("Cannot find stream '" + s + "' in the flowsheet."); }
+	inline std::string Ens_ErrValuesNumber(size_t v, size_t n, size_t m) {
+		return std::string("Variant #" + std::to_string(v + 1) + " defines " + std::to_string(n) + " values for " + std::to_string(m) + " parameters."); }
+	inline std::string Ens_ErrKPIType(const std::string& s) {
+		return std::string("Unknown KPI type '" + s + "'. Use one of: mass, temperature, pressure, state_variable."); }
+
+
 //////////////////////////////////////////////////////////////////////////
 /// CParametersHolder
 //////////////////////////////////////////////////////////////////////////
@@ -504,6 +557,7 @@ namespace StrConst
 	const char* const FlPar_H5ConvMethod	          = "ConvergenceMethod";
 	const char* const FlPar_H5WegsteinParam           = "WegsteinAccelParam";
 	const char* const FlPar_H5RelaxParam	          = "RelaxationParam";
+	const char* const FlPar_H5AndersonDepth           = "AndersonDepth";
 	const char* const FlPar_H5ExtrapMethod	          = "ExtrapolationMethod";
 	const char* const FlPar_H5SaveTimeStep	          = "SaveFileStep";
 	const char* const FlPar_H5SaveTimeStepFlagHoldups = "SaveTimeStepFlagHoldups";
@@ -655,6 +709,7 @@ namespace StrConst
 //////////////////////////////////////////////////////////////////////////
 	const char* const MM_ConfigModelsParamName	     = "modelsFolders";
 	const char* const MM_ConfigModelsFlagsParamName  = "modelsFoldersActivity";
+	const char* const MM_CacheFileSignature          = "DyssolModelsCache";
 #ifdef _MSC_VER
 	const char* const MM_LibraryFileExtension     = ".dll";
 #else
@@ -10,7 +10,12 @@
 #include "DyssolWindows.h"
 #include <tchar.h>
 #include <Psapi.h>
+#else
+#include <fstream>
+#include <string>
+#include <unistd.h>
 #endif
+#include <cstdint>
 
 namespace SystemFunctions
 {
@@ -58,4 +63,29 @@ namespace SystemFunctions
 		return processesCount;
 	}
 #endif
+
+	/// Returns the amount of physical memory in bytes, which is currently available to start new processes without swapping.
+	inline uint64_t AvailableMemory()
+	{
+#ifdef _MSC_VER
+		MEMORYSTATUSEX status;
+		status.dwLength = sizeof(status);
+		if (!GlobalMemoryStatusEx(&status))
+			return 0;
+		return status.ullAvailPhys;
+#else
+		// the estimate of the kernel, which includes reclaimable caches
+		std::ifstream meminfo{ "/proc/meminfo" };
+		std::string key;
+		uint64_t value;
+		std::string unit;
+		while (meminfo >> key >> value >> unit)
+			if (key == "MemAvailable:")
+				return value * 1024;
+		// fallback to free pages only
+		const long pages = sysconf(_SC_AVPHYS_PAGES);
+		const long size = sysconf(_SC_PAGE_SIZE);
+		return pages > 0 && size > 0 ? static_cast<uint64_t>(pages) * static_cast<uint64_t>(size) : 0;
+#endif
+	}
 }
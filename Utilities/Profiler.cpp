@@ -0,0 +1,262 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#include "Profiler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace Profiler
+{
+	std::atomic<bool> enabled{ false };
+
+	namespace
+	{
+		// A scope in the tree of scopes. Scopes with the same name and the same parent are merged.
+		struct SNode
+		{
+			std::string name;										// Name of the scope.
+			std::vector<size_t> children;							// Indices of nested scopes.
+			uint64_t calls{ 0 };									// Number of finished calls.
+			int64_t time{ 0 };										// Total duration of all calls in ns.
+			std::vector<std::pair<std::string, uint64_t>> counters;	// Named counters.
+		};
+
+		// A single finished call of a scope.
+		struct SEvent
+		{
+			size_t node;		// Index of the scope.
+			int64_t begin;		// Start time in ns.
+			int64_t duration;	// Duration in ns.
+		};
+
+		// All data recorded by one thread.
+		struct SThreadData
+		{
+			std::mutex mutex;									// Guards data against reading by reports from other threads.
+			size_t id{ 0 };										// Sequential number of the thread.
+			uint64_t epoch{ 0 };								// Epoch of the data. Data of previous epochs are removed on the next access.
+			std::vector<SNode> nodes;							// Tree of scopes, the first node is the root.
+			std::vector<std::pair<size_t, int64_t>> stack;		// Currently open scopes with their start times.
+			std::vector<SEvent> events;							// Finished calls for the trace.
+			size_t dropped{ 0 };								// Number of calls not stored in the trace due to the limit.
+		};
+
+		// Data of all threads.
+		struct SGlobalData
+		{
+			std::mutex mutex;									// Guards the list of threads.
+			std::vector<std::shared_ptr<SThreadData>> threads;	// Data of all threads that have ever recorded. Kept after the threads end.
+			std::atomic<uint64_t> epoch{ 1 };					// Current epoch, incremented with each reset.
+			std::atomic<int64_t> origin{ 0 };					// Start of time measurements in ns since the clock's epoch.
+		};
+
+		// Maximum number of calls stored for the trace by each thread, to limit memory usage.
+		constexpr size_t MAX_EVENTS = 1 << 20;
+
+		SGlobalData& Global()
+		{
+			static SGlobalData data;
+			return data;
+		}
+
+		// Returns current time in ns since the clock's epoch.
+		int64_t Clock()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		// Returns data of the calling thread, registering them on the first call.
+		SThreadData& ThisThread()
+		{
+			thread_local const std::shared_ptr<SThreadData> data = []
+			{
+				auto res = std::make_shared<SThreadData>();
+				std::lock_guard lock{ Global().mutex };
+				res->id = Global().threads.size();
+				Global().threads.push_back(res);
+				return res;
+			}();
+			return *data;
+		}
+
+		// Removes all data of the thread and sets the new epoch. The mutex of the thread data must be locked.
+		void Clear(SThreadData& _data, uint64_t _epoch)
+		{
+			_data.nodes.assign(1, SNode{});
+			_data.stack.clear();
+			_data.events.clear();
+			_data.dropped = 0;
+			_data.epoch = _epoch;
+		}
+
+		// Prepares the data of the thread for recording in the current epoch. The mutex of the thread data must be locked.
+		void Actualize(SThreadData& _data)
+		{
+			const uint64_t epoch = Global().epoch;
+			if (_data.epoch != epoch)
+				Clear(_data, epoch);
+		}
+
+		// Escapes a string to be written into JSON.
+		std::string EscapeJSON(const std::string& _s)
+		{
+			std::string res;
+			for (const char c : _s)
+			{
+				if (c == '"' || c == '\\')
+					res += '\\';
+				if (static_cast<unsigned char>(c) < 0x20)
+					res += ' ';
+				else
+					res += c;
+			}
+			return res;
+		}
+
+		// Writes the subtree of the node into the report.
+		void ReportNode(std::ostream& _s, const SThreadData& _data, size_t _node, size_t _depth)
+		{
+			const SNode& node = _data.nodes[_node];
+			int64_t childrenTime = 0;
+			for (const size_t child : node.children)
+				childrenTime += _data.nodes[child].time;
+			const std::string name = std::string(2 * _depth, ' ') + node.name;
+			_s << std::left << std::setw(48) << name << std::right
+				<< std::setw(14) << static_cast<double>(node.time) * 1e-9
+				<< std::setw(14) << static_cast<double>(std::max<int64_t>(node.time - childrenTime, 0)) * 1e-9
+				<< std::setw(12) << node.calls;
+			for (const auto& [counter, value] : node.counters)
+				_s << "  " << counter << "=" << value;
+			_s << std::endl;
+			for (const size_t child : node.children)
+				ReportNode(_s, _data, child, _depth + 1);
+		}
+	}
+
+	void Enable(bool _enable)
+	{
+		if (_enable && Global().origin == 0)
+			Global().origin = Clock();
+		enabled = _enable;
+	}
+
+	void Reset()
+	{
+		std::lock_guard lock{ Global().mutex };
+		const uint64_t epoch = ++Global().epoch;
+		Global().origin = Clock();
+		for (const auto& thread : Global().threads)
+		{
+			std::lock_guard threadLock{ thread->mutex };
+			Clear(*thread, epoch);
+		}
+	}
+
+	void Count(std::string_view _name, uint64_t _count)
+	{
+		if (!IsEnabled()) return;
+		SThreadData& data = ThisThread();
+		std::lock_guard lock{ data.mutex };
+		Actualize(data);
+		SNode& node = data.nodes[data.stack.empty() ? 0 : data.stack.back().first];
+		for (auto& [name, value] : node.counters)
+			if (name == _name)
+			{
+				value += _count;
+				return;
+			}
+		node.counters.emplace_back(_name, _count);
+	}
+
+	std::string Report()
+	{
+		std::ostringstream s;
+		s << std::fixed << std::setprecision(6);
+		std::lock_guard lock{ Global().mutex };
+		for (const auto& thread : Global().threads)
+		{
+			std::lock_guard threadLock{ thread->mutex };
+			if (thread->epoch != Global().epoch || (thread->nodes.size() <= 1 && thread->nodes.front().counters.empty())) continue;
+			s << "Thread " << thread->id << std::endl;
+			s << std::left << std::setw(48) << "  Scope" << std::right << std::setw(14) << "Total [s]" << std::setw(14) << "Self [s]" << std::setw(12) << "Calls" << "  Counters" << std::endl;
+			for (const auto& [counter, value] : thread->nodes.front().counters)
+				s << "  " << counter << "=" << value << std::endl;
+			for (const size_t child : thread->nodes.front().children)
+				ReportNode(s, *thread, child, 1);
+			if (thread->dropped != 0)
+				s << "  " << thread->dropped << " calls were not stored for the trace" << std::endl;
+		}
+		return s.str();
+	}
+
+	bool ExportTrace(const std::filesystem::path& _file)
+	{
+		std::ofstream file{ _file };
+		if (!file) return false;
+		file << std::fixed << std::setprecision(3);
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+		file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Dyssol\"}}";
+		std::lock_guard lock{ Global().mutex };
+		const int64_t origin = Global().origin;
+		for (const auto& thread : Global().threads)
+		{
+			std::lock_guard threadLock{ thread->mutex };
+			if (thread->epoch != Global().epoch || thread->events.empty()) continue;
+			file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread->id << ",\"args\":{\"name\":\"Thread " << thread->id << "\"}}";
+			for (const auto& e : thread->events)
+			{
+				// time in microseconds
+				file << ",\n{\"name\":\"" << EscapeJSON(thread->nodes[e.node].name) << "\",\"cat\":\"dyssol\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread->id
+					<< ",\"ts\":" << static_cast<double>(e.begin - origin) * 1e-3 << ",\"dur\":" << static_cast<double>(e.duration) * 1e-3 << "}";
+			}
+		}
+		file << "\n]}" << std::endl;
+		return file.good();
+	}
+
+	void CScope::Begin(std::string_view _name)
+	{
+		SThreadData& data = ThisThread();
+		std::lock_guard lock{ data.mutex };
+		Actualize(data);
+		// find or add the scope among children of the currently open one
+		const size_t parent = data.stack.empty() ? 0 : data.stack.back().first;
+		size_t node = 0;
+		for (const size_t child : data.nodes[parent].children)
+			if (data.nodes[child].name == _name)
+			{
+				node = child;
+				break;
+			}
+		if (node == 0)
+		{
+			node = data.nodes.size();
+			data.nodes.emplace_back().name = _name;
+			data.nodes[parent].children.push_back(node);
+		}
+		m_epoch = data.epoch;
+		data.stack.emplace_back(node, Clock());
+	}
+
+	void CScope::End() const
+	{
+		const int64_t end = Clock();
+		SThreadData& data = ThisThread();
+		std::lock_guard lock{ data.mutex };
+		// the data were reset since the scope was opened
+		if (data.epoch != m_epoch || data.stack.empty()) return;
+		const auto [node, begin] = data.stack.back();
+		data.stack.pop_back();
+		data.nodes[node].calls++;
+		data.nodes[node].time += end - begin;
+		if (data.events.size() < MAX_EVENTS)
+			data.events.push_back({ node, begin, end - begin });
+		else
+			data.dropped++;
+	}
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2024, DyssolTEC GmbH.
+ * All rights reserved. This file is part of Dyssol. See LICENSE file for license information. */
+
+#pragma once
+
+#include "DyssolHelperDefines.h"
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+/*
+ * Hierarchical profiler of the simulation.
+ * Each thread records its own tree of nested scopes with their execution times, numbers of calls and named counters,
+ * so that recording requires no synchronization between threads. When disabled, a scope costs one atomic read.
+ */
+namespace Profiler
+{
+	/// Whether the profiler is currently recording.
+	extern std::atomic<bool> enabled;
+
+	/// Returns whether the profiler is currently recording.
+	inline bool IsEnabled()
+	{
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	/// Starts or stops recording. Already recorded data are kept.
+	void Enable(bool _enable);
+	/// Removes all recorded data.
+	void Reset();
+
+	/// Adds _count to the counter with the given name of the innermost open scope of the calling thread.
+	void Count(std::string_view _name, uint64_t _count = 1);
+
+	/// Returns a text report with a tree of scopes for each thread: inclusive and exclusive times, numbers of calls and counters.
+	std::string Report();
+	/// Writes all recorded scopes into a file in Chrome trace event format (chrome://tracing, Perfetto). Returns success flag.
+	bool ExportTrace(const std::filesystem::path& _file);
+
+	/// Measures the time from its construction till its destruction as a scope with the given name, nested into the currently open scope.
+	class CScope
+	{
+		uint64_t m_epoch{ 0 };	/// Epoch of the recorded data when the scope was opened, zero if the profiler was disabled.
+
+	public:
+		explicit CScope(std::string_view _name)
+		{
+			if (IsEnabled())
+				Begin(_name);
+		}
+		~CScope()
+		{
+			if (m_epoch != 0)
+				End();
+		}
+		CScope(const CScope&) = delete;
+		CScope& operator=(const CScope&) = delete;
+		CScope(CScope&&) = delete;
+		CScope& operator=(CScope&&) = delete;
+
+	private:
+		/// Opens the scope in the tree of the calling thread.
+		void Begin(std::string_view _name);
+		/// Closes the scope and adds its duration to the tree of the calling thread.
+		void End() const;
+	};
+}
+
+/// Profiles the rest of the current block as a scope with the given name.
+#define PROFILE_SCOPE(NAME) const Profiler::CScope MACRO_CONCAT(profilerScope, __LINE__){ NAME };
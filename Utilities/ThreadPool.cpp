@@ -6,6 +6,12 @@
 
 size_t ThreadPool::CThreadPool::m_threadsLimit = std::numeric_limits<size_t>::max();
 
+namespace
+{
+	// Thread pool, to which the current thread belongs as a worker, or nullptr for all other threads.
+	thread_local const ThreadPool::CThreadPool* currentPool{ nullptr };
+}
+
 ThreadPool::CThreadPool::CThreadPool(size_t _threads)
 {
 	// if number of threads not specified, calculate it
@@ -54,6 +60,14 @@ void ThreadPool::CThreadPool::SubmitParallelJobs(size_t _count, const std::funct
 {
 	using FunType = std::function<void()>;
 
+	// nested call from a worker of this pool: waiting for other workers may deadlock if all of them are busy, so run sequentially
+	if (currentPool == this)
+	{
+		for (size_t i = 0; i < _count; ++i)
+			_fun(i);
+		return;
+	}
+
 	// number of available threads
 	const size_t threadsNumber = m_threads.size();
 	// number of tasks per thread
@@ -114,6 +128,7 @@ void ThreadPool::CThreadPool::SubmitParallelJobs(size_t _count, const std::funct
 
 void ThreadPool::CThreadPool::Worker()
 {
+	currentPool = this;
 	while (true)
 	{
 		std::unique_ptr<IThreadTask> task{ nullptr };
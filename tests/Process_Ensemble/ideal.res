@@ -0,0 +1,5 @@
+variant,Screen.Xcut,Screen.Alpha,Coarse,Fines,error
+1,"0 0.0018","0 10 60 9 120 8 180 6",6.810702476,3.189297524,""
+2,"0 0.002","0 10 60 9 120 8 180 6",5.093163432,4.906836568,""
+3,"0 0.0022","0 4",3.896609201,6.103390799,""
+4,"0 0.0016 120 0.0022","0 20 120 5",3.729099533,6.270900467,""
@@ -0,0 +1,4 @@
+STREAM_MASS "Fines" 0 10 30 15 60 20 90 20 120 20
+STREAM_MASS "Coarse" 0 13.1598 30 19.7397 60 26.3196 90 26.3196 120 26.3196
+STREAM_PSD "Fines" 0 0 0 1.78375e-06 3.52973e-06 6.82929e-06 1.29193e-05 2.38962e-05 4.32164e-05 7.64179e-05 0.00013212 0.000223342 0.000369144 0.000596547 0.000942564 0.0014561 0.00219924 0.0032475 0.00468814 0.00661615 0.00912716 0.012307 0.0162182 0.0208848 0.0262753 0.0322894 0.0387473 0.045388 0.0518771 0.057826 0.0628226 0.0664719 0.0684403 0.0685009 0.0665689 0.0627239 0.0572109 0.0504195 0.0428413 0.0350112 0.0274426 0.0205666 0.0146865 0.00995577 0.00638236 0.00385598 0.00219067 0.00117133 0.000593551 0.000289857 0.00014011 6.87507e-05 3.42901e-05 1.6822e-05 7.71411e-06 3.15095e-06 1.10358e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 30 0 0 1.78375e-06 3.52973e-06 6.82929e-06 1.29193e-05 2.38962e-05 4.32164e-05 7.64179e-05 0.00013212 0.000223342 0.000369144 0.000596547 0.000942564 0.0014561 0.00219924 0.0032475 0.00468814 0.00661615 0.00912716 0.012307 0.0162182 0.0208848 0.0262753 0.0322894 0.0387473 0.045388 0.0518771 0.057826 0.0628226 0.0664719 0.0684403 0.0685009 0.0665689 0.0627239 0.0572109 0.0504195 0.0428413 0.0350112 0.0274426 0.0205666 0.0146865 0.00995577 0.00638236 0.00385598 0.00219067 0.00117133 0.000593551 0.000289857 0.00014011 6.87507e-05 3.42901e-05 1.6822e-05 7.71411e-06 3.15095e-06 1.10358e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 1.78375e-06 3.52973e-06 6.82929e-06 1.29193e-05 2.38962e-05 4.32164e-05 7.64179e-05 0.00013212 0.000223342 0.000369144 0.000596547 0.000942564 0.0014561 0.00219924 0.0032475 0.00468814 0.00661615 0.00912716 0.012307 0.0162182 0.0208848 0.0262753 0.0322894 0.0387473 0.045388 0.0518771 0.057826 0.0628226 0.0664719 0.0684403 0.0685009 0.0665689 0.0627239 0.0572109 0.0504195 0.0428413 0.0350112 0.0274426 0.0205666 0.0146865 0.00995577 0.00638236 0.00385598 0.00219067 0.00117133 0.000593551 0.000289857 0.00014011 6.87507e-05 3.42901e-05 1.6822e-05 7.71411e-06 3.15095e-06 1.10358e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 90 0 0 1.78375e-06 3.52973e-06 6.82929e-06 1.29193e-05 2.38962e-05 4.32164e-05 7.64179e-05 0.00013212 0.000223342 0.000369144 0.000596547 0.000942564 0.0014561 0.00219924 0.0032475 0.00468814 0.00661615 0.00912716 0.012307 0.0162182 0.0208848 0.0262753 0.0322894 0.0387473 0.045388 0.0518771 0.057826 0.0628226 0.0664719 0.0684403 0.0685009 0.0665689 0.0627239 0.0572109 0.0504195 0.0428413 0.0350112 0.0274426 0.0205666 0.0146865 0.00995577 0.00638236 0.00385598 0.00219067 0.00117133 0.000593551 0.000289857 0.00014011 6.87507e-05 3.42901e-05 1.6822e-05 7.71411e-06 3.15095e-06 1.10358e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 120 0 0 1.78375e-06 3.52973e-06 6.82929e-06 1.29193e-05 2.38962e-05 4.32164e-05 7.64179e-05 0.00013212 0.000223342 0.000369144 0.000596547 0.000942564 0.0014561 0.00219924 0.0032475 0.00468814 0.00661615 0.00912716 0.012307 0.0162182 0.0208848 0.0262753 0.0322894 0.0387473 0.045388 0.0518771 0.057826 0.0628226 0.0664719 0.0684403 0.0685009 0.0665689 0.0627239 0.0572109 0.0504195 0.0428413 0.0350112 0.0274426 0.0205666 0.0146865 0.00995577 0.00638236 0.00385598 0.00219067 0.00117133 0.000593551 0.000289857 0.00014011 6.87507e-05 3.42901e-05 1.6822e-05 7.71411e-06 3.15095e-06 1.10358e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+STREAM_PSD "Coarse" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.43401e-06 3.31521e-06 7.2996e-06 1.53496e-05 3.08961e-05 5.96438e-05 0.000110612 0.000197348 0.000339138 0.000561925 0.000898481 0.00138731 0.00206976 0.00298492 0.00416246 0.0056137 0.00732254 0.00923774 0.0112691 0.0132898 0.0151456 0.0166726 0.0177191 0.0181705 0.0179706 0.0171347 0.0157503 0.0139654 0.0119659 0.0099475 0.00808964 0.0065364 0.00538881 0.0047078 0.00452456 0.00485345 0.00570245 0.00707828 0.00898524 0.011419 0.0143577 0.0177527 0.0215213 0.025543 0.0296601 0.0336846 0.0374092 0.0406239 0.0431347 0.0447824 0.0454589 0.0451191 0.0437856 0.0415461 0.0385441 0.0349635 0.0310098 0.0268913 0.022801 0.0189027 0.0153222 0.0121436 0.00941029 0.00712995 0.005282 0.00382594 0.00270961 0.0018763 0.00127036 0.000840973 0.000544332 0.000344488 0.000213163 0.000128967 7.62913e-05 4.41264e-05 2.49546e-05 1.37985e-05 7.46003e-06 3.94346e-06 2.03818e-06 1.03e-06 0 0 30 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.43401e-06 3.31521e-06 7.2996e-06 1.53496e-05 3.08961e-05 5.96438e-05 0.000110612 0.000197348 0.000339138 0.000561925 0.000898481 0.00138731 0.00206976 0.00298492 0.00416246 0.0056137 0.00732254 0.00923774 0.0112691 0.0132898 0.0151456 0.0166726 0.0177191 0.0181705 0.0179706 0.0171347 0.0157503 0.0139654 0.0119659 0.0099475 0.00808964 0.0065364 0.00538881 0.0047078 0.00452456 0.00485345 0.00570245 0.00707828 0.00898524 0.011419 0.0143577 0.0177527 0.0215213 0.025543 0.0296601 0.0336846 0.0374092 0.0406239 0.0431347 0.0447824 0.0454589 0.0451191 0.0437856 0.0415461 0.0385441 0.0349635 0.0310098 0.0268913 0.022801 0.0189027 0.0153222 0.0121436 0.00941029 0.00712995 0.005282 0.00382594 0.00270961 0.0018763 0.00127036 0.000840973 0.000544332 0.000344488 0.000213163 0.000128967 7.62913e-05 4.41264e-05 2.49546e-05 1.37985e-05 7.46003e-06 3.94346e-06 2.03818e-06 1.03e-06 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.43401e-06 3.31521e-06 7.2996e-06 1.53496e-05 3.08961e-05 5.96438e-05 0.000110612 0.000197348 0.000339138 0.000561925 0.000898481 0.00138731 0.00206976 0.00298492 0.00416246 0.0056137 0.00732254 0.00923774 0.0112691 0.0132898 0.0151456 0.0166726 0.0177191 0.0181705 0.0179706 0.0171347 0.0157503 0.0139654 0.0119659 0.0099475 0.00808964 0.0065364 0.00538881 0.0047078 0.00452456 0.00485345 0.00570245 0.00707828 0.00898524 0.011419 0.0143577 0.0177527 0.0215213 0.025543 0.0296601 0.0336846 0.0374092 0.0406239 0.0431347 0.0447824 0.0454589 0.0451191 0.0437856 0.0415461 0.0385441 0.0349635 0.0310098 0.0268913 0.022801 0.0189027 0.0153222 0.0121436 0.00941029 0.00712995 0.005282 0.00382594 0.00270961 0.0018763 0.00127036 0.000840973 0.000544332 0.000344488 0.000213163 0.000128967 7.62913e-05 4.41264e-05 2.49546e-05 1.37985e-05 7.46003e-06 3.94346e-06 2.03818e-06 1.03e-06 0 0 90 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.43401e-06 3.31521e-06 7.2996e-06 1.53496e-05 3.08961e-05 5.96438e-05 0.000110612 0.000197348 0.000339138 0.000561925 0.000898481 0.00138731 0.00206976 0.00298492 0.00416246 0.0056137 0.00732254 0.00923774 0.0112691 0.0132898 0.0151456 0.0166726 0.0177191 0.0181705 0.0179706 0.0171347 0.0157503 0.0139654 0.0119659 0.0099475 0.00808964 0.0065364 0.00538881 0.0047078 0.00452456 0.00485345 0.00570245 0.00707828 0.00898524 0.011419 0.0143577 0.0177527 0.0215213 0.025543 0.0296601 0.0336846 0.0374092 0.0406239 0.0431347 0.0447824 0.0454589 0.0451191 0.0437856 0.0415461 0.0385441 0.0349635 0.0310098 0.0268913 0.022801 0.0189027 0.0153222 0.0121436 0.00941029 0.00712995 0.005282 0.00382594 0.00270961 0.0018763 0.00127036 0.000840973 0.000544332 0.000344488 0.000213163 0.000128967 7.62913e-05 4.41264e-05 2.49546e-05 1.37985e-05 7.46003e-06 3.94346e-06 2.03818e-06 1.03e-06 0 0 120 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.43401e-06 3.31521e-06 7.2996e-06 1.53496e-05 3.08961e-05 5.96438e-05 0.000110612 0.000197348 0.000339138 0.000561925 0.000898481 0.00138731 0.00206976 0.00298492 0.00416246 0.0056137 0.00732254 0.00923774 0.0112691 0.0132898 0.0151456 0.0166726 0.0177191 0.0181705 0.0179706 0.0171347 0.0157503 0.0139654 0.0119659 0.0099475 0.00808964 0.0065364 0.00538881 0.0047078 0.00452456 0.00485345 0.00570245 0.00707828 0.00898524 0.011419 0.0143577 0.0177527 0.0215213 0.025543 0.0296601 0.0336846 0.0374092 0.0406239 0.0431347 0.0447824 0.0454589 0.0451191 0.0437856 0.0415461 0.0385441 0.0349635 0.0310098 0.0268913 0.022801 0.0189027 0.0153222 0.0121436 0.00941029 0.00712995 0.005282 0.00382594 0.00270961 0.0018763 0.00127036 0.000840973 0.000544332 0.000344488 0.000213163 0.000128967 7.62913e-05 4.41264e-05 2.49546e-05 1.37985e-05 7.46003e-06 3.94346e-06 2.03818e-06 1.03e-06 0 0
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 0.003 1800 0.003 3600 0.003
+STREAM_DISTRIBUTIONS "Out" 0 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000931884 0.169717 0.806155 0.0231952 0 0 0 0 0 0 0 0 0 0 0 0 1.5984e-05 0.000872697 0.0175286 0.12952 0.352071 0.352071 0.12952 0.0175286 0.000872697 1800 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.10346e-06 1.83288e-05 0.000267652 0.00303911 0.0233183 0.18915 0.612896 0.0925379 0.0624718 0.0140596 0.00211762 0.000118066 3.89716e-06 0 0 0 0 0 0 1.06821e-06 0.00302904 0.166646 0.1821 0.0978134 0.233183 0.226783 0.0796073 0.0103315 0.000506474 3600 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.64071e-06 2.73023e-05 0.000399268 0.00453832 0.0343688 0.195205 0.500878 0.131599 0.0944459 0.0303955 0.00729101 0.000797064 5.21886e-05 1.69789e-06 0 0 0 0 0 1.54647e-06 0.00461174 0.257732 0.277544 0.0907329 0.164056 0.148566 0.0501369 0.00631289 0.000306128
+HOLDUP_MASS "Agglomerator" "Holdup" 0 20 1800 20 3600 20
+HOLDUP_DISTRIBUTIONS "Agglomerator" "Holdup" 0 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000931884 0.169717 0.806155 0.0231952 0 0 0 0 0 0 0 0 0 0 0 0 1.5984e-05 0.000872697 0.0175286 0.12952 0.352071 0.352071 0.12952 0.0175286 0.000872697 1800 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.10346e-06 1.83288e-05 0.000267652 0.00303911 0.0233183 0.18915 0.612896 0.0925379 0.0624718 0.0140596 0.00211762 0.000118066 3.89716e-06 0 0 0 0 0 0 1.06821e-06 0.00302904 0.166646 0.1821 0.0978134 0.233183 0.226783 0.0796073 0.0103315 0.000506474 3600 1 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.64071e-06 2.73023e-05 0.000399268 0.00453832 0.0343688 0.195205 0.500878 0.131599 0.0944459 0.0303955 0.00729101 0.000797064 5.21886e-05 1.69789e-06 0 0 0 0 0 1.54647e-06 0.00461174 0.257732 0.277544 0.0907329 0.164056 0.148566 0.0501369 0.00631289 0.000306128
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 0.003 72000 0.003
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000305817 0.0142283 0.180667 0.516356 0.268277 0.0199986 0.000164602 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 72000 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000318503 0.0017867 0.00814678 0.0291514 0.0787238 0.153629 0.20647 0.181259 0.0990449 0.0381862 0.0318163 0.0487318 0.0437851 0.0237035 0.0179831 0.0148857 0.00896195 0.00601965 0.00353601 0.00198481 0.00101895 0.000483844 0.000206065 0 0 0 0 0 0
+HOLDUP_MASS "Agglomerator" "Holdup" 0 20 72000 20
+HOLDUP_PSD "Agglomerator" "Holdup" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000305817 0.0142283 0.180667 0.516356 0.268277 0.0199986 0.000164602 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 72000 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0.000318503 0.0017867 0.00814678 0.0291514 0.0787238 0.153629 0.20647 0.181259 0.0990449 0.0381862 0.0318163 0.0487318 0.0437851 0.0237035 0.0179831 0.0148857 0.00896195 0.00601965 0.00353601 0.00198481 0.00101895 0.000483844 0.000206065 0 0 0 0 0 0
@@ -1,2 +1,2 @@
 STREAM_MASS "Out" 0 10 60 10
-STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.16829e-06 1.51766e-06 1.9608e-06 2.60086e-06 3.38804e-06 4.3336e-06 5.51433e-06 7.23675e-06 9.22269e-06 1.16162e-05 1.45584e-05 1.8886e-05 2.3566e-05 2.92301e-05 3.62595e-05 4.60547e-05 5.65255e-05 6.90479e-05 8.48033e-05 0.000105312 0.000127276 0.000153122 0.000186017 0.00022605 0.000269032 0.000318788 0.000382712 0.000455489 0.000533869 0.000623104 0.000738595 0.000861628 0.000994628 0.00114349 0.00133719 0.00153024 0.00173985 0.00197203 0.00226965 0.00255177 0.00285776 0.00319981 0.00360846 0.00399592 0.00440826 0.00487189 0.00538796 0.00587725 0.00638741 0.00696223 0.00755761 0.00812156 0.00869637 0.00934205 0.00996281 0.010549 0.0111307 0.0117769 0.0123508 0.0128882 0.0134037 0.0139608 0.0144133 0.014828 0.0152101 0.0155803 0.0158599 0.0160943 0.0162844 0.016421 0.0164983 0.0165287 0.0165 0.0164108 0.0162937 0.0161373 0.0159077 0.0156447 0.0153792 0.0150893 0.0147157 0.0143587 0.0140146 0.0136633 0.0132243 0.0128569 0.0125069 0.0121626 0.0117396 0.0114246 0.0111251 0.0108278 0.0104974 0.0102577 0.0100371 0.00981314 0.00958892 0.00943003 0.00928734 0.00913527 0.00899944 0.00890245 0.00881455 0.00871211 0.00862852 0.00856124 0.00849474 0.00841017 0.00833889 0.00826786 0.00819059 0.00809392 0.00800253 0.00790223 0.00779079 0.00766308 0.00753206 0.00738961 0.00723486 0.00706769 0.00689333 0.00670885 0.00651423 0.00631107 0.00610159 0.00588542 0.00566315 0.00543668 0.00520723 0.00497549 0.00474231 0.00450931 0.0042774 0.00404748 0.00382038 0.00359728 0.00337886 0.00316585 0.00295886 0.00275862 0.00256553 0.00238002 0.00220243 0.00203303 0.00187198 0.00171939 0.00157531 0.0014397 0.00131249 0.00119348 0.0010826 0.00097958 0.000884147 0.00079602 0.000714886 0.00064042 0.000572277 0.000510109 0.000453558 0.00040227 0.000355891 0.000314072 0.000276476 0.000242772 0.000212645 0.000185791 0.000161923 0.000140769 0.000122074 0.000105596 9.11151e-05 7.84235e-05 6.73312e-05 5.76635e-05 4.92606e-05 4.19771e-05 3.56812e-05 3.02539e-05 2.5588e-05 2.15877e-05 1.81673e-05 1.52507e-05 1.27703e-05 1.06667e-05 8.8873e-06 7.38628e-06 6.12344e-06 5.06383e-06 4.17713e-06 3.43708e-06 2.82109e-06 2.30971e-06 1.88631e-06 1.53668e-06 1.24873e-06 1.0122e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.16829e-06 1.51766e-06 1.9608e-06 2.60086e-06 3.38804e-06 4.3336e-06 5.51433e-06 7.23675e-06 9.22269e-06 1.16162e-05 1.45584e-05 1.8886e-05 2.3566e-05 2.92301e-05 3.62595e-05 4.60547e-05 5.65255e-05 6.90479e-05 8.48033e-05 0.000105312 0.000127276 0.000153122 0.000186017 0.00022605 0.000269032 0.000318788 0.000382712 0.000455489 0.000533869 0.000623104 0.000738595 0.000861628 0.000994628 0.00114349 0.00133719 0.00153024 0.00173985 0.00197203 0.00226965 0.00255177 0.00285776 0.00319981 0.00360846 0.00399592 0.00440826 0.00487189 0.00538796 0.00587725 0.00638741 0.00696223 0.00755761 0.00812156 0.00869637 0.00934205 0.00996281 0.010549 0.0111307 0.0117769 0.0123508 0.0128882 0.0134037 0.0139608 0.0144133 0.014828 0.0152101 0.0155803 0.0158599 0.0160943 0.0162844 0.016421 0.0164983 0.0165287 0.0165 0.0164108 0.0162937 0.0161373 0.0159077 0.0156447 0.0153792 0.0150893 0.0147157 0.0143587 0.0140146 0.0136633 0.0132243 0.0128569 0.0125069 0.0121626 0.0117396 0.0114246 0.0111251 0.0108278 0.0104974 0.0102577 0.0100371 0.00981314 0.00958892 0.00943003 0.00928734 0.00913527 0.00899944 0.00890245 0.00881455 0.00871211 0.00862852 0.00856124 0.00849474 0.00841017 0.00833889 0.00826786 0.00819059 0.00809392 0.00800253 0.00790223 0.00779079 0.00766308 0.00753206 0.00738961 0.00723486 0.00706769 0.00689333 0.00670885 0.00651423 0.00631107 0.00610159 0.00588542 0.00566315 0.00543668 0.00520723 0.00497549 0.00474231 0.00450931 0.0042774 0.00404748 0.00382038 0.00359728 0.00337886 0.00316585 0.00295886 0.00275862 0.00256553 0.00238002 0.00220243 0.00203303 0.00187198 0.00171939 0.00157531 0.0014397 0.00131249 0.00119348 0.0010826 0.00097958 0.000884147 0.00079602 0.000714886 0.00064042 0.000572277 0.000510109 0.000453558 0.00040227 0.000355891 0.000314072 0.000276476 0.000242772 0.000212645 0.000185791 0.000161923 0.000140769 0.000122074 0.000105596 9.11151e-05 7.84235e-05 6.73312e-05 5.76635e-05 4.92606e-05 4.19771e-05 3.56812e-05 3.02539e-05 2.5588e-05 2.15877e-05 1.81673e-05 1.52507e-05 1.27703e-05 1.06667e-05 8.8873e-06 7.38628e-06 6.12344e-06 5.06383e-06 4.17713e-06 3.43708e-06 2.82109e-06 2.30971e-06 1.88631e-06 1.53668e-06 1.24873e-06 1.0122e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.16837e-06 1.51777e-06 1.96095e-06 2.60106e-06 3.38829e-06 4.33393e-06 5.51474e-06 7.23729e-06 9.22337e-06 1.16171e-05 1.45595e-05 1.88874e-05 2.35678e-05 2.92322e-05 3.62622e-05 4.60582e-05 5.65297e-05 6.90531e-05 8.48097e-05 0.000105319 0.000127285 0.000153133 0.00018603 0.000226067 0.000269052 0.000318812 0.00038274 0.000455523 0.000533909 0.00062315 0.00073865 0.000861692 0.000994702 0.00114357 0.00133729 0.00153036 0.00173997 0.00197218 0.00226982 0.00255195 0.00285797 0.00320004 0.00360872 0.00399622 0.00440858 0.00487225 0.00538835 0.00587768 0.00638788 0.00696273 0.00755816 0.00812215 0.00869699 0.00934273 0.00996353 0.0105497 0.0111315 0.0117778 0.0123517 0.0128891 0.0134046 0.0139618 0.0144143 0.014829 0.0152112 0.0155813 0.0158609 0.0160953 0.0162854 0.0164221 0.0164994 0.0165297 0.016501 0.0164118 0.0162947 0.0161382 0.0159086 0.0156456 0.01538 0.0150899 0.0147163 0.0143593 0.0140151 0.0136638 0.0132247 0.0128572 0.0125071 0.0121628 0.0117397 0.0114246 0.0111251 0.0108277 0.0104972 0.0102574 0.0100368 0.00981277 0.00958849 0.00942955 0.00928681 0.00913469 0.00899882 0.00890178 0.00881385 0.00871137 0.00862775 0.00856044 0.00849392 0.00840933 0.00833803 0.00826699 0.00818972 0.00809304 0.00800164 0.00790134 0.0077899 0.0076622 0.00753119 0.00738875 0.00723401 0.00706686 0.00689251 0.00670806 0.00651345 0.00631032 0.00610085 0.00588471 0.00566247 0.00543602 0.00520661 0.00497489 0.00474173 0.00450876 0.00427689 0.00404699 0.00381992 0.00359685 0.00337845 0.00316547 0.00295851 0.00275828 0.00256522 0.00237974 0.00220216 0.00203278 0.00187175 0.00171919 0.00157512 0.00143953 0.00131233 0.00119334 0.00108247 0.000979461 0.00088404 0.000795923 0.0007148 0.000640342 0.000572208 0.000510047 0.000453503 0.000402221 0.000355848 0.000314034 0.000276442 0.000242743 0.000212619 0.000185769 0.000161904 0.000140752 0.000122059 0.000105584 9.11041e-05 7.8414e-05 6.7323e-05 5.76565e-05 4.92546e-05 4.1972e-05 3.56769e-05 3.02502e-05 2.55849e-05 2.15851e-05 1.81651e-05 1.52488e-05 1.27688e-05 1.06654e-05 8.88623e-06 7.38538e-06 6.1227e-06 5.06322e-06 4.17662e-06 3.43667e-06 2.82075e-06 2.30943e-06 1.88608e-06 1.53649e-06 1.24857e-06 1.01207e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 60 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.16837e-06 1.51777e-06 1.96095e-06 2.60106e-06 3.38829e-06 4.33393e-06 5.51474e-06 7.23729e-06 9.22337e-06 1.16171e-05 1.45595e-05 1.88874e-05 2.35678e-05 2.92322e-05 3.62622e-05 4.60582e-05 5.65297e-05 6.90531e-05 8.48097e-05 0.000105319 0.000127285 0.000153133 0.00018603 0.000226067 0.000269052 0.000318812 0.00038274 0.000455523 0.000533909 0.00062315 0.00073865 0.000861692 0.000994702 0.00114357 0.00133729 0.00153036 0.00173997 0.00197218 0.00226982 0.00255195 0.00285797 0.00320004 0.00360872 0.00399622 0.00440858 0.00487225 0.00538835 0.00587768 0.00638788 0.00696273 0.00755816 0.00812215 0.00869699 0.00934273 0.00996353 0.0105497 0.0111315 0.0117778 0.0123517 0.0128891 0.0134046 0.0139618 0.0144143 0.014829 0.0152112 0.0155813 0.0158609 0.0160953 0.0162854 0.0164221 0.0164994 0.0165297 0.016501 0.0164118 0.0162947 0.0161382 0.0159086 0.0156456 0.01538 0.0150899 0.0147163 0.0143593 0.0140151 0.0136638 0.0132247 0.0128572 0.0125071 0.0121628 0.0117397 0.0114246 0.0111251 0.0108277 0.0104972 0.0102574 0.0100368 0.00981277 0.00958849 0.00942955 0.00928681 0.00913469 0.00899882 0.00890178 0.00881385 0.00871137 0.00862775 0.00856044 0.00849392 0.00840933 0.00833803 0.00826699 0.00818972 0.00809304 0.00800164 0.00790134 0.0077899 0.0076622 0.00753119 0.00738875 0.00723401 0.00706686 0.00689251 0.00670806 0.00651345 0.00631032 0.00610085 0.00588471 0.00566247 0.00543602 0.00520661 0.00497489 0.00474173 0.00450876 0.00427689 0.00404699 0.00381992 0.00359685 0.00337845 0.00316547 0.00295851 0.00275828 0.00256522 0.00237974 0.00220216 0.00203278 0.00187175 0.00171919 0.00157512 0.00143953 0.00131233 0.00119334 0.00108247 0.000979461 0.00088404 0.000795923 0.0007148 0.000640342 0.000572208 0.000510047 0.000453503 0.000402221 0.000355848 0.000314034 0.000276442 0.000242743 0.000212619 0.000185769 0.000161904 0.000140752 0.000122059 0.000105584 9.11041e-05 7.8414e-05 6.7323e-05 5.76565e-05 4.92546e-05 4.1972e-05 3.56769e-05 3.02502e-05 2.55849e-05 2.15851e-05 1.81651e-05 1.52488e-05 1.27688e-05 1.06654e-05 8.88623e-06 7.38538e-06 6.1227e-06 5.06322e-06 4.17662e-06 3.43667e-06 2.82075e-06 2.30943e-06 1.88608e-06 1.53649e-06 1.24857e-06 1.01207e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
@@ -0,0 +1,4 @@
+STREAM_MASS "Out" 0 20 200 20
+STREAM_PSD "Out" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.03516e-06 1.19602e-06 1.38034e-06 1.5913e-06 1.83247e-06 2.10784e-06 2.4219e-06 2.77967e-06 3.18674e-06 3.64937e-06 4.17451e-06 4.76993e-06 5.44421e-06 6.20692e-06 7.06862e-06 8.041e-06 9.13699e-06 1.03708e-05 1.17582e-05 1.33164e-05 1.50644e-05 1.70228e-05 1.92145e-05 2.16643e-05 2.43993e-05 2.7449e-05 3.08457e-05 3.46242e-05 3.88224e-05 4.34813e-05 4.86452e-05 5.4362e-05 6.06831e-05 6.7664e-05 7.53641e-05 8.38474e-05 9.31819e-05 0.000103441 0.000114701 0.000127047 0.000140564 0.000155348 0.000171495 0.00018911 0.000208304 0.000229191 0.000251891 0.000276533 0.000303249 0.000332176 0.000363458 0.000397245 0.000433691 0.000472954 0.000515199 0.000560595 0.000609313 0.000661529 0.000717422 0.000777174 0.000840968 0.000908987 0.000981418 0.00105844 0.00114024 0.001227 0.0013189 0.0014161 0.00151878 0.0016271 0.0017412 0.00186124 0.00198734 0.00211963 0.00225822 0.00240319 0.00255464 0.0027126 0.00287714 0.00304828 0.003226 0.00341029 0.00360111 0.00379839 0.00400202 0.00421188 0.00442783 0.00464968 0.00487722 0.00511022 0.0053484 0.00559147 0.0058391 0.00609091 0.00634654 0.00660554 0.00686749 0.00713189 0.00739824 0.00766603 0.00793468 0.00820362 0.00847227 0.00873999 0.00900617 0.00927014 0.00953125 0.00978884 0.0100422 0.0102907 0.0105337 0.0107704 0.0110002 0.0112224 0.0114364 0.0116415 0.0118371 0.0120227 0.0121976 0.0123614 0.0125134 0.0126532 0.0127804 0.0128945 0.0129951 0.0130821 0.013155 0.0132135 0.0132577 0.0132872 0.0133019 0.0133019 0.0132872 0.0132577 0.0132135 0.013155 0.0130821 0.0129951 0.0128945 0.0127804 0.0126532 0.0125134 0.0123614 0.0121976 0.0120227 0.0118371 0.0116415 0.0114364 0.0112224 0.0110002 0.0107704 0.0105337 0.0102907 0.0100422 0.00978884 0.00953125 0.00927014 0.00900617 0.00873999 0.00847227 0.00820362 0.00793468 0.00766603 0.00739824 0.00713189 0.00686749 0.00660554 0.00634654 0.00609091 0.0058391 0.00559147 0.0053484 0.00511022 0.00487722 0.00464968 0.00442783 0.00421188 0.00400202 0.00379839 0.00360111 0.00341029 0.003226 0.00304828 0.00287714 0.0027126 0.00255464 0.00240319 0.00225822 0.00211963 0.00198734 0.00186124 0.0017412 0.0016271 0.00151878 0.0014161 0.0013189 0.001227 0.00114024 0.00105844 0.000981418 0.000908987 0.000840968 0.000777174 0.000717422 0.000661529 0.000609313 0.000560595 0.000515199 0.000472954 0.000433691 0.000397245 0.000363458 0.000332176 0.000303249 0.000276533 0.000251891 0.000229191 0.000208304 0.00018911 0.000171495 0.000155348 0.000140564 0.000127047 0.000114701 0.000103441 9.31819e-05 8.38474e-05 7.53641e-05 6.7664e-05 6.06831e-05 5.4362e-05 200 0 0 0 0 0 0 0 1.05867e-06 1.48586e-06 2.00769e-06 2.63179e-06 3.36557e-06 4.21624e-06 5.19081e-06 6.29613e-06 7.53893e-06 8.92576e-06 1.04631e-05 1.21572e-05 1.40144e-05 1.60407e-05 1.82423e-05 2.0625e-05 2.31947e-05 2.59572e-05 2.89183e-05 3.20834e-05 3.54584e-05 3.90486e-05 4.28595e-05 4.68965e-05 5.11649e-05 5.56701e-05 6.04173e-05 6.54117e-05 7.06583e-05 7.61625e-05 8.19291e-05 8.79632e-05 9.42698e-05 0.000100854 0.00010772 0.000114874 0.000122319 0.000130062 0.000138106 0.000146456 0.000155117 0.000164094 0.000173392 0.000183014 0.000192966 0.000203251 0.000213876 0.000224843 0.000236159 0.000247826 0.000259849 0.000272234 0.000284984 0.000298103 0.000311596 0.000325468 0.000339722 0.000354363 0.000369395 0.000384822 0.000400649 0.00041688 0.000433518 0.000450569 0.000468035 0.000485922 0.000504234 0.000522974 0.000542146 0.000561755 0.000581804 0.000602299 0.000623241 0.000644637 0.000666489 0.000688801 0.000711578 0.000734824 0.000758541 0.000782735 0.000807409 0.000832567 0.000858212 0.000884349 0.000910981 0.000938113 0.000965748 0.000993889 0.00102254 0.00105171 0.00108139 0.0011116 0.00114233 0.00117359 0.00120538 0.00123771 0.00127058 0.00130399 0.00133795 0.00137247 0.00140753 0.00144316 0.00147934 0.00151609 0.00155341 0.00159131 0.00162977 0.00166882 0.00170845 0.00174867 0.00178948 0.00183088 0.00187287 0.00191547 0.00195867 0.00200248 0.0020469 0.00209193 0.00213758 0.00218385 0.00223075 0.00227827 0.00232642 0.00237521 0.00242463 0.00247469 0.0025254 0.00257676 0.00262876 0.00268142 0.00273474 0.00278871 0.00284335 0.00289866 0.00295464 0.00301129 0.00306862 0.00312663 0.00318533 0.00324471 0.00330479 0.00336558 0.00342706 0.00348927 0.00355219 0.00361584 0.00368024 0.0037454 0.00381132 0.00387805 0.00394559 0.00401398 0.00408327 0.00415349 0.0042247 0.00429697 0.00437039 0.00444505 0.00452108 0.00459861 0.00467782 0.00475891 0.00484211 0.00492768 0.00501596 0.00510728 0.00520207 0.00530079 0.00540396 0.00551216 0.00562603 0.00574627 0.00587364 0.00600895 0.00615306 0.00630687 0.00647132 0.00664735 0.00683591 0.00703792 0.00725426 0.00748574 0.00773307 0.00799682 0.0082774 0.00857505 0.00888973 0.00922117 0.00956878 0.00993168 0.0103086 0.0106979 0.0110976 0.0115054 0.0119183 0.0123334 0.0127471 0.0131555 0.0135547 0.0139404 0.014308 0.014653 0.014971 0.0152575 0.015508 0.0157187 0.0158857 0.0160058 0.0160761 0.0160943 0.0160589 0.0159687 0.0158235 0.0156236 0.0153702 0.0150651 0.0147106 0.0143098 0.0138664 0.0133844 0.0128684 0.0123232 0.0117538 0.0111656 0.0105638 0.00995353 0.00934 0.00872808 0.00812239 0.00752721 0.00694643 0.00638352 0.00584148 0.00532285 0.00482967 0.00436354 0.00392558 0.00351647 0.0031365 0.00278557 0.00246326 0.00216885 0.00190139 0.0016597 0.00144246 0.00124823 0.00107545 0.00092257 0.000787977 0.000670089 0.000567354 0.000478274 0.000401421 0.000335445 0.000279086 0.000231181 0.00019066 0.000156553 0.000127984 0.000104169 8.44139e-05 6.81048e-05 5.47054e-05 4.37492e-05 3.48334e-05 2.76127e-05 2.17925e-05 1.71233e-05 1.33954e-05 1.04329e-05 8.08974e-06 6.24521e-06 4.79999e-06 3.67294e-06 2.79811e-06 2.12224e-06 1.6025e-06 1.20469e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
+HOLDUP_MASS "Crusher" "Holdup" 0 300 200 300
+HOLDUP_PSD "Crusher" "Holdup" 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 1.03516e-06 1.19602e-06 1.38034e-06 1.5913e-06 1.83247e-06 2.10784e-06 2.4219e-06 2.77967e-06 3.18674e-06 3.64937e-06 4.17451e-06 4.76993e-06 5.44421e-06 6.20692e-06 7.06862e-06 8.041e-06 9.13699e-06 1.03708e-05 1.17582e-05 1.33164e-05 1.50644e-05 1.70228e-05 1.92145e-05 2.16643e-05 2.43993e-05 2.7449e-05 3.08457e-05 3.46242e-05 3.88224e-05 4.34813e-05 4.86452e-05 5.4362e-05 6.06831e-05 6.7664e-05 7.53641e-05 8.38474e-05 9.31819e-05 0.000103441 0.000114701 0.000127047 0.000140564 0.000155348 0.000171495 0.00018911 0.000208304 0.000229191 0.000251891 0.000276533 0.000303249 0.000332176 0.000363458 0.000397245 0.000433691 0.000472954 0.000515199 0.000560595 0.000609313 0.000661529 0.000717422 0.000777174 0.000840968 0.000908987 0.000981418 0.00105844 0.00114024 0.001227 0.0013189 0.0014161 0.00151878 0.0016271 0.0017412 0.00186124 0.00198734 0.00211963 0.00225822 0.00240319 0.00255464 0.0027126 0.00287714 0.00304828 0.003226 0.00341029 0.00360111 0.00379839 0.00400202 0.00421188 0.00442783 0.00464968 0.00487722 0.00511022 0.0053484 0.00559147 0.0058391 0.00609091 0.00634654 0.00660554 0.00686749 0.00713189 0.00739824 0.00766603 0.00793468 0.00820362 0.00847227 0.00873999 0.00900617 0.00927014 0.00953125 0.00978884 0.0100422 0.0102907 0.0105337 0.0107704 0.0110002 0.0112224 0.0114364 0.0116415 0.0118371 0.0120227 0.0121976 0.0123614 0.0125134 0.0126532 0.0127804 0.0128945 0.0129951 0.0130821 0.013155 0.0132135 0.0132577 0.0132872 0.0133019 0.0133019 0.0132872 0.0132577 0.0132135 0.013155 0.0130821 0.0129951 0.0128945 0.0127804 0.0126532 0.0125134 0.0123614 0.0121976 0.0120227 0.0118371 0.0116415 0.0114364 0.0112224 0.0110002 0.0107704 0.0105337 0.0102907 0.0100422 0.00978884 0.00953125 0.00927014 0.00900617 0.00873999 0.00847227 0.00820362 0.00793468 0.00766603 0.00739824 0.00713189 0.00686749 0.00660554 0.00634654 0.00609091 0.0058391 0.00559147 0.0053484 0.00511022 0.00487722 0.00464968 0.00442783 0.00421188 0.00400202 0.00379839 0.00360111 0.00341029 0.003226 0.00304828 0.00287714 0.0027126 0.00255464 0.00240319 0.00225822 0.00211963 0.00198734 0.00186124 0.0017412 0.0016271 0.00151878 0.0014161 0.0013189 0.001227 0.00114024 0.00105844 0.000981418 0.000908987 0.000840968 0.000777174 0.000717422 0.000661529 0.000609313 0.000560595 0.000515199 0.000472954 0.000433691 0.000397245 0.000363458 0.000332176 0.000303249 0.000276533 0.000251891 0.000229191 0.000208304 0.00018911 0.000171495 0.000155348 0.000140564 0.000127047 0.000114701 0.000103441 9.31819e-05 8.38474e-05 7.53641e-05 6.7664e-05 6.06831e-05 5.4362e-05 200 0 0 0 0 0 0 0 1.05867e-06 1.48586e-06 2.00769e-06 2.63179e-06 3.36557e-06 4.21624e-06 5.19081e-06 6.29613e-06 7.53893e-06 8.92576e-06 1.04631e-05 1.21572e-05 1.40144e-05 1.60407e-05 1.82423e-05 2.0625e-05 2.31947e-05 2.59572e-05 2.89183e-05 3.20834e-05 3.54584e-05 3.90486e-05 4.28595e-05 4.68965e-05 5.11649e-05 5.56701e-05 6.04173e-05 6.54117e-05 7.06583e-05 7.61625e-05 8.19291e-05 8.79632e-05 9.42698e-05 0.000100854 0.00010772 0.000114874 0.000122319 0.000130062 0.000138106 0.000146456 0.000155117 0.000164094 0.000173392 0.000183014 0.000192966 0.000203251 0.000213876 0.000224843 0.000236159 0.000247826 0.000259849 0.000272234 0.000284984 0.000298103 0.000311596 0.000325468 0.000339722 0.000354363 0.000369395 0.000384822 0.000400649 0.00041688 0.000433518 0.000450569 0.000468035 0.000485922 0.000504234 0.000522974 0.000542146 0.000561755 0.000581804 0.000602299 0.000623241 0.000644637 0.000666489 0.000688801 0.000711578 0.000734824 0.000758541 0.000782735 0.000807409 0.000832567 0.000858212 0.000884349 0.000910981 0.000938113 0.000965748 0.000993889 0.00102254 0.00105171 0.00108139 0.0011116 0.00114233 0.00117359 0.00120538 0.00123771 0.00127058 0.00130399 0.00133795 0.00137247 0.00140753 0.00144316 0.00147934 0.00151609 0.00155341 0.00159131 0.00162977 0.00166882 0.00170845 0.00174867 0.00178948 0.00183088 0.00187287 0.00191547 0.00195867 0.00200248 0.0020469 0.00209193 0.00213758 0.00218385 0.00223075 0.00227827 0.00232642 0.00237521 0.00242463 0.00247469 0.0025254 0.00257676 0.00262876 0.00268142 0.00273474 0.00278871 0.00284335 0.00289866 0.00295464 0.00301129 0.00306862 0.00312663 0.00318533 0.00324471 0.00330479 0.00336558 0.00342706 0.00348927 0.00355219 0.00361584 0.00368024 0.0037454 0.00381132 0.00387805 0.00394559 0.00401398 0.00408327 0.00415349 0.0042247 0.00429697 0.00437039 0.00444505 0.00452108 0.00459861 0.00467782 0.00475891 0.00484211 0.00492768 0.00501596 0.00510728 0.00520207 0.00530079 0.00540396 0.00551216 0.00562603 0.00574627 0.00587364 0.00600895 0.00615306 0.00630687 0.00647132 0.00664735 0.00683591 0.00703792 0.00725426 0.00748574 0.00773307 0.00799682 0.0082774 0.00857505 0.00888973 0.00922117 0.00956878 0.00993168 0.0103086 0.0106979 0.0110976 0.0115054 0.0119183 0.0123334 0.0127471 0.0131555 0.0135547 0.0139404 0.014308 0.014653 0.014971 0.0152575 0.015508 0.0157187 0.0158857 0.0160058 0.0160761 0.0160943 0.0160589 0.0159687 0.0158235 0.0156236 0.0153702 0.0150651 0.0147106 0.0143098 0.0138664 0.0133844 0.0128684 0.0123232 0.0117538 0.0111656 0.0105638 0.00995353 0.00934 0.00872808 0.00812239 0.00752721 0.00694643 0.00638352 0.00584148 0.00532285 0.00482967 0.00436354 0.00392558 0.00351647 0.0031365 0.00278557 0.00246326 0.00216885 0.00190139 0.0016597 0.00144246 0.00124823 0.00107545 0.00092257 0.000787977 0.000670089 0.000567354 0.000478274 0.000401421 0.000335445 0.000279086 0.000231181 0.00019066 0.000156553 0.000127984 0.000104169 8.44139e-05 6.81048e-05 5.47054e-05 4.37492e-05 3.48334e-05 2.76127e-05 2.17925e-05 1.71233e-05 1.33954e-05 1.04329e-05 8.08974e-06 6.24521e-06 4.79999e-06 3.67294e-06 2.79811e-06 2.12224e-06 1.6025e-06 1.20469e-06 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0
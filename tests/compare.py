@@ -15,36 +15,20 @@
 
 #
 # This script compares two files with numerical simulation results and returns an error if the difference is greater than tolerance.
+# If the reference is a directory, all files in it are compared with the files of the same names in the compare directory.
 
 import argparse
 import os.path
+import re
 import sys
 
-if __name__ == "__main__":
-
-    parser = argparse.ArgumentParser(
-        description='compares two files with numerical simulation results and returns an error if the difference is greater than tolerance.')
-    parser.add_argument('reference', action="store",
-                        help='reference file')
-    parser.add_argument('compare', action="store",
-                        help='compare file')
-    parser.add_argument('-t', '--tolerance', action="store", default=1e-3, dest="tolerance",
-                        help='numerical tolerance')
-
-    results = parser.parse_args()
-
-    referencefile = results.reference
-    comparefile = results.compare
-    tolerance = float(results.tolerance)
-
+def compare(referencefile, comparefile, tolerance):
     if (not(os.path.isfile(referencefile))):
         sys.exit(f"Reference file {referencefile} does not exist")
 
     if (not(os.path.isfile(comparefile))):
         sys.exit(f"compare file {comparefile} does not exist")
 
-    print(f"Used tolerance is {tolerance}")
-
     linesReference = []
 
     with open(referencefile) as r:
@@ -59,8 +43,9 @@ if __name__ == "__main__":
             f"Number of lines in reference file ({len(linesReference)}) does not match the number of lines in compare file ({len(linesCompare)})!")
 
     for l in range(len(linesReference)):
-        lr = linesReference[l].strip().split(" ")
-        lc = linesCompare[l].strip().split(" ")
+        # words are separated by spaces or commas, to also compare comma-separated tables
+        lr = re.split("[ ,]", linesReference[l].strip())
+        lc = re.split("[ ,]", linesCompare[l].strip())
         if (len(lr) != len(lc)):
             sys.exit(
                 f"Number of words in the line {l+1} in reference file ({len(lr)}) does not match the number of words in compare file ({len(lc)})!")
@@ -86,4 +71,38 @@ if __name__ == "__main__":
                         f"Calculated tolerance ({calculatedTolerance}) is higher as required ({tolerance}), word number {c+1} in line {l+1}: reference ({wr}) and compare ({wc})!")
 
     print(f"Files {referencefile} and {comparefile} are identical")
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(
+        description='compares two files with numerical simulation results and returns an error if the difference is greater than tolerance.')
+    parser.add_argument('reference', action="store",
+                        help='reference file or directory')
+    parser.add_argument('compare', action="store",
+                        help='compare file or directory')
+    parser.add_argument('-t', '--tolerance', action="store", default=1e-3, dest="tolerance",
+                        help='numerical tolerance')
+
+    results = parser.parse_args()
+
+    referencefile = results.reference
+    comparefile = results.compare
+    tolerance = float(results.tolerance)
+
+    print(f"Used tolerance is {tolerance}")
+
+    if (os.path.isdir(referencefile)):
+        if (not(os.path.isdir(comparefile))):
+            sys.exit(f"compare directory {comparefile} does not exist")
+        namesReference = sorted(os.listdir(referencefile))
+        namesCompare = sorted(os.listdir(comparefile))
+        if (namesReference != namesCompare):
+            sys.exit(
+                f"Files in reference directory ({namesReference}) do not match files in compare directory ({namesCompare})!")
+        for name in namesReference:
+            compare(os.path.join(referencefile, name), os.path.join(comparefile, name), tolerance)
+    else:
+        compare(referencefile, comparefile, tolerance)
+
     sys.exit(0)
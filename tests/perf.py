@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024, DyssolTEC GmbH.
+# All rights reserved. This file is part of Dyssol. See LICENSE file for license information.
+
+#
+# This script runs a test case with DyssolC and records its performance: wall time, peak memory, number of residual evaluations of
+# equation solvers and size of output files. Results are compared with a stored baseline and appended to a history file.
+# Returns an error if any of the values exceeds the baseline by more than the allowed slack.
+#
+# Usage:
+#   perf.py run    --dyssol <DyssolC> --script <script.txt> --name <case> [--baseline <file>] [--history <file>] [--slack 0.25] [--slack-counts 0] [--update-baseline]
+#   perf.py report [--baseline <file>] [--history <file>] [--last 10]
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from datetime import datetime, timezone
+
+# Recorded metrics: key, description, units, whether the value is a deterministic count checked with a separate slack.
+METRICS = [
+    ("wall_time", "Wall time", "s", False),
+    ("peak_rss", "Peak memory", "MB", False),
+    ("residuals", "Residual evaluations", "", True),
+    ("output_size", "Output size", "kB", True),
+]
+
+# Values below these limits are not compared, since they are dominated by noise.
+NOISE_LIMITS = {"wall_time": 0.05, "peak_rss": 1.0, "residuals": 0, "output_size": 0}
+
+
+def load_json(path, default):
+    if path and os.path.isfile(path):
+        with open(path) as f:
+            return json.load(f)
+    return default
+
+
+def save_json(path, data):
+    with open(path, "w") as f:
+        json.dump(data, f, indent=2, sort_keys=True)
+
+
+def load_history(path):
+    history = []
+    if path and os.path.isfile(path):
+        with open(path) as f:
+            for line in f:
+                if line.strip():
+                    history.append(json.loads(line))
+    return history
+
+
+def script_values(script, key):
+    """Returns values of all entries of the script key."""
+    values = []
+    for line in script.splitlines():
+        words = line.strip().split(maxsplit=1)
+        if len(words) == 2 and words[0].upper() == key:
+            values.append(words[1].strip().strip('"'))
+    return values
+
+
+def enable_profiling(script):
+    """Returns the script with profiling enabled in each job."""
+    lines = script.splitlines()
+    if not any(l.strip().upper().startswith("JOB") for l in lines):
+        return "PROFILING YES\n" + script
+    res = []
+    for l in lines:
+        res.append(l)
+        if l.strip().upper().startswith("JOB"):
+            res.append("PROFILING YES")
+    return "\n".join(res) + "\n"
+
+
+def peak_rss_children():
+    """Returns peak resident memory of all finished child processes in MB, or None if not available."""
+    try:
+        import resource
+    except ImportError:
+        return None
+    rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    # kB on Linux, bytes on macOS
+    return rss / (1024 * 1024) if sys.platform == "darwin" else rss / 1024
+
+
+def run_case(dyssol, script_path):
+    """Runs DyssolC with the script and returns measured metrics."""
+    with open(script_path) as f:
+        script = f.read()
+
+    # run a copy of the script with enabled profiling to obtain numbers of residual evaluations
+    fd, tmp_path = tempfile.mkstemp(suffix=".txt", text=True)
+    with os.fdopen(fd, "w") as f:
+        f.write(enable_profiling(script))
+
+    try:
+        start = time.perf_counter()
+        if sys.platform == "win32":
+            proc, rss = run_windows(dyssol, tmp_path)
+        else:
+            proc = subprocess.run([dyssol, f"--script={tmp_path}"], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+            rss = peak_rss_children()
+        wall = time.perf_counter() - start
+    finally:
+        os.remove(tmp_path)
+
+    if proc.returncode != 0:
+        print(proc.stdout)
+        sys.exit(f"DyssolC finished with error code {proc.returncode}")
+
+    residuals = sum(int(n) for n in re.findall(r"\bresiduals=(\d+)", proc.stdout))
+    outputs = script_values(script, "RESULT_FILE") + script_values(script, "EXPORT_FILE")
+    size = 0
+    for o in outputs:
+        if os.path.isfile(o):
+            size += os.path.getsize(o)
+        elif os.path.isdir(o):
+            size += sum(os.path.getsize(os.path.join(r, n)) for r, _, names in os.walk(o) for n in names)
+
+    return {
+        "wall_time": wall,
+        "peak_rss": rss,
+        "residuals": residuals,
+        "output_size": size / 1024,
+    }
+
+
+def run_windows(dyssol, script_path):
+    """Runs DyssolC on Windows and returns the process and its peak memory in MB, if psutil is available."""
+    try:
+        import psutil
+    except ImportError:
+        proc = subprocess.run([dyssol, f"--script={script_path}"], stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+        return proc, None
+    with tempfile.TemporaryFile(mode="w+") as out:
+        p = subprocess.Popen([dyssol, f"--script={script_path}"], stdout=out, stderr=subprocess.STDOUT, universal_newlines=True)
+        peak = 0
+        # the peak value is only available while the process is running
+        while p.poll() is None:
+            try:
+                info = psutil.Process(p.pid).memory_info()
+                peak = max(peak, getattr(info, "peak_wset", info.rss))
+            except psutil.Error:
+                break
+            time.sleep(0.05)
+        p.wait()
+        out.seek(0)
+        stdout = out.read()
+    return subprocess.CompletedProcess(p.args, p.returncode, stdout), peak / (1024 * 1024)
+
+
+def compare(name, current, baseline, slack, slack_counts):
+    """Compares current metrics with the baseline. Returns a list of detected regressions."""
+    regressions = []
+    for key, desc, units, exact in METRICS:
+        cur = current.get(key)
+        ref = baseline.get(key)
+        if cur is None or ref is None:
+            continue
+        if max(cur, ref) <= NOISE_LIMITS[key]:
+            continue
+        allowed = ref * (1 + (slack_counts if exact else slack))
+        change = (cur - ref) / ref * 100 if ref else 0
+        print(f"  {desc:<22} {cur:>14.3f} {units:<3} baseline {ref:>14.3f} {units:<3} ({change:+.1f} %)")
+        if cur > allowed:
+            regressions.append(f"{name}: {desc} {cur:.3f} {units} exceeds baseline {ref:.3f} {units} by more than {(slack_counts if exact else slack) * 100:.0f} %")
+    return regressions
+
+
+def command_run(args):
+    current = run_case(args.dyssol, args.script)
+    print(f"Case {args.name}:")
+    for key, desc, units, _ in METRICS:
+        if current[key] is not None:
+            print(f"  {desc:<22} {current[key]:>14.3f} {units}")
+
+    if args.history:
+        record = {"name": args.name, "date": datetime.now(timezone.utc).isoformat(timespec="seconds"), **current}
+        if args.revision:
+            record["revision"] = args.revision
+        with open(args.history, "a") as f:
+            f.write(json.dumps(record) + "\n")
+
+    if not args.baseline:
+        return 0
+
+    baselines = load_json(args.baseline, {})
+    if args.update_baseline or args.name not in baselines:
+        baselines[args.name] = current
+        save_json(args.baseline, baselines)
+        print(f"Baseline for {args.name} {'updated' if args.update_baseline else 'created'} in {args.baseline}")
+        return 0
+
+    print("Comparison with baseline:")
+    regressions = compare(args.name, current, baselines[args.name], args.slack, args.slack_counts)
+    if regressions:
+        for r in regressions:
+            print(f"Regression: {r}")
+        return 1
+    print(f"No regressions for {args.name}")
+    return 0
+
+
+def command_report(args):
+    history = load_history(args.history)
+    baselines = load_json(args.baseline, {})
+    names = sorted({r["name"] for r in history} | set(baselines))
+    if not names:
+        print("No recorded results")
+        return 0
+
+    for key, desc, units, _ in METRICS:
+        print(f"\n{desc}" + (f" [{units}]" if units else ""))
+        print(f"  {'Case':<32} {'Baseline':>12} {'Last':>12} {'Change':>9}   Trend (oldest to newest)")
+        for name in names:
+            values = [r[key] for r in history if r["name"] == name and r.get(key) is not None][-args.last:]
+            ref = baselines.get(name, {}).get(key)
+            last = values[-1] if values else None
+            change = f"{(last - ref) / ref * 100:+.1f} %" if last is not None and ref else ""
+            trend = " ".join(f"{v:.3g}" for v in values)
+            print(f"  {name:<32} {ref if ref is not None else float('nan'):>12.3f} {last if last is not None else float('nan'):>12.3f} {change:>9}   {trend}")
+    return 0
+
+
+if __name__ == "__main__":
+
+    parser = argparse.ArgumentParser(description="records performance of test cases and compares it with a baseline.")
+    subparsers = parser.add_subparsers(dest="command")
+    subparsers.required = True
+
+    run = subparsers.add_parser("run", help="run a test case and compare its performance with the baseline")
+    run.add_argument("--dyssol", required=True, help="path to DyssolC executable")
+    run.add_argument("--script", required=True, help="path to the script file of the test case")
+    run.add_argument("--name", required=True, help="name of the test case")
+    run.add_argument("--baseline", help="JSON file with baseline values of all cases; missing cases are added")
+    run.add_argument("--history", help="file to append results to, one JSON record per line")
+    run.add_argument("--slack", type=float, default=0.25, help="allowed relative increase of wall time and memory, default 0.25")
+    run.add_argument("--slack-counts", type=float, default=0.0, dest="slack_counts", help="allowed relative increase of residual evaluations and output size, default 0")
+    run.add_argument("--revision", help="revision of the code to store in the history, e.g. git commit hash")
+    run.add_argument("--update-baseline", action="store_true", dest="update_baseline", help="replace the baseline of the case with the current values")
+
+    report = subparsers.add_parser("report", help="print baseline and history of all cases")
+    report.add_argument("--baseline", help="JSON file with baseline values of all cases")
+    report.add_argument("--history", help="file with recorded results, one JSON record per line")
+    report.add_argument("--last", type=int, default=10, help="number of last results of each case to show, default 10")
+
+    args = parser.parse_args()
+    sys.exit(command_run(args) if args.command == "run" else command_report(args))